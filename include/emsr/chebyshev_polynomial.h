@@ -0,0 +1,454 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file chebyshev_polynomial.h
+ *
+ * This file contains a polynomial class in the Chebyshev basis
+ * on the interval [-1, 1].
+ */
+
+/**
+ * @def  CHEBYSHEV_POLYNOMIAL_H
+ *
+ * @brief  A guard for the Chebyshev polynomial header.
+ */
+#ifndef CHEBYSHEV_POLYNOMIAL_H
+#define CHEBYSHEV_POLYNOMIAL_H 1
+
+#include <vector>
+#include <limits>
+#include <initializer_list>
+#include <type_traits>
+#include <iosfwd>
+
+#include <emsr/polynomial.h>
+#include <emsr/fft.h>
+
+namespace emsr
+{
+
+  /**
+   * The length below which Chebyshev products and basis conversions
+   * use the direct O(n^2) formulas.
+   */
+  constexpr std::size_t chebyshev_direct_max = 32;
+
+  /**
+   * Return the values of a Chebyshev series at the N + 1 Chebyshev points
+   * x_j = cos(pi j / N), j = 0, ..., N by a DCT-I computed with an FFT.
+   * N must be a power of two not less than the degree.
+   */
+  template<typename Tp>
+    std::vector<Tp>
+    chebyshev_values(const std::vector<Tp>& coeff, std::size_t N);
+
+  /**
+   * Return the N + 1 coefficients of the polynomial interpolating values
+   * at the Chebyshev points x_j = cos(pi j / N), j = 0, ..., N
+   * by a DCT-I computed with an FFT.  N must be a power of two.
+   */
+  template<typename Tp>
+    std::vector<Tp>
+    chebyshev_coefficients(const std::vector<Tp>& values);
+
+  /**
+   * @brief A dense polynomial in the Chebyshev basis:
+   * @f[
+   *    P(x) = c_0 T_0(x) + c_1 T_1(x) + ... + c_n T_n(x)
+   * @f]
+   * The coefficients are lowest-order first.
+   *
+   * The Chebyshev basis is well conditioned on [-1, 1] where the monomial
+   * basis is not, so approximations should stay in this form.
+   * Evaluation is by Clenshaw's recurrence.  Products are formed from
+   * values at Chebyshev points by DCT and the conversions to and from
+   * the monomial basis are divide and conquer in O(n log^2 n).
+   */
+  template<typename Tp>
+    class ChebyshevPolynomial
+    {
+    public:
+
+      using value_type = Tp;
+      using size_type = std::size_t;
+      using real_type = real_type_t<Tp>;
+      using iterator = typename std::vector<value_type>::iterator;
+      using const_iterator = typename std::vector<value_type>::const_iterator;
+
+      /**
+       * The number of points evaluated together by the range evaluator.
+       */
+      static constexpr size_type s_lanes = 8;
+
+      /**
+       * Create a zero degree polynomial with coefficient value zero.
+       */
+      ChebyshevPolynomial()
+      : m_coeff(1)
+      { }
+
+      /**
+       * Create a multiple of a Chebyshev polynomial T_degree.
+       */
+      explicit
+      ChebyshevPolynomial(value_type a, size_type degree = 0)
+      : m_coeff(degree + 1)
+      { this->m_coeff[degree] = a; }
+
+      /**
+       * Create a polynomial from an initializer list of coefficients.
+       */
+      ChebyshevPolynomial(std::initializer_list<value_type> ila)
+      : m_coeff(ila)
+      {
+	if (this->m_coeff.empty())
+	  this->m_coeff.resize(1);
+      }
+
+      /**
+       * Create a polynomial from an input iterator range of coefficients.
+       */
+      template<typename InIter,
+	       typename = std::_RequireInputIter<InIter>>
+	ChebyshevPolynomial(InIter abegin, InIter aend)
+	: m_coeff(abegin, aend)
+	{
+	  if (this->m_coeff.empty())
+	    this->m_coeff.resize(1);
+	}
+
+      /**
+       * Convert a polynomial from the monomial basis.
+       */
+      explicit
+      ChebyshevPolynomial(const Polynomial<value_type>& poly);
+
+      /**
+       * Construct the Chebyshev interpolant of a function on [-1, 1].
+       *
+       * The function is sampled at 17, 33, 65, ... Chebyshev points,
+       * reusing the earlier samples, until the tail of the coefficients
+       * falls below tol times the largest sample.  The negligible tail is
+       * then chopped.
+       *
+       * @throws std::runtime_error if the function is not resolved
+       *         by a polynomial of max_degree.
+       */
+      template<typename Func,
+	       typename = std::enable_if_t<
+			    std::is_invocable_v<const Func&, real_type>>>
+	explicit
+	ChebyshevPolynomial(const Func& func,
+			    real_type tol = real_type{16}
+				* std::numeric_limits<real_type>::epsilon(),
+			    size_type max_degree = size_type{1} << 16);
+
+      /**
+       * Return the degree.
+       */
+      size_type
+      degree() const noexcept
+      { return this->m_coeff.size() - 1; }
+
+      /**
+       * Set the degree.
+       */
+      void
+      degree(size_type degree)
+      { this->m_coeff.resize(degree + 1); }
+
+      /**
+       * Return the size of the coefficient sequence.
+       */
+      size_type
+      size() const noexcept
+      { return this->m_coeff.size(); }
+
+      /**
+       * Return coefficient @c i.
+       */
+      value_type
+      operator[](size_type i) const noexcept
+      { return this->m_coeff[i]; }
+
+      /**
+       * Return coefficient @c i as an assignable quantity.
+       */
+      value_type&
+      operator[](size_type i) noexcept
+      { return this->m_coeff[i]; }
+
+      /**
+       * Return the vector of coefficients.
+       */
+      const std::vector<value_type>&
+      coefficients() const noexcept
+      { return this->m_coeff; }
+
+      iterator
+      begin() noexcept
+      { return this->m_coeff.begin(); }
+
+      iterator
+      end() noexcept
+      { return this->m_coeff.end(); }
+
+      const_iterator
+      begin() const noexcept
+      { return this->m_coeff.begin(); }
+
+      const_iterator
+      end() const noexcept
+      { return this->m_coeff.end(); }
+
+      /**
+       * Evaluate the polynomial at a point by Clenshaw's recurrence.
+       */
+      value_type
+      operator()(value_type x) const
+      {
+	value_type r;
+	this->template m_eval_lanes<1>(&x, &r);
+	return r;
+      }
+
+      /**
+       * Evaluate the polynomial at a range of input points.
+       * The points are processed in blocks of s_lanes and within a block
+       * the Clenshaw recurrences for all points are run together.
+       * The next available output iterator is returned.
+       */
+      template<typename InIter, typename OutIter,
+	       typename = std::_RequireInputIter<InIter>>
+	OutIter
+	operator()(InIter xbegin, InIter xend, OutIter rbegin) const;
+
+      /**
+       * Return the derivative polynomial.
+       */
+      ChebyshevPolynomial
+      derivative() const;
+
+      /**
+       * Return the integral polynomial with value @c c at x = -1.
+       */
+      ChebyshevPolynomial
+      integral(value_type c = value_type{}) const;
+
+      /**
+       * Return the integral of the polynomial over [-1, 1].
+       */
+      value_type
+      sum() const;
+
+      /**
+       * Return the polynomial in the monomial basis.
+       * The monomial coefficients of high degree polynomials are huge
+       * and cancel; this is meant for low to moderate degree.
+       */
+      Polynomial<value_type>
+      polynomial() const;
+
+      /**
+       * Remove trailing coefficients smaller in magnitude than
+       * max_abs_coef.
+       */
+      ChebyshevPolynomial&
+      deflate(real_type max_abs_coef)
+      {
+	using std::abs;
+	auto n = this->degree();
+	while (n > 0 && abs(this->m_coeff[n]) < max_abs_coef)
+	  --n;
+	this->degree(n);
+	return *this;
+      }
+
+      /**
+       * Unary plus.
+       */
+      ChebyshevPolynomial
+      operator+() const
+      { return *this; }
+
+      /**
+       * Unary minus.
+       */
+      ChebyshevPolynomial
+      operator-() const
+      { return ChebyshevPolynomial(*this) *= value_type(-1); }
+
+      /**
+       * Add a scalar to the polynomial.
+       */
+      ChebyshevPolynomial&
+      operator+=(const value_type& x)
+      {
+	this->m_coeff[0] += x;
+	return *this;
+      }
+
+      /**
+       * Subtract a scalar from the polynomial.
+       */
+      ChebyshevPolynomial&
+      operator-=(const value_type& x)
+      {
+	this->m_coeff[0] -= x;
+	return *this;
+      }
+
+      /**
+       * Multiply the polynomial by a scalar.
+       */
+      ChebyshevPolynomial&
+      operator*=(const value_type& c)
+      {
+	for (auto& a : this->m_coeff)
+	  a *= c;
+	return *this;
+      }
+
+      /**
+       * Divide the polynomial by a scalar.
+       */
+      ChebyshevPolynomial&
+      operator/=(const value_type& c)
+      {
+	for (auto& a : this->m_coeff)
+	  a /= c;
+	return *this;
+      }
+
+      /**
+       * Add another polynomial to the polynomial.
+       */
+      ChebyshevPolynomial&
+      operator+=(const ChebyshevPolynomial& poly)
+      {
+	this->degree(std::max(this->degree(), poly.degree()));
+	for (size_type i = 0; i <= poly.degree(); ++i)
+	  this->m_coeff[i] += poly.m_coeff[i];
+	return *this;
+      }
+
+      /**
+       * Subtract another polynomial from the polynomial.
+       */
+      ChebyshevPolynomial&
+      operator-=(const ChebyshevPolynomial& poly)
+      {
+	this->degree(std::max(this->degree(), poly.degree()));
+	for (size_type i = 0; i <= poly.degree(); ++i)
+	  this->m_coeff[i] -= poly.m_coeff[i];
+	return *this;
+      }
+
+      /**
+       * Multiply the polynomial by another polynomial.
+       * Short factors use T_i T_j = (T_{i+j} + T_{|i-j|}) / 2 directly;
+       * long ones are multiplied as values at Chebyshev points.
+       */
+      ChebyshevPolynomial&
+      operator*=(const ChebyshevPolynomial& poly);
+
+      /**
+       * Return true if two polynomials have the same coefficients.
+       */
+      friend bool
+      operator==(const ChebyshevPolynomial& pa, const ChebyshevPolynomial& pb)
+      { return pa.m_coeff == pb.m_coeff; }
+
+      /**
+       * Return false if two polynomials have the same coefficients.
+       */
+      friend bool
+      operator!=(const ChebyshevPolynomial& pa, const ChebyshevPolynomial& pb)
+      { return !(pa == pb); }
+
+    private:
+
+      template<size_type Lanes>
+	void
+	m_eval_lanes(const value_type* x, value_type* r) const;
+
+      std::vector<value_type> m_coeff;
+    };
+
+  /**
+   * Return the sum of two Chebyshev polynomials.
+   */
+  template<typename Tp>
+    inline ChebyshevPolynomial<Tp>
+    operator+(const ChebyshevPolynomial<Tp>& pa,
+	      const ChebyshevPolynomial<Tp>& pb)
+    { return ChebyshevPolynomial<Tp>(pa) += pb; }
+
+  /**
+   * Return the difference of two Chebyshev polynomials.
+   */
+  template<typename Tp>
+    inline ChebyshevPolynomial<Tp>
+    operator-(const ChebyshevPolynomial<Tp>& pa,
+	      const ChebyshevPolynomial<Tp>& pb)
+    { return ChebyshevPolynomial<Tp>(pa) -= pb; }
+
+  /**
+   * Return the product of two Chebyshev polynomials.
+   */
+  template<typename Tp>
+    inline ChebyshevPolynomial<Tp>
+    operator*(const ChebyshevPolynomial<Tp>& pa,
+	      const ChebyshevPolynomial<Tp>& pb)
+    { return ChebyshevPolynomial<Tp>(pa) *= pb; }
+
+  /**
+   * Return the product of a Chebyshev polynomial with a scalar.
+   */
+  template<typename Tp>
+    inline ChebyshevPolynomial<Tp>
+    operator*(const ChebyshevPolynomial<Tp>& poly, const Tp& x)
+    { return ChebyshevPolynomial<Tp>(poly) *= x; }
+
+  /**
+   * Return the product of a scalar with a Chebyshev polynomial.
+   */
+  template<typename Tp>
+    inline ChebyshevPolynomial<Tp>
+    operator*(const Tp& x, const ChebyshevPolynomial<Tp>& poly)
+    { return ChebyshevPolynomial<Tp>(poly) *= x; }
+
+  /**
+   * Write a Chebyshev polynomial to a stream.
+   * The format is a parenthesized comma-delimited list of coefficients.
+   */
+  template<typename CharT, typename Traits, typename Tp>
+    std::basic_ostream<CharT, Traits>&
+    operator<<(std::basic_ostream<CharT, Traits>& os,
+	       const ChebyshevPolynomial<Tp>& poly);
+
+} // namespace emsr
+
+#include <emsr/chebyshev_polynomial.tcc>
+
+#endif // CHEBYSHEV_POLYNOMIAL_H
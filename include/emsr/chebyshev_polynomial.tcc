@@ -0,0 +1,548 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file chebyshev_polynomial.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * Chebyshev polynomial class.
+ *
+ * @see chebyshev_polynomial.h
+ */
+
+/**
+ * @def  CHEBYSHEV_POLYNOMIAL_TCC
+ *
+ * @brief  A guard for the Chebyshev polynomial implementation header.
+ */
+#ifndef CHEBYSHEV_POLYNOMIAL_TCC
+#define CHEBYSHEV_POLYNOMIAL_TCC 1
+
+#include <cmath>
+#include <complex>
+#include <algorithm>
+#include <stdexcept>
+#include <ostream>
+
+namespace emsr
+{
+
+  /**
+   * Return a transformed value as the coefficient type.
+   */
+  template<typename Tp>
+    inline Tp
+    chebyshev_from_complex(const std::complex<real_type_t<Tp>>& z)
+    {
+      if constexpr (has_imag_v<Tp>)
+	return z;
+      else
+	return std::real(z);
+    }
+
+  /**
+   * Return the values of a Chebyshev series at the Chebyshev points.
+   * The even extension of the coefficients with c_0 and c_N doubled
+   * has twice the values as its DFT.
+   */
+  template<typename Tp>
+    std::vector<Tp>
+    chebyshev_values(const std::vector<Tp>& coeff, std::size_t N)
+    {
+      using Cmplx = std::complex<real_type_t<Tp>>;
+
+      if (N == 0)
+	return {coeff.empty() ? Tp{} : coeff[0]};
+      if (coeff.size() > N + 1)
+	throw std::domain_error("chebyshev_values: "
+				"Too few points for the degree");
+
+      std::vector<Cmplx> e(2 * N);
+      for (std::size_t k = 0; k < coeff.size(); ++k)
+	{
+	  e[k] = Cmplx(coeff[k]);
+	  if (k > 0 && k < N)
+	    e[2 * N - k] = Cmplx(coeff[k]);
+	}
+      e[0] *= real_type_t<Tp>{2};
+      e[N] *= real_type_t<Tp>{2};
+      fft(e);
+
+      std::vector<Tp> values(N + 1);
+      for (std::size_t j = 0; j <= N; ++j)
+	values[j] = chebyshev_from_complex<Tp>(e[j] / real_type_t<Tp>{2});
+      return values;
+    }
+
+  /**
+   * Return the coefficients of the interpolant at the Chebyshev points.
+   * The DFT of the even extension of the values gives the coefficients
+   * times N with c_0 and c_N doubled.
+   */
+  template<typename Tp>
+    std::vector<Tp>
+    chebyshev_coefficients(const std::vector<Tp>& values)
+    {
+      using Real = real_type_t<Tp>;
+      using Cmplx = std::complex<Real>;
+
+      if (values.size() <= 1)
+	return values;
+      const auto N = values.size() - 1;
+
+      std::vector<Cmplx> w(2 * N);
+      for (std::size_t j = 0; j <= N; ++j)
+	{
+	  w[j] = Cmplx(values[j]);
+	  if (j > 0 && j < N)
+	    w[2 * N - j] = Cmplx(values[j]);
+	}
+      fft(w);
+
+      std::vector<Tp> coeff(N + 1);
+      for (std::size_t k = 0; k <= N; ++k)
+	coeff[k] = chebyshev_from_complex<Tp>(w[k] / Real(N));
+      coeff[0] /= Real{2};
+      coeff[N] /= Real{2};
+      return coeff;
+    }
+
+  /**
+   * Return the product of two Chebyshev series.
+   */
+  template<typename Tp>
+    std::vector<Tp>
+    chebyshev_multiply(const std::vector<Tp>& a, const std::vector<Tp>& b)
+    {
+      using Real = real_type_t<Tp>;
+
+      const auto m = a.size() - 1;
+      const auto n = b.size() - 1;
+      if (std::min(m, n) + 1 < chebyshev_direct_max)
+	{
+	  std::vector<Tp> c(m + n + 1);
+	  for (std::size_t i = 0; i <= m; ++i)
+	    for (std::size_t j = 0; j <= n; ++j)
+	      {
+		const auto t = a[i] * b[j] / Real{2};
+		c[i + j] += t;
+		c[i > j ? i - j : j - i] += t;
+	      }
+	  return c;
+	}
+
+      const auto N = fft_size(m + n);
+      auto va = chebyshev_values(a, N);
+      const auto vb = chebyshev_values(b, N);
+      for (std::size_t j = 0; j <= N; ++j)
+	va[j] *= vb[j];
+      auto c = chebyshev_coefficients(va);
+      c.resize(m + n + 1);
+      return c;
+    }
+
+  /**
+   * Return the monomial coefficients of T_m.
+   * The coefficient of x^{m-2k} is
+   * (-1)^k (m/(m-k)) binom(m-k, k) 2^{m-2k-1}.
+   */
+  template<typename Tp>
+    std::vector<Tp>
+    chebyshev_t_monomial(std::size_t m)
+    {
+      using Real = real_type_t<Tp>;
+
+      std::vector<Tp> t(m + 1);
+      if (m == 0)
+	{
+	  t[0] = Tp{1};
+	  return t;
+	}
+      auto a = std::ldexp(Real{1}, int(m) - 1);
+      for (std::size_t k = 0; 2 * k <= m; ++k)
+	{
+	  t[m - 2 * k] = Tp(a);
+	  if (m - k - 1 > 0)
+	    a *= -Real((m - 2 * k) * (m - 2 * k - 1))
+		 / Real(4 * (k + 1) * (m - k - 1));
+	}
+      return t;
+    }
+
+  /**
+   * Return the Chebyshev coefficients of x^m
+   * @f[
+   *    x^m = 2^{1-m} \sum_{k < m/2} \binom{m}{k} T_{m-2k}
+   *        + [m even] 2^{-m} \binom{m}{m/2}
+   * @f]
+   */
+  template<typename Tp>
+    std::vector<Tp>
+    chebyshev_power(std::size_t m)
+    {
+      using Real = real_type_t<Tp>;
+
+      std::vector<Tp> d(m + 1);
+      const auto log2 = std::log(Real{2});
+      const auto lgm = std::lgamma(Real(m + 1));
+      for (std::size_t k = 0; 2 * k <= m; ++k)
+	{
+	  auto logd = (Real{1} - Real(m)) * log2 + lgm
+		    - std::lgamma(Real(k + 1)) - std::lgamma(Real(m - k + 1));
+	  if (2 * k == m)
+	    logd -= log2;
+	  d[m - 2 * k] = Tp(std::exp(logd));
+	}
+      return d;
+    }
+
+  /**
+   * Return the monomial coefficients of a Chebyshev series.
+   * Split at m = ceil(n/2): with T_{m+j} = 2 T_m T_j - T_{m-j}
+   * @f[
+   *    P = L + 2 T_m H
+   * @f]
+   * where L and H have degree at most m.
+   */
+  template<typename Tp>
+    std::vector<Tp>
+    chebyshev_to_monomial(const std::vector<Tp>& c)
+    {
+      using Real = real_type_t<Tp>;
+
+      const auto n = c.size() - 1;
+      if (c.size() <= chebyshev_direct_max)
+	{
+	  // Clenshaw's recurrence on monomial coefficient vectors.
+	  std::vector<Tp> b1(n + 1), b2(n + 1), t(n + 1);
+	  for (std::size_t k = n; k >= 1; --k)
+	    {
+	      for (std::size_t i = 0; i <= n; ++i)
+		t[i] = -b2[i];
+	      t[0] += c[k];
+	      for (std::size_t i = 0; i < n; ++i)
+		t[i + 1] += Real{2} * b1[i];
+	      b2.swap(b1);
+	      b1.swap(t);
+	    }
+	  std::vector<Tp> p(n + 1);
+	  for (std::size_t i = 0; i <= n; ++i)
+	    p[i] = -b2[i];
+	  p[0] += c[0];
+	  for (std::size_t i = 0; i < n; ++i)
+	    p[i + 1] += b1[i];
+	  return p;
+	}
+
+      const auto m = (n + 1) / 2;
+      std::vector<Tp> lo(c.begin(), c.begin() + m + 1);
+      lo[m] = Tp{};
+      std::vector<Tp> hi(c.begin() + m, c.end());
+      for (std::size_t j = 0; j <= n - m; ++j)
+	lo[m - j] -= c[m + j];
+
+      auto p = chebyshev_to_monomial(lo);
+      const auto q = convolve(chebyshev_t_monomial<Tp>(m),
+			      chebyshev_to_monomial(hi));
+      p.resize(n + 1);
+      for (std::size_t i = 0; i <= n; ++i)
+	p[i] += Real{2} * q[i];
+      return p;
+    }
+
+  /**
+   * Return the Chebyshev coefficients of a monomial series.
+   * Split at m = ceil(n/2): P = L + x^m H.
+   */
+  template<typename Tp>
+    std::vector<Tp>
+    monomial_to_chebyshev(const std::vector<Tp>& a)
+    {
+      using Real = real_type_t<Tp>;
+
+      const auto n = a.size() - 1;
+      if (a.size() <= chebyshev_direct_max)
+	{
+	  // Horner's rule with multiplication by x in the Chebyshev basis:
+	  // x T_0 = T_1, x T_j = (T_{j+1} + T_{j-1}) / 2.
+	  std::vector<Tp> r(n + 1), t(n + 1);
+	  r[0] = a[n];
+	  for (std::size_t k = n; k-- > 0;)
+	    {
+	      std::fill(t.begin(), t.end(), Tp{});
+	      const auto deg = n - k - 1;
+	      for (std::size_t j = 0; j <= deg; ++j)
+		if (j == 0)
+		  t[1] += r[0];
+		else
+		  {
+		    t[j + 1] += r[j] / Real{2};
+		    t[j - 1] += r[j] / Real{2};
+		  }
+	      t[0] += a[k];
+	      r.swap(t);
+	    }
+	  return r;
+	}
+
+      const auto m = (n + 1) / 2;
+      auto c = monomial_to_chebyshev(std::vector<Tp>(a.begin(),
+						     a.begin() + m));
+      const auto h = chebyshev_multiply(chebyshev_power<Tp>(m),
+			monomial_to_chebyshev(std::vector<Tp>(a.begin() + m,
+							      a.end())));
+      c.resize(n + 1);
+      for (std::size_t i = 0; i <= n; ++i)
+	c[i] += h[i];
+      return c;
+    }
+
+  /**
+   * Convert a polynomial from the monomial basis.
+   */
+  template<typename Tp>
+    ChebyshevPolynomial<Tp>::ChebyshevPolynomial(const Polynomial<Tp>& poly)
+    : m_coeff(monomial_to_chebyshev(std::vector<Tp>(poly.begin(), poly.end())))
+    { }
+
+  /**
+   * Construct the Chebyshev interpolant of a function on [-1, 1].
+   */
+  template<typename Tp>
+    template<typename Func, typename>
+      ChebyshevPolynomial<Tp>::ChebyshevPolynomial(const Func& func,
+						    real_type tol,
+						    size_type max_degree)
+      : m_coeff(1)
+      {
+	using std::abs;
+	const auto s_pi = real_type(3.1415926535897932384626433832795029L);
+	// The Chebyshev points cos(pi j / N) written to be exactly symmetric.
+	const auto point = [s_pi](size_type j, size_type N)
+	  {
+	    return std::sin(s_pi * (real_type(N) - real_type(2 * j))
+			    / real_type(2 * N));
+	  };
+
+	size_type N = 16;
+	std::vector<value_type> values(N + 1);
+	for (size_type j = 0; j <= N; ++j)
+	  values[j] = value_type(func(point(j, N)));
+
+	while (true)
+	  {
+	    auto coeff = chebyshev_coefficients(values);
+	    auto vscale = real_type{0};
+	    for (const auto& v : values)
+	      vscale = std::max(vscale, real_type(abs(v)));
+	    if (vscale == real_type{0})
+	      return;
+
+	    // Resolved if the last eighth of the coefficients is negligible.
+	    const auto cutoff = tol * vscale;
+	    const auto tail = std::max(size_type{2}, N / 8);
+	    bool resolved = true;
+	    for (size_type k = N - tail + 1; k <= N; ++k)
+	      if (!(abs(coeff[k]) < cutoff))
+		{
+		  resolved = false;
+		  break;
+		}
+	    if (resolved)
+	      {
+		this->m_coeff = std::move(coeff);
+		this->deflate(cutoff);
+		return;
+	      }
+
+	    if (2 * N > max_degree)
+	      throw std::runtime_error("ChebyshevPolynomial: "
+				       "Function not resolved");
+	    std::vector<value_type> finer(2 * N + 1);
+	    for (size_type j = 0; j <= N; ++j)
+	      finer[2 * j] = values[j];
+	    for (size_type j = 0; j < N; ++j)
+	      finer[2 * j + 1] = value_type(func(point(2 * j + 1, 2 * N)));
+	    values = std::move(finer);
+	    N *= 2;
+	  }
+      }
+
+  /**
+   * Run Clenshaw's recurrence for a block of points.
+   */
+  template<typename Tp>
+    template<typename ChebyshevPolynomial<Tp>::size_type Lanes>
+      void
+      ChebyshevPolynomial<Tp>::m_eval_lanes(const value_type* x,
+					    value_type* r) const
+      {
+	const auto& c = this->m_coeff;
+	value_type b1[Lanes], b2[Lanes];
+	for (size_type l = 0; l < Lanes; ++l)
+	  {
+	    b1[l] = value_type{};
+	    b2[l] = value_type{};
+	  }
+	for (size_type k = this->degree(); k >= 1; --k)
+	  for (size_type l = 0; l < Lanes; ++l)
+	    {
+	      const auto t = c[k] + real_type{2} * x[l] * b1[l] - b2[l];
+	      b2[l] = b1[l];
+	      b1[l] = t;
+	    }
+	for (size_type l = 0; l < Lanes; ++l)
+	  r[l] = c[0] + x[l] * b1[l] - b2[l];
+      }
+
+  /**
+   * Evaluate the polynomial at a range of input points.
+   */
+  template<typename Tp>
+    template<typename InIter, typename OutIter, typename>
+      OutIter
+      ChebyshevPolynomial<Tp>::operator()(InIter xbegin, InIter xend,
+					  OutIter rbegin) const
+      {
+	value_type x[s_lanes], r[s_lanes];
+	size_type k = 0;
+	for (; xbegin != xend; ++xbegin)
+	  {
+	    x[k++] = *xbegin;
+	    if (k == s_lanes)
+	      {
+		this->template m_eval_lanes<s_lanes>(x, r);
+		for (size_type j = 0; j < s_lanes; ++j)
+		  *rbegin++ = r[j];
+		k = 0;
+	      }
+	  }
+	for (size_type j = 0; j < k; ++j)
+	  {
+	    this->template m_eval_lanes<1>(x + j, r + j);
+	    *rbegin++ = r[j];
+	  }
+	return rbegin;
+      }
+
+  /**
+   * Return the derivative polynomial.
+   * The coefficients satisfy c'_{k-1} = c'_{k+1} + 2k c_k
+   * with c'_0 halved.
+   */
+  template<typename Tp>
+    ChebyshevPolynomial<Tp>
+    ChebyshevPolynomial<Tp>::derivative() const
+    {
+      const auto n = this->degree();
+      if (n == 0)
+	return ChebyshevPolynomial();
+      std::vector<value_type> d(n + 1);
+      for (size_type k = n; k >= 1; --k)
+	d[k - 1] = (k + 1 <= n ? d[k + 1] : value_type{})
+		 + real_type(2 * k) * this->m_coeff[k];
+      d[0] /= real_type{2};
+      d.pop_back();
+      return ChebyshevPolynomial(d.begin(), d.end());
+    }
+
+  /**
+   * Return the integral polynomial with value @c c at x = -1.
+   * The coefficients are C_k = (c_{k-1} - c_{k+1}) / 2k for k > 1
+   * and C_1 = c_0 - c_2 / 2.
+   */
+  template<typename Tp>
+    ChebyshevPolynomial<Tp>
+    ChebyshevPolynomial<Tp>::integral(value_type c) const
+    {
+      const auto n = this->degree();
+      const auto coeff = [this, n](size_type k)
+	{ return k <= n ? this->m_coeff[k] : value_type{}; };
+      std::vector<value_type> F(n + 2);
+      F[1] = coeff(0) - coeff(2) / real_type{2};
+      for (size_type k = 2; k <= n + 1; ++k)
+	F[k] = (coeff(k - 1) - coeff(k + 1)) / real_type(2 * k);
+      auto at_minus_one = value_type{};
+      for (size_type k = 1; k <= n + 1; ++k)
+	at_minus_one += (k % 2 == 0 ? F[k] : -F[k]);
+      F[0] = c - at_minus_one;
+      return ChebyshevPolynomial(F.begin(), F.end());
+    }
+
+  /**
+   * Return the integral of the polynomial over [-1, 1].
+   * The integral of T_k is 2 / (1 - k^2) for even k and zero for odd k.
+   */
+  template<typename Tp>
+    typename ChebyshevPolynomial<Tp>::value_type
+    ChebyshevPolynomial<Tp>::sum() const
+    {
+      auto s = value_type{};
+      for (size_type k = 0; k <= this->degree(); k += 2)
+	s += this->m_coeff[k] * real_type{2}
+	   / (real_type{1} - real_type(k) * real_type(k));
+      return s;
+    }
+
+  /**
+   * Return the polynomial in the monomial basis.
+   */
+  template<typename Tp>
+    Polynomial<typename ChebyshevPolynomial<Tp>::value_type>
+    ChebyshevPolynomial<Tp>::polynomial() const
+    {
+      const auto p = chebyshev_to_monomial(this->m_coeff);
+      return Polynomial<value_type>(p.begin(), p.end());
+    }
+
+  /**
+   * Multiply the polynomial by another polynomial.
+   */
+  template<typename Tp>
+    ChebyshevPolynomial<Tp>&
+    ChebyshevPolynomial<Tp>::operator*=(const ChebyshevPolynomial& poly)
+    {
+      this->m_coeff = chebyshev_multiply(this->m_coeff, poly.m_coeff);
+      return *this;
+    }
+
+  /**
+   * Write a Chebyshev polynomial to a stream.
+   */
+  template<typename CharT, typename Traits, typename Tp>
+    std::basic_ostream<CharT, Traits>&
+    operator<<(std::basic_ostream<CharT, Traits>& os,
+	       const ChebyshevPolynomial<Tp>& poly)
+    {
+      int old_prec = os.precision(std::numeric_limits<Tp>::max_digits10);
+      os << "(";
+      for (std::size_t i = 0; i < poly.degree(); ++i)
+	os << poly[i] << ",";
+      os << poly[poly.degree()];
+      os << ")";
+      os.precision(old_prec);
+      return os;
+    }
+
+} // namespace emsr
+
+#endif // CHEBYSHEV_POLYNOMIAL_TCC
@@ -0,0 +1,75 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file compose.h
+ *
+ * This file contains the fast composition of polynomials.
+ * The composition of static polynomials, which is evaluated at compile
+ * time, is in static_polynomial.h.
+ */
+
+/**
+ * @def  COMPOSE_H
+ *
+ * @brief  A guard for the polynomial composition header.
+ */
+#ifndef COMPOSE_H
+#define COMPOSE_H 1
+
+#include <cstddef>
+
+#include <emsr/polynomial.h>
+#include <emsr/static_polynomial.h>
+#include <emsr/fft.h>
+#include <emsr/newton_polygon.h>
+
+namespace emsr
+{
+
+  /**
+   * Return the composition P(Q(x)) of two polynomials.
+   *
+   * The coefficients of P are split in halves at a power of two m,
+   * P = P_lo + x^m P_hi, so that
+   * @f[
+   *    P(Q) = P_{lo}(Q) + Q^m P_{hi}(Q)
+   * @f]
+   * with the powers Q^{2^k} computed once by repeated squaring.
+   * With the products done by convolve this takes O(M(nm) log n)
+   * for degrees n and m rather than the O(n^2 m^2) of Horner's rule
+   * with polynomial coefficients.  Long products go through the FFT
+   * at a few scalings x -> 2^s x read off the Newton polygons of the
+   * factors so the error in each coefficient is relative to the terms
+   * that form it, as with Horner's rule, rather than to the largest.
+   * When the coefficients span a wide range many scalings are needed
+   * and the products fall back to the direct sum.
+   */
+  template<typename Tp>
+    Polynomial<Tp>
+    compose(const Polynomial<Tp>& P, const Polynomial<Tp>& Q);
+
+} // namespace emsr
+
+#include <emsr/compose.tcc>
+
+#endif // COMPOSE_H
@@ -0,0 +1,244 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file compose.tcc
+ *
+ * This file contains the out-of-line implementation of the
+ * composition of polynomials.
+ *
+ * @see compose.h
+ */
+
+/**
+ * @def  COMPOSE_TCC
+ *
+ * @brief  A guard for the polynomial composition implementation header.
+ */
+#ifndef COMPOSE_TCC
+#define COMPOSE_TCC 1
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <type_traits>
+
+namespace emsr
+{
+
+  /**
+   * Return x 2^e for a real exponent e without forming 2^e.
+   */
+  template<typename Tp, typename Real>
+    Tp
+    compose_ldexp(const Tp& x, Real e)
+    {
+      const auto fl = std::floor(e);
+      const auto fr = std::exp2(e - fl);
+      const auto i = static_cast<int>(fl);
+      if constexpr (std::is_same_v<Tp, std::complex<Real>>)
+	return Tp(std::ldexp(fr * std::real(x), i),
+		  std::ldexp(fr * std::imag(x), i));
+      else
+	return std::ldexp(fr * x, i);
+    }
+
+  /**
+   * Return the product of two coefficient sequences with the error in each
+   * coefficient relative to the size of the terms that form it.
+   *
+   * The FFT error is relative to the largest coefficient so the product
+   * is formed after the substitution x -> 2^s x for a few slopes s
+   * of the Newton polygon of the product, the Minkowski sum of those
+   * of the factors.  From each scaled product the coefficients within
+   * a few bits of the largest are kept.
+   */
+  template<typename Tp>
+    std::vector<Tp>
+    compose_product(const std::vector<Tp>& a, const std::vector<Tp>& b)
+    {
+      using Real = real_type_t<Tp>;
+      if (a.empty() || b.empty()
+	  || std::min(a.size(), b.size()) < fft_convolve_min)
+	return convolve(a, b);
+
+      std::vector<Tp> c(a.size() + b.size() - 1);
+      const auto ha = newton_polygon(Polynomial<Tp>(a.begin(), a.end()));
+      const auto hb = newton_polygon(Polynomial<Tp>(b.begin(), b.end()));
+      if (ha.empty() || hb.empty())
+	return c;
+
+      const auto lg2 = [](const Tp& x) { return std::log2(std::abs(x)); };
+      const auto slope = [lg2](const std::vector<Tp>& v,
+			       const std::vector<std::size_t>& h,
+			       std::size_t i)
+	{
+	  return i + 1 < h.size()
+	       ? (lg2(v[h[i + 1]]) - lg2(v[h[i]])) / Real(h[i + 1] - h[i])
+	       : -std::numeric_limits<Real>::infinity();
+	};
+
+      // The vertices (vk, vh) of the polygon of the product, in bits,
+      // by merging the edges of the factors in order of decreasing slope.
+      std::vector<std::size_t> vk{ha[0] + hb[0]};
+      std::vector<Real> vh{lg2(a[ha[0]]) + lg2(b[hb[0]])};
+      std::vector<Real> vs;
+      for (std::size_t i = 0, j = 0; i + 1 < ha.size() || j + 1 < hb.size();)
+	{
+	  const auto sa = slope(a, ha, i);
+	  const auto sb = slope(b, hb, j);
+	  const auto dk = sa >= sb ? ha[i + 1] - ha[i] : hb[j + 1] - hb[j];
+	  vs.push_back(std::max(sa, sb));
+	  vk.push_back(vk.back() + dk);
+	  vh.push_back(vh.back() + vs.back() * Real(dk));
+	  if (sa >= sb)
+	    ++i;
+	  else
+	    ++j;
+	}
+      if (vs.empty())
+	vs.push_back(Real{0});
+
+      const auto polygon = [&vk, &vh, &vs](std::size_t k, std::size_t& e)
+	{
+	  while (e + 1 < vs.size() && vk[e + 1] <= k)
+	    ++e;
+	  return vh[e] + vs[e] * (Real(k) - Real(vk[e]));
+	};
+
+      const auto maxlg = [lg2](const std::vector<Tp>& v,
+			       const std::vector<std::size_t>& h, Real s)
+	{
+	  auto m = -std::numeric_limits<Real>::infinity();
+	  for (auto i : h)
+	    m = std::max(m, lg2(v[i]) - s * Real(i));
+	  return m;
+	};
+
+      // The bits below the largest scaled coefficient that are kept.
+      const auto loss = Real{12};
+
+      // Take for each range of coefficients the smallest slope that keeps
+      // the first of them.  The scaled polygon is concave with the first
+      // within the loss of its top so the coefficients kept run from it up.
+      std::vector<std::pair<std::size_t, Real>> ranges;
+      std::size_t e = 0;
+      for (auto k = vk.front(); k <= vk.back();)
+	{
+	  const auto hk = polygon(k, e);
+	  auto w = e;
+	  while (w + 1 < vs.size()
+		 && hk - vs[w + 1] * Real(k)
+		    >= vh[w + 1] - vs[w + 1] * Real(vk[w + 1]) - loss)
+	    ++w;
+	  const auto top = vh[w] - vs[w] * Real(vk[w]);
+	  ranges.emplace_back(k, vs[w]);
+	  for (; k <= vk.back(); ++k)
+	    if (polygon(k, e) - vs[w] * Real(k) < top - loss)
+	      break;
+	}
+
+      // The direct sum is cheaper for many ranges.
+      const auto n = fft_size(c.size());
+      auto lgn = std::size_t{0};
+      while ((std::size_t{1} << lgn) < n)
+	++lgn;
+      if (6 * ranges.size() * n * lgn > a.size() * b.size())
+	{
+	  for (std::size_t i = 0; i < a.size(); ++i)
+	    for (std::size_t j = 0; j < b.size(); ++j)
+	      c[i + j] += a[i] * b[j];
+	  return c;
+	}
+
+      ranges.emplace_back(vk.back() + 1, Real{0});
+      for (std::size_t r = 0; r + 1 < ranges.size(); ++r)
+	{
+	  const auto s = ranges[r].second;
+	  const auto sa = maxlg(a, ha, s);
+	  const auto sb = maxlg(b, hb, s);
+	  std::vector<Tp> as(a.size()), bs(b.size());
+	  for (std::size_t i = 0; i < a.size(); ++i)
+	    as[i] = compose_ldexp(a[i], -s * Real(i) - sa);
+	  for (std::size_t i = 0; i < b.size(); ++i)
+	    bs[i] = compose_ldexp(b[i], -s * Real(i) - sb);
+	  const auto cs = convolve(as, bs);
+	  for (auto k = ranges[r].first; k < ranges[r + 1].first; ++k)
+	    c[k] = compose_ldexp(cs[k], s * Real(k) + sa + sb);
+	}
+      return c;
+    }
+
+  /**
+   * Return P_lo(Q) + Q^m P_hi(Q) for the coefficients [first, first + len)
+   * where m is the largest power of two less than len and qpow[k] holds
+   * the coefficients of Q^(2^k).
+   */
+  template<typename Tp>
+    std::vector<Tp>
+    compose_split(const Tp* first, std::size_t len,
+		  const std::vector<std::vector<Tp>>& qpow)
+    {
+      if (len == 1)
+	return {first[0]};
+
+      std::size_t m = 1;
+      int k = 0;
+      while (2 * m < len)
+	{
+	  m *= 2;
+	  ++k;
+	}
+
+      auto r = compose_product(qpow[k],
+				 compose_split(first + m, len - m, qpow));
+      const auto lo = compose_split(first, m, qpow);
+      for (std::size_t j = 0; j < lo.size(); ++j)
+	r[j] += lo[j];
+      return r;
+    }
+
+  /**
+   * Return the composition P(Q(x)) of two polynomials.
+   */
+  template<typename Tp>
+    Polynomial<Tp>
+    compose(const Polynomial<Tp>& P, const Polynomial<Tp>& Q)
+    {
+      const auto n = P.degree();
+      if (n == 0 || Q.degree() == 0)
+	return Polynomial<Tp>(P(Q[0]));
+
+      std::vector<std::vector<Tp>> qpow;
+      qpow.emplace_back(Q.begin(), Q.end());
+      for (std::size_t m = 2; m <= n; m *= 2)
+	qpow.push_back(compose_product(qpow.back(), qpow.back()));
+
+      const auto r = compose_split(P.data(), n + 1, qpow);
+      return Polynomial<Tp>(r.begin(), r.end());
+    }
+
+} // namespace emsr
+
+#endif // COMPOSE_TCC
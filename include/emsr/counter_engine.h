@@ -0,0 +1,135 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file counter_engine.h
+ *
+ * This file contains a small counter-based random number engine.
+ */
+
+/**
+ * @def  COUNTER_ENGINE_H
+ *
+ * @brief  A guard for the counter engine header.
+ */
+#ifndef COUNTER_ENGINE_H
+#define COUNTER_ENGINE_H 1
+
+#include <cstdint>
+#include <limits>
+#include <algorithm> // For min.
+
+namespace emsr
+{
+
+  /**
+   * A counter-based random number engine.
+   *
+   * The n-th output is the SplitMix64 finalizer applied to
+   * key + n * gamma where the key is derived from a seed and a stream
+   * index.  The state is two integers so construction is free and
+   * each polynomial of a batch can have its own stream keyed by its
+   * index.  The outputs depend only on (seed, stream, n) so results do
+   * not depend on the order in which a batch is processed.
+   *
+   * This satisfies the UniformRandomBitGenerator requirements.
+   */
+  class CounterEngine
+  {
+  public:
+
+    using result_type = std::uint64_t;
+
+    /**
+     * Create an engine for a stream of a seed.
+     */
+    explicit constexpr
+    CounterEngine(std::uint64_t seed = 0, std::uint64_t stream = 0) noexcept
+    : m_key(s_mix(s_mix(seed) ^ (stream * s_gamma + s_gamma))),
+      m_counter(0)
+    { }
+
+    static constexpr result_type
+    min() noexcept
+    { return std::numeric_limits<result_type>::min(); }
+
+    static constexpr result_type
+    max() noexcept
+    { return std::numeric_limits<result_type>::max(); }
+
+    /**
+     * Return the next output.
+     */
+    constexpr result_type
+    operator()() noexcept
+    { return s_mix(this->m_key + ++this->m_counter * s_gamma); }
+
+    /**
+     * Skip the next num outputs.
+     */
+    constexpr void
+    discard(std::uint64_t num) noexcept
+    { this->m_counter += num; }
+
+    /**
+     * Return the next output mapped to [0, 1).
+     * The top min(64, digits) bits are used so the result is exactly
+     * reproducible on any platform with the same floating point type.
+     */
+    template<typename Real>
+      constexpr Real
+      canonical() noexcept
+      {
+	constexpr int bits = std::min(64, std::numeric_limits<Real>::digits);
+	auto scale = Real{1};
+	for (int i = 0; i < bits; ++i)
+	  scale /= Real{2};
+	return Real((*this)() >> (64 - bits)) * scale;
+      }
+
+    friend constexpr bool
+    operator==(const CounterEngine& a, const CounterEngine& b) noexcept
+    { return a.m_key == b.m_key && a.m_counter == b.m_counter; }
+
+    friend constexpr bool
+    operator!=(const CounterEngine& a, const CounterEngine& b) noexcept
+    { return !(a == b); }
+
+  private:
+
+    static constexpr std::uint64_t s_gamma = 0x9e3779b97f4a7c15ULL;
+
+    static constexpr std::uint64_t
+    s_mix(std::uint64_t z) noexcept
+    {
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      return z ^ (z >> 31);
+    }
+
+    std::uint64_t m_key;
+    std::uint64_t m_counter;
+  };
+
+} // namespace emsr
+
+#endif // COUNTER_ENGINE_H
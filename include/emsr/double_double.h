@@ -0,0 +1,474 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file double_double.h
+ *
+ * This file contains a double-double floating point type.
+ *
+ * A double-double number is the unevaluated sum of two doubles
+ * hi + lo with |lo| <= ulp(hi)/2 giving 106 bits of significand.
+ * The algorithms follow Hida, Li and Bailey, "Library for Double-Double
+ * and Quad-Double Arithmetic" (2007).
+ */
+
+/**
+ * @def  DOUBLE_DOUBLE_H
+ *
+ * @brief  A guard for the double-double header.
+ */
+#ifndef DOUBLE_DOUBLE_H
+#define DOUBLE_DOUBLE_H 1
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <iosfwd>
+
+namespace emsr
+{
+
+  /**
+   * A floating point number represented as the unevaluated sum
+   * of two doubles.
+   *
+   * The arithmetic is constexpr.  Where the target has a fast fused
+   * multiply-add the exact products use it, otherwise they use
+   * Dekker's splitting.
+   */
+  class DoubleDouble
+  {
+  public:
+
+    constexpr
+    DoubleDouble() noexcept = default;
+
+    constexpr
+    DoubleDouble(double hi) noexcept
+    : m_hi(hi), m_lo(0.0)
+    { }
+
+    constexpr
+    DoubleDouble(double hi, double lo) noexcept
+    : m_hi(hi), m_lo(lo)
+    { }
+
+    constexpr
+    DoubleDouble(long double x) noexcept
+    : m_hi(static_cast<double>(x)),
+      m_lo(static_cast<double>(x - static_cast<long double>(m_hi)))
+    { }
+
+    template<typename Int,
+	     typename = std::enable_if_t<std::is_integral_v<Int>>>
+      constexpr
+      DoubleDouble(Int n) noexcept
+      : m_hi(static_cast<double>(n)),
+	m_lo(static_cast<double>(n - static_cast<Int>(m_hi)))
+      { }
+
+    /// Return the leading part.
+    constexpr double
+    hi() const noexcept
+    { return this->m_hi; }
+
+    /// Return the trailing part.
+    constexpr double
+    lo() const noexcept
+    { return this->m_lo; }
+
+    explicit constexpr
+    operator double() const noexcept
+    { return this->m_hi + this->m_lo; }
+
+    explicit constexpr
+    operator float() const noexcept
+    { return static_cast<float>(this->m_hi + this->m_lo); }
+
+    explicit constexpr
+    operator long double() const noexcept
+    {
+      return static_cast<long double>(this->m_hi)
+	   + static_cast<long double>(this->m_lo);
+    }
+
+    constexpr DoubleDouble
+    operator+() const noexcept
+    { return *this; }
+
+    constexpr DoubleDouble
+    operator-() const noexcept
+    { return DoubleDouble(-this->m_hi, -this->m_lo); }
+
+    constexpr DoubleDouble&
+    operator+=(const DoubleDouble& b) noexcept
+    {
+      auto [s1, s2] = s_two_sum(this->m_hi, b.m_hi);
+      const auto [t1, t2] = s_two_sum(this->m_lo, b.m_lo);
+      s2 += t1;
+      const auto [u1, u2] = s_quick_two_sum(s1, s2);
+      const auto [v1, v2] = s_quick_two_sum(u1, u2 + t2);
+      this->m_hi = v1;
+      this->m_lo = v2;
+      return *this;
+    }
+
+    constexpr DoubleDouble&
+    operator-=(const DoubleDouble& b) noexcept
+    { return *this += -b; }
+
+    constexpr DoubleDouble&
+    operator*=(const DoubleDouble& b) noexcept
+    {
+      auto [p1, p2] = s_two_prod(this->m_hi, b.m_hi);
+      p2 += this->m_hi * b.m_lo + this->m_lo * b.m_hi;
+      const auto [s1, s2] = s_quick_two_sum(p1, p2);
+      this->m_hi = s1;
+      this->m_lo = s2;
+      return *this;
+    }
+
+    constexpr DoubleDouble&
+    operator/=(const DoubleDouble& b) noexcept
+    {
+      const auto q1 = this->m_hi / b.m_hi;
+      auto r = *this - q1 * b;
+      const auto q2 = r.m_hi / b.m_hi;
+      r -= q2 * b;
+      const auto q3 = r.m_hi / b.m_hi;
+      const auto [s1, s2] = s_quick_two_sum(q1, q2);
+      *this = DoubleDouble(s1, s2) + DoubleDouble(q3);
+      return *this;
+    }
+
+    friend constexpr DoubleDouble
+    operator+(DoubleDouble a, const DoubleDouble& b) noexcept
+    { return a += b; }
+
+    friend constexpr DoubleDouble
+    operator-(DoubleDouble a, const DoubleDouble& b) noexcept
+    { return a -= b; }
+
+    friend constexpr DoubleDouble
+    operator*(DoubleDouble a, const DoubleDouble& b) noexcept
+    { return a *= b; }
+
+    friend constexpr DoubleDouble
+    operator/(DoubleDouble a, const DoubleDouble& b) noexcept
+    { return a /= b; }
+
+    friend constexpr bool
+    operator==(const DoubleDouble& a, const DoubleDouble& b) noexcept
+    { return a.m_hi == b.m_hi && a.m_lo == b.m_lo; }
+
+    friend constexpr bool
+    operator!=(const DoubleDouble& a, const DoubleDouble& b) noexcept
+    { return !(a == b); }
+
+    friend constexpr bool
+    operator<(const DoubleDouble& a, const DoubleDouble& b) noexcept
+    { return a.m_hi < b.m_hi || (a.m_hi == b.m_hi && a.m_lo < b.m_lo); }
+
+    friend constexpr bool
+    operator>(const DoubleDouble& a, const DoubleDouble& b) noexcept
+    { return b < a; }
+
+    friend constexpr bool
+    operator<=(const DoubleDouble& a, const DoubleDouble& b) noexcept
+    { return a.m_hi < b.m_hi || (a.m_hi == b.m_hi && a.m_lo <= b.m_lo); }
+
+    friend constexpr bool
+    operator>=(const DoubleDouble& a, const DoubleDouble& b) noexcept
+    { return b <= a; }
+
+    /**
+     * Return the exact sum of two doubles.
+     */
+    static constexpr DoubleDouble
+    sum(double a, double b) noexcept
+    {
+      const auto [s, e] = s_two_sum(a, b);
+      return DoubleDouble(s, e);
+    }
+
+    /**
+     * Return the exact product of two doubles.
+     */
+    static constexpr DoubleDouble
+    product(double a, double b) noexcept
+    {
+      const auto [p, e] = s_two_prod(a, b);
+      return DoubleDouble(p, e);
+    }
+
+  private:
+
+    struct s_pair
+    {
+      double hi;
+      double lo;
+    };
+
+    static constexpr s_pair
+    s_two_sum(double a, double b) noexcept
+    {
+      const auto s = a + b;
+      const auto bb = s - a;
+      return {s, (a - (s - bb)) + (b - bb)};
+    }
+
+    static constexpr s_pair
+    s_quick_two_sum(double a, double b) noexcept
+    {
+      const auto s = a + b;
+      return {s, b - (s - a)};
+    }
+
+    static constexpr s_pair
+    s_split(double a) noexcept
+    {
+      constexpr double splitter = 134217729.0; // 2^27 + 1
+      constexpr double split_thresh = 6.69692879491417e+299; // 2^996
+      if (a > split_thresh || a < -split_thresh)
+	{
+	  a *= 3.7252902984619140625e-09; // 2^-28
+	  const auto t = splitter * a;
+	  const auto hi = t - (t - a);
+	  const auto lo = a - hi;
+	  return {hi * 268435456.0, lo * 268435456.0}; // 2^28
+	}
+      const auto t = splitter * a;
+      const auto hi = t - (t - a);
+      return {hi, a - hi};
+    }
+
+    static constexpr s_pair
+    s_two_prod(double a, double b) noexcept
+    {
+      const auto p = a * b;
+#if defined(__FP_FAST_FMA) && defined(__GNUC__) && !defined(__clang__)
+      return {p, __builtin_fma(a, b, -p)};
+#else
+      const auto [ahi, alo] = s_split(a);
+      const auto [bhi, blo] = s_split(b);
+      return {p, ((ahi * bhi - p) + ahi * blo + alo * bhi) + alo * blo};
+#endif
+    }
+
+    double m_hi = 0.0;
+    double m_lo = 0.0;
+  };
+
+  /**
+   * Classification.
+   */
+  inline bool
+  isnan(const DoubleDouble& a)
+  { return std::isnan(a.hi()) || std::isnan(a.lo()); }
+
+  inline bool
+  isinf(const DoubleDouble& a)
+  { return std::isinf(a.hi()); }
+
+  inline bool
+  isfinite(const DoubleDouble& a)
+  { return std::isfinite(a.hi()); }
+
+  inline bool
+  signbit(const DoubleDouble& a)
+  { return std::signbit(a.hi()); }
+
+  /**
+   * Sign manipulation.
+   */
+  constexpr DoubleDouble
+  abs(const DoubleDouble& a) noexcept
+  { return a.hi() < 0.0 ? -a : a; }
+
+  constexpr DoubleDouble
+  fabs(const DoubleDouble& a) noexcept
+  { return abs(a); }
+
+  inline DoubleDouble
+  copysign(const DoubleDouble& a, const DoubleDouble& b)
+  { return std::signbit(a.hi()) != std::signbit(b.hi()) ? -a : a; }
+
+  /**
+   * The real and imaginary parts as for the built-in types.
+   */
+  constexpr DoubleDouble
+  real(const DoubleDouble& a) noexcept
+  { return a; }
+
+  constexpr DoubleDouble
+  imag(const DoubleDouble&) noexcept
+  { return DoubleDouble(0.0); }
+
+  /**
+   * Exponent manipulation.
+   */
+  inline int
+  ilogb(const DoubleDouble& a)
+  { return std::ilogb(a.hi()); }
+
+  inline DoubleDouble
+  ldexp(const DoubleDouble& a, int exp)
+  { return DoubleDouble(std::ldexp(a.hi(), exp), std::ldexp(a.lo(), exp)); }
+
+  /**
+   * Rounding.
+   */
+  DoubleDouble floor(const DoubleDouble& a);
+  DoubleDouble ceil(const DoubleDouble& a);
+  DoubleDouble trunc(const DoubleDouble& a);
+
+  /**
+   * Fused multiply-add.  This is not correctly rounded
+   * but it is as accurate as the separate operations.
+   */
+  constexpr DoubleDouble
+  fma(const DoubleDouble& a, const DoubleDouble& b, const DoubleDouble& c)
+  noexcept
+  { return a * b + c; }
+
+  /**
+   * Elementary functions.
+   */
+  DoubleDouble sqrt(const DoubleDouble& a);
+  DoubleDouble cbrt(const DoubleDouble& a);
+  DoubleDouble exp(const DoubleDouble& a);
+  DoubleDouble log(const DoubleDouble& a);
+  DoubleDouble log10(const DoubleDouble& a);
+  DoubleDouble pow(const DoubleDouble& a, int n);
+  DoubleDouble pow(const DoubleDouble& a, const DoubleDouble& b);
+  DoubleDouble sin(const DoubleDouble& a);
+  DoubleDouble cos(const DoubleDouble& a);
+  DoubleDouble tan(const DoubleDouble& a);
+  DoubleDouble atan2(const DoubleDouble& y, const DoubleDouble& x);
+  DoubleDouble atan(const DoubleDouble& a);
+  DoubleDouble asin(const DoubleDouble& a);
+  DoubleDouble acos(const DoubleDouble& a);
+  DoubleDouble hypot(const DoubleDouble& a, const DoubleDouble& b);
+
+  /**
+   * Stream output in the format selected by the stream flags
+   * and precision.
+   */
+  template<typename CharT, typename Traits>
+    std::basic_ostream<CharT, Traits>&
+    operator<<(std::basic_ostream<CharT, Traits>& os, const DoubleDouble& x);
+
+  /**
+   * Stream input of a decimal floating point number.
+   */
+  template<typename CharT, typename Traits>
+    std::basic_istream<CharT, Traits>&
+    operator>>(std::basic_istream<CharT, Traits>& is, DoubleDouble& x);
+
+} // namespace emsr
+
+namespace std
+{
+
+  template<>
+    class numeric_limits<emsr::DoubleDouble>
+    {
+    public:
+      static constexpr bool is_specialized = true;
+
+      static constexpr emsr::DoubleDouble
+      min() noexcept
+      { return emsr::DoubleDouble(2.0041683600089728e-292); } // 2^-969
+
+      static constexpr emsr::DoubleDouble
+      max() noexcept
+      {
+	return emsr::DoubleDouble(1.79769313486231570815e+308,
+				  9.97920154767359795037e+291);
+      }
+
+      static constexpr emsr::DoubleDouble
+      lowest() noexcept
+      { return -max(); }
+
+      static constexpr int digits = 106;
+      static constexpr int digits10 = 31;
+      static constexpr int max_digits10 = 33;
+      static constexpr bool is_signed = true;
+      static constexpr bool is_integer = false;
+      static constexpr bool is_exact = false;
+      static constexpr int radix = 2;
+
+      static constexpr emsr::DoubleDouble
+      epsilon() noexcept
+      { return emsr::DoubleDouble(4.93038065763132e-32); } // 2^-104
+
+      static constexpr emsr::DoubleDouble
+      round_error() noexcept
+      { return emsr::DoubleDouble(0.5); }
+
+      static constexpr int min_exponent = -968;
+      static constexpr int min_exponent10 = -291;
+      static constexpr int max_exponent = 1024;
+      static constexpr int max_exponent10 = 308;
+
+      static constexpr bool has_infinity = true;
+      static constexpr bool has_quiet_NaN = true;
+      static constexpr bool has_signaling_NaN = true;
+      static constexpr float_denorm_style has_denorm = denorm_absent;
+      static constexpr bool has_denorm_loss = false;
+
+      static constexpr emsr::DoubleDouble
+      infinity() noexcept
+      { return emsr::DoubleDouble(numeric_limits<double>::infinity()); }
+
+      static constexpr emsr::DoubleDouble
+      quiet_NaN() noexcept
+      {
+	return emsr::DoubleDouble(numeric_limits<double>::quiet_NaN(),
+				  numeric_limits<double>::quiet_NaN());
+      }
+
+      static constexpr emsr::DoubleDouble
+      signaling_NaN() noexcept
+      {
+	return emsr::DoubleDouble(numeric_limits<double>::signaling_NaN(),
+				  numeric_limits<double>::signaling_NaN());
+      }
+
+      static constexpr emsr::DoubleDouble
+      denorm_min() noexcept
+      { return min(); }
+
+      static constexpr bool is_iec559 = false;
+      static constexpr bool is_bounded = true;
+      static constexpr bool is_modulo = false;
+      static constexpr bool traps = false;
+      static constexpr bool tinyness_before = false;
+      static constexpr float_round_style round_style = round_to_nearest;
+    };
+
+} // namespace std
+
+#include <emsr/double_double.tcc>
+
+#endif // DOUBLE_DOUBLE_H
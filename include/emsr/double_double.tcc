@@ -0,0 +1,657 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file double_double.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * double-double functions.
+ *
+ * @see double_double.h
+ */
+
+/**
+ * @def  DOUBLE_DOUBLE_TCC
+ *
+ * @brief  A guard for the double-double implementation header.
+ */
+#ifndef DOUBLE_DOUBLE_TCC
+#define DOUBLE_DOUBLE_TCC 1
+
+#include <string>
+#include <vector>
+#include <algorithm> // For max.
+#include <istream>
+#include <ostream>
+#include <sstream>
+
+namespace emsr
+{
+
+  /// pi to double-double precision.
+  inline constexpr DoubleDouble dd_pi{3.141592653589793116e+00,
+				      1.224646799147353207e-16};
+
+  /// pi/2 to double-double precision.
+  inline constexpr DoubleDouble dd_pi_2{1.570796326794896558e+00,
+					6.123233995736766036e-17};
+
+  /// 2 pi to double-double precision.
+  inline constexpr DoubleDouble dd_2pi{6.283185307179586232e+00,
+				       2.449293598294706414e-16};
+
+  /// log(2) to double-double precision.
+  inline constexpr DoubleDouble dd_ln2{6.931471805599452862e-01,
+				       2.319046813846299558e-17};
+
+  /// log(10) to double-double precision.
+  inline constexpr DoubleDouble dd_ln10{2.302585092994045901e+00,
+					-2.170756223382249351e-16};
+
+  inline DoubleDouble
+  floor(const DoubleDouble& a)
+  {
+    const auto hi = std::floor(a.hi());
+    if (hi == a.hi())
+      return DoubleDouble::sum(hi, std::floor(a.lo()));
+    return DoubleDouble(hi);
+  }
+
+  inline DoubleDouble
+  ceil(const DoubleDouble& a)
+  {
+    const auto hi = std::ceil(a.hi());
+    if (hi == a.hi())
+      return DoubleDouble::sum(hi, std::ceil(a.lo()));
+    return DoubleDouble(hi);
+  }
+
+  inline DoubleDouble
+  trunc(const DoubleDouble& a)
+  { return a.hi() < 0.0 ? ceil(a) : floor(a); }
+
+  /**
+   * One Newton step for the reciprocal square root in double
+   * corrected in double-double (Karp's trick).
+   */
+  inline DoubleDouble
+  sqrt(const DoubleDouble& a)
+  {
+    if (a.hi() == 0.0)
+      return a;
+    if (a.hi() < 0.0)
+      return std::numeric_limits<DoubleDouble>::quiet_NaN();
+    if (std::isinf(a.hi()))
+      return a;
+    const auto x = 1.0 / std::sqrt(a.hi());
+    const auto ax = a.hi() * x;
+    const auto diff = a - DoubleDouble::product(ax, ax);
+    return DoubleDouble::sum(ax, diff.hi() * (x * 0.5));
+  }
+
+  inline DoubleDouble
+  cbrt(const DoubleDouble& a)
+  {
+    if (a.hi() == 0.0 || !std::isfinite(a.hi()))
+      return a;
+    DoubleDouble x = std::cbrt(a.hi());
+    x -= (x * x * x - a) / (3 * x * x);
+    return x;
+  }
+
+  /**
+   * The exponential by reduction to |r| <= log(2)/1024,
+   * a Taylor series and nine squarings.
+   */
+  inline DoubleDouble
+  exp(const DoubleDouble& a)
+  {
+    if (a.hi() <= -709.0)
+      return DoubleDouble(0.0);
+    if (a.hi() >= 709.8)
+      return std::numeric_limits<DoubleDouble>::infinity();
+    if (a.hi() == 0.0)
+      return DoubleDouble(1.0);
+
+    const auto m = std::floor(a.hi() / dd_ln2.hi() + 0.5);
+    const auto r = ldexp(a - dd_ln2 * m, -9);
+    const auto eps = std::numeric_limits<DoubleDouble>::epsilon().hi();
+
+    // s = exp(r) - 1
+    auto s = r;
+    auto t = r;
+    for (int n = 2; n < 20; ++n)
+      {
+	t = t * r / n;
+	s += t;
+	if (std::abs(t.hi()) <= eps * std::abs(s.hi()))
+	  break;
+      }
+
+    // exp(2r) - 1 = 2(exp(r) - 1) + (exp(r) - 1)^2
+    for (int i = 0; i < 9; ++i)
+      s = ldexp(s, 1) + s * s;
+
+    return ldexp(s + 1, static_cast<int>(m));
+  }
+
+  /**
+   * The logarithm by Newton's method on the exponential.
+   * The power of two is split off first so exp(-x) stays in range
+   * for the low part.
+   */
+  inline DoubleDouble
+  log(const DoubleDouble& a)
+  {
+    if (a.hi() == 1.0 && a.lo() == 0.0)
+      return DoubleDouble(0.0);
+    if (a.hi() == 0.0)
+      return -std::numeric_limits<DoubleDouble>::infinity();
+    if (a.hi() < 0.0)
+      return std::numeric_limits<DoubleDouble>::quiet_NaN();
+    if (std::isinf(a.hi()))
+      return a;
+
+    int k = 0;
+    std::frexp(a.hi(), &k);
+    const auto m = ldexp(a, -k);
+    DoubleDouble x = std::log(m.hi());
+    x += m * exp(-x) - 1;
+    return x + dd_ln2 * k;
+  }
+
+  inline DoubleDouble
+  log10(const DoubleDouble& a)
+  { return log(a) / dd_ln10; }
+
+  /**
+   * Integer powers by repeated squaring.
+   */
+  inline DoubleDouble
+  pow(const DoubleDouble& a, int n)
+  {
+    if (n == 0)
+      return DoubleDouble(1.0);
+
+    auto r = a;
+    auto s = DoubleDouble(1.0);
+    auto nn = n < 0 ? -static_cast<long long>(n) : static_cast<long long>(n);
+    while (nn > 0)
+      {
+	if (nn % 2 == 1)
+	  s *= r;
+	nn /= 2;
+	if (nn > 0)
+	  r *= r;
+      }
+
+    return n < 0 ? 1 / s : s;
+  }
+
+  inline DoubleDouble
+  pow(const DoubleDouble& a, const DoubleDouble& b)
+  {
+    if (b == trunc(b) && std::abs(b.hi()) < 1.0e9)
+      return pow(a, static_cast<int>(b.hi()));
+    return exp(b * log(a));
+  }
+
+  /**
+   * The sine and cosine of a reduced argument |t| <= pi/4.
+   */
+  inline void
+  dd_sincos_taylor(const DoubleDouble& t, DoubleDouble& s, DoubleDouble& c)
+  {
+    const auto eps = std::numeric_limits<DoubleDouble>::epsilon().hi();
+    const auto tt = -(t * t);
+
+    s = t;
+    auto term = t;
+    for (int n = 3; n < 40; n += 2)
+      {
+	term = term * tt / ((n - 1) * n);
+	s += term;
+	if (std::abs(term.hi()) <= eps * std::abs(s.hi()))
+	  break;
+      }
+
+    c = DoubleDouble(1.0);
+    term = DoubleDouble(1.0);
+    for (int n = 2; n < 40; n += 2)
+      {
+	term = term * tt / ((n - 1) * n);
+	c += term;
+	if (std::abs(term.hi()) <= eps)
+	  break;
+      }
+  }
+
+  /**
+   * The sine and cosine with reduction modulo pi/2.
+   */
+  inline void
+  dd_sincos(const DoubleDouble& a, DoubleDouble& s, DoubleDouble& c)
+  {
+    const auto z = std::floor(a.hi() / dd_2pi.hi() + 0.5);
+    const auto r = a - dd_2pi * z;
+    const auto q = std::floor(r.hi() / dd_pi_2.hi() + 0.5);
+    const auto t = r - dd_pi_2 * q;
+    DoubleDouble st, ct;
+    dd_sincos_taylor(t, st, ct);
+    switch (static_cast<int>(q))
+      {
+      case 0:
+	s = st;
+	c = ct;
+	break;
+      case 1:
+	s = ct;
+	c = -st;
+	break;
+      case -1:
+	s = -ct;
+	c = st;
+	break;
+      default:
+	s = -st;
+	c = -ct;
+	break;
+      }
+  }
+
+  inline DoubleDouble
+  sin(const DoubleDouble& a)
+  {
+    DoubleDouble s, c;
+    dd_sincos(a, s, c);
+    return s;
+  }
+
+  inline DoubleDouble
+  cos(const DoubleDouble& a)
+  {
+    DoubleDouble s, c;
+    dd_sincos(a, s, c);
+    return c;
+  }
+
+  inline DoubleDouble
+  tan(const DoubleDouble& a)
+  {
+    DoubleDouble s, c;
+    dd_sincos(a, s, c);
+    return s / c;
+  }
+
+  /**
+   * The arctangent by one Newton step from the double result.
+   */
+  inline DoubleDouble
+  atan2(const DoubleDouble& y, const DoubleDouble& x)
+  {
+    if (x.hi() == 0.0 && y.hi() == 0.0)
+      return DoubleDouble(std::atan2(y.hi(), x.hi()));
+
+    DoubleDouble z = std::atan2(y.hi(), x.hi());
+    const auto r = hypot(x, y);
+    const auto xx = x / r;
+    const auto yy = y / r;
+    DoubleDouble s, c;
+    dd_sincos(z, s, c);
+    if (std::abs(xx.hi()) > std::abs(yy.hi()))
+      z += (yy - s) / c;
+    else
+      z -= (xx - c) / s;
+    return z;
+  }
+
+  inline DoubleDouble
+  atan(const DoubleDouble& a)
+  { return atan2(a, DoubleDouble(1.0)); }
+
+  inline DoubleDouble
+  asin(const DoubleDouble& a)
+  {
+    if (std::abs(a.hi()) > 1.0)
+      return std::numeric_limits<DoubleDouble>::quiet_NaN();
+    return atan2(a, sqrt((1 - a) * (1 + a)));
+  }
+
+  inline DoubleDouble
+  acos(const DoubleDouble& a)
+  {
+    if (std::abs(a.hi()) > 1.0)
+      return std::numeric_limits<DoubleDouble>::quiet_NaN();
+    return atan2(sqrt((1 - a) * (1 + a)), a);
+  }
+
+  inline DoubleDouble
+  hypot(const DoubleDouble& a, const DoubleDouble& b)
+  {
+    const auto aa = abs(a);
+    const auto ab = abs(b);
+    const auto s = aa < ab ? ab : aa;
+    if (s.hi() == 0.0 || !std::isfinite(s.hi()))
+      return s;
+    const auto x = aa / s;
+    const auto y = ab / s;
+    return s * sqrt(x * x + y * y);
+  }
+
+  /**
+   * Return |x| / 10^e without overflowing the power of ten.
+   */
+  inline DoubleDouble
+  dd_scale10(const DoubleDouble& x, int e)
+  {
+    auto r = abs(x);
+    if (e < -300)
+      r = r * pow(DoubleDouble(10.0), 300) * pow(DoubleDouble(10.0), -e - 300);
+    else if (e > 0)
+      r /= pow(DoubleDouble(10.0), e);
+    else if (e < 0)
+      r *= pow(DoubleDouble(10.0), -e);
+    return r;
+  }
+
+  /**
+   * Write the first num + 1 decimal digits of a nonzero finite number
+   * to digs and return the decimal exponent.  The digits are rounded
+   * to num digits.
+   */
+  inline int
+  dd_to_digits(const DoubleDouble& x, int num, std::string& digs)
+  {
+    int e = static_cast<int>(std::floor(std::log10(abs(x).hi())));
+    auto r = dd_scale10(x, e);
+    if (r >= 10)
+      {
+	r /= 10;
+	++e;
+      }
+    else if (r < 1)
+      {
+	r *= 10;
+	--e;
+      }
+
+    std::vector<int> d(num + 1);
+    for (int i = 0; i <= num; ++i)
+      {
+	d[i] = static_cast<int>(r.hi());
+	r = (r - d[i]) * 10;
+      }
+
+    // Fix out of range digits.
+    for (int i = num; i > 0; --i)
+      if (d[i] < 0)
+	{
+	  --d[i - 1];
+	  d[i] += 10;
+	}
+      else if (d[i] > 9)
+	{
+	  ++d[i - 1];
+	  d[i] -= 10;
+	}
+
+    // Round.
+    if (d[num] >= 5)
+      {
+	++d[num - 1];
+	for (int i = num - 1; i > 0 && d[i] > 9; --i)
+	  {
+	    d[i] -= 10;
+	    ++d[i - 1];
+	  }
+      }
+    if (d[0] > 9)
+      {
+	d[0] = 1;
+	for (int i = 1; i < num; ++i)
+	  d[i] = 0;
+	++e;
+      }
+
+    digs.clear();
+    for (int i = 0; i < num; ++i)
+      digs += static_cast<char>('0' + d[i]);
+    return e;
+  }
+
+  /**
+   * Return the decimal digits of |x| rounded to prec places after
+   * the point, as an integer in units of 10^-prec.
+   */
+  inline std::string
+  dd_fixed_digits(const DoubleDouble& x, int prec)
+  {
+    if (x.hi() == 0.0)
+      return "0";
+
+    std::string digs;
+    int e = dd_to_digits(x, 1, digs);
+    int num = e + 1 + prec;
+    if (num > 0)
+      {
+	const auto e1 = e;
+	e = dd_to_digits(x, num, digs);
+	// The one digit pass may have rounded up into the next decade.
+	if (e < e1 && --num > 0)
+	  e = dd_to_digits(x, num, digs);
+      }
+
+    if (num > 0)
+      // Rounding up may carry into a new leading digit.
+      return digs.append(e + 1 - num + prec, '0');
+    else if (num == 0)
+      // Only the rounding digit is left: the result is zero or one unit.
+      return dd_scale10(x, e) >= 5 ? "1" : "0";
+    else
+      return "0";
+  }
+
+  template<typename CharT, typename Traits>
+    std::basic_ostream<CharT, Traits>&
+    operator<<(std::basic_ostream<CharT, Traits>& os, const DoubleDouble& x)
+    {
+      std::ostringstream str;
+      const auto flags = os.flags();
+      const auto fmt = flags & std::ios_base::floatfield;
+      const bool sci = fmt == std::ios_base::scientific;
+      const bool fix = fmt == std::ios_base::fixed;
+      const bool showpoint = flags & std::ios_base::showpoint;
+      int prec = static_cast<int>(os.precision());
+      if (prec <= 0 && !fix)
+	prec = sci ? 0 : 1;
+
+      if (std::isnan(x.hi()))
+	str << "nan";
+      else if (std::signbit(x.hi()))
+	str << '-';
+      else if (flags & std::ios_base::showpos)
+	str << '+';
+
+      if (std::isnan(x.hi()))
+	;
+      else if (std::isinf(x.hi()))
+	str << "inf";
+      else if (fix)
+	{
+	  // Pad to one integer digit and exactly prec decimals.
+	  auto digs = dd_fixed_digits(x, prec);
+	  if (int(digs.size()) <= prec)
+	    digs.insert(0, prec + 1 - digs.size(), '0');
+	  const auto point = digs.size() - prec;
+	  str << digs.substr(0, point);
+	  if (prec > 0 || showpoint)
+	    str << '.' << digs.substr(point);
+	}
+      else
+	{
+	  std::string digs;
+	  int e = 0;
+	  if (x.hi() != 0.0)
+	    e = dd_to_digits(x, sci ? prec + 1 : prec, digs);
+	  else
+	    digs.assign(sci ? prec + 1 : 1, '0');
+
+	  const bool use_sci = sci
+	    || (x.hi() != 0.0 && (e < -4 || e >= prec));
+	  if (!sci && !showpoint)
+	    {
+	      // General format drops trailing zeros.
+	      const int keep = use_sci ? 1 : std::max(1, e + 1);
+	      while (int(digs.size()) > keep && digs.back() == '0')
+		digs.pop_back();
+	    }
+
+	  if (use_sci)
+	    {
+	      str << digs[0];
+	      if (digs.size() > 1 || showpoint)
+		str << '.' << digs.substr(1);
+	      str << (flags & std::ios_base::uppercase ? 'E' : 'e')
+		  << (e < 0 ? '-' : '+');
+	      const auto ae = std::abs(e);
+	      if (ae < 10)
+		str << '0';
+	      str << ae;
+	    }
+	  else if (x.hi() == 0.0)
+	    {
+	      str << '0';
+	      if (digs.size() > 1 || showpoint)
+		str << '.' << digs.substr(1);
+	    }
+	  else if (e < 0)
+	    {
+	      str << "0." << std::string(-e - 1, '0') << digs;
+	    }
+	  else
+	    {
+	      if (int(digs.size()) <= e + 1)
+		{
+		  digs.append(e + 1 - digs.size(), '0');
+		  str << digs;
+		  if (showpoint)
+		    str << '.';
+		}
+	      else
+		str << digs.substr(0, e + 1) << '.' << digs.substr(e + 1);
+	    }
+	}
+
+      const auto s = str.str();
+      return os << std::basic_string<CharT, Traits>(s.begin(), s.end());
+    }
+
+  template<typename CharT, typename Traits>
+    std::basic_istream<CharT, Traits>&
+    operator>>(std::basic_istream<CharT, Traits>& is, DoubleDouble& x)
+    {
+      typename std::basic_istream<CharT, Traits>::sentry sentry(is);
+      if (!sentry)
+	return is;
+
+      const auto widen = [&is](char c){ return is.widen(c); };
+      const auto peek = [&is]()
+	{ return Traits::to_char_type(is.rdbuf()->sgetc()); };
+      const auto at_end = [&is]()
+	{ return Traits::eq_int_type(is.rdbuf()->sgetc(), Traits::eof()); };
+
+      bool neg = false;
+      if (!at_end() && (peek() == widen('-') || peek() == widen('+')))
+	{
+	  neg = peek() == widen('-');
+	  is.rdbuf()->sbumpc();
+	}
+
+      auto r = DoubleDouble(0.0);
+      int num_digits = 0;
+      int exp10 = 0;
+      bool point = false;
+      while (!at_end())
+	{
+	  const auto c = is.narrow(peek(), '\0');
+	  if (c >= '0' && c <= '9')
+	    {
+	      r = r * 10 + (c - '0');
+	      ++num_digits;
+	      if (point)
+		--exp10;
+	    }
+	  else if (c == '.' && !point)
+	    point = true;
+	  else
+	    break;
+	  is.rdbuf()->sbumpc();
+	}
+      if (num_digits == 0)
+	{
+	  is.setstate(std::ios_base::failbit);
+	  return is;
+	}
+
+      if (!at_end() && (peek() == widen('e') || peek() == widen('E')))
+	{
+	  is.rdbuf()->sbumpc();
+	  bool eneg = false;
+	  if (!at_end() && (peek() == widen('-') || peek() == widen('+')))
+	    {
+	      eneg = peek() == widen('-');
+	      is.rdbuf()->sbumpc();
+	    }
+	  int e = 0;
+	  int num_edigits = 0;
+	  while (!at_end())
+	    {
+	      const auto c = is.narrow(peek(), '\0');
+	      if (c < '0' || c > '9')
+		break;
+	      if (e < 100000)
+		e = 10 * e + (c - '0');
+	      ++num_edigits;
+	      is.rdbuf()->sbumpc();
+	    }
+	  if (num_edigits == 0)
+	    {
+	      is.setstate(std::ios_base::failbit);
+	      return is;
+	    }
+	  exp10 += eneg ? -e : e;
+	}
+      if (at_end())
+	is.setstate(std::ios_base::eofbit);
+
+      if (exp10 > 0)
+	r *= pow(DoubleDouble(10.0), exp10);
+      else if (exp10 < 0)
+	r /= pow(DoubleDouble(10.0), -exp10);
+      x = neg ? -r : r;
+
+      return is;
+    }
+
+} // namespace emsr
+
+#endif // DOUBLE_DOUBLE_TCC
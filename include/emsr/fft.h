@@ -0,0 +1,102 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file fft.h
+ *
+ * This file contains a radix-2 fast Fourier transform and the fast
+ * convolution of coefficient sequences built on it.
+ */
+
+/**
+ * @def  FFT_H
+ *
+ * @brief  A guard for the fast Fourier transform header.
+ */
+#ifndef FFT_H
+#define FFT_H 1
+
+#include <vector>
+#include <complex>
+#include <cstddef>
+
+#include <emsr/polynomial.h> // For real_type_t.
+
+namespace emsr
+{
+
+  /**
+   * The convolution length below which the direct sum is used.
+   */
+  constexpr std::size_t fft_convolve_min = 64;
+
+  /**
+   * Return the smallest power of two not less than n.
+   */
+  inline std::size_t
+  fft_size(std::size_t n)
+  {
+    std::size_t m = 1;
+    while (m < n)
+      m <<= 1;
+    return m;
+  }
+
+  /**
+   * Replace a sequence by its discrete Fourier transform
+   * @f[
+   *    Z_k = \sum_{j=0}^{N-1} z_j e^{-2\pi i jk/N}
+   * @f]
+   * by the iterative radix-2 algorithm.  The twiddle factors are
+   * computed directly rather than by repeated multiplication.
+   *
+   * @throws std::domain_error if the length is not a power of two.
+   */
+  template<typename Real>
+    void
+    fft(std::vector<std::complex<Real>>& z);
+
+  /**
+   * Replace a sequence by its inverse discrete Fourier transform
+   * including the factor 1/N.
+   *
+   * @throws std::domain_error if the length is not a power of two.
+   */
+  template<typename Real>
+    void
+    inverse_fft(std::vector<std::complex<Real>>& z);
+
+  /**
+   * Return the convolution of two coefficient sequences, the coefficients
+   * of the product of the polynomials they represent.  Long sequences are
+   * multiplied by FFT in O(n log n); the error is then relative to the
+   * size of the largest coefficients rather than to each coefficient.
+   */
+  template<typename Tp>
+    std::vector<Tp>
+    convolve(const std::vector<Tp>& a, const std::vector<Tp>& b);
+
+} // namespace emsr
+
+#include <emsr/fft.tcc>
+
+#endif // FFT_H
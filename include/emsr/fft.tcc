@@ -0,0 +1,157 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file fft.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * fast Fourier transform.
+ *
+ * @see fft.h
+ */
+
+/**
+ * @def  FFT_TCC
+ *
+ * @brief  A guard for the fast Fourier transform implementation header.
+ */
+#ifndef FFT_TCC
+#define FFT_TCC 1
+
+#include <cmath>
+#include <algorithm>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+namespace emsr
+{
+
+  /**
+   * Transform in place with the sign of the exponent given.
+   */
+  template<typename Real>
+    void
+    fft_transform(std::vector<std::complex<Real>>& z, int sign)
+    {
+      using Cmplx = std::complex<Real>;
+      const auto s_pi = Real(3.1415926535897932384626433832795029L);
+
+      const auto n = z.size();
+      if (n == 0 || (n & (n - 1)) != 0)
+	throw std::domain_error("fft: Length is not a power of two");
+
+      // Bit reversal permutation.
+      for (std::size_t i = 1, j = 0; i < n; ++i)
+	{
+	  auto bit = n >> 1;
+	  for (; j & bit; bit >>= 1)
+	    j ^= bit;
+	  j ^= bit;
+	  if (i < j)
+	    std::swap(z[i], z[j]);
+	}
+
+      std::vector<Cmplx> w;
+      for (std::size_t len = 2; len <= n; len <<= 1)
+	{
+	  const auto half = len / 2;
+	  w.resize(half);
+	  for (std::size_t k = 0; k < half; ++k)
+	    {
+	      const auto theta = Real(sign) * Real{2} * s_pi * Real(k) / Real(len);
+	      w[k] = Cmplx(std::cos(theta), std::sin(theta));
+	    }
+	  for (std::size_t i = 0; i < n; i += len)
+	    for (std::size_t k = 0; k < half; ++k)
+	      {
+		const auto u = z[i + k];
+		const auto v = z[i + k + half] * w[k];
+		z[i + k] = u + v;
+		z[i + k + half] = u - v;
+	      }
+	}
+    }
+
+  /**
+   * Replace a sequence by its discrete Fourier transform.
+   */
+  template<typename Real>
+    void
+    fft(std::vector<std::complex<Real>>& z)
+    { fft_transform(z, -1); }
+
+  /**
+   * Replace a sequence by its inverse discrete Fourier transform.
+   */
+  template<typename Real>
+    void
+    inverse_fft(std::vector<std::complex<Real>>& z)
+    {
+      fft_transform(z, +1);
+      const auto scale = Real{1} / Real(z.size());
+      for (auto& zz : z)
+	zz *= scale;
+    }
+
+  /**
+   * Return the convolution of two coefficient sequences.
+   */
+  template<typename Tp>
+    std::vector<Tp>
+    convolve(const std::vector<Tp>& a, const std::vector<Tp>& b)
+    {
+      if (a.empty() || b.empty())
+	return {};
+
+      const auto len = a.size() + b.size() - 1;
+      std::vector<Tp> c(len);
+      if (std::min(a.size(), b.size()) < fft_convolve_min)
+	{
+	  for (std::size_t i = 0; i < a.size(); ++i)
+	    for (std::size_t j = 0; j < b.size(); ++j)
+	      c[i + j] += a[i] * b[j];
+	  return c;
+	}
+
+      using Real = real_type_t<Tp>;
+      using Cmplx = std::complex<Real>;
+      const auto n = fft_size(len);
+      std::vector<Cmplx> fa(a.begin(), a.end()), fb(b.begin(), b.end());
+      fa.resize(n);
+      fb.resize(n);
+      fft(fa);
+      fft(fb);
+      for (std::size_t k = 0; k < n; ++k)
+	fa[k] *= fb[k];
+      inverse_fft(fa);
+      for (std::size_t k = 0; k < len; ++k)
+	if constexpr (std::is_same_v<Tp, Cmplx>)
+	  c[k] = fa[k];
+	else
+	  c[k] = std::real(fa[k]);
+      return c;
+    }
+
+} // namespace emsr
+
+#endif // FFT_TCC
@@ -0,0 +1,423 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file gauss_quadrature.h
+ *
+ * This file contains the computation of Gauss quadrature rules
+ * from the three-term recurrences of orthogonal polynomials.
+ */
+
+/**
+ * @def  GAUSS_QUADRATURE_H
+ *
+ * @brief  A guard for the Gauss quadrature header.
+ */
+#ifndef GAUSS_QUADRATURE_H
+#define GAUSS_QUADRATURE_H 1
+
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <limits>
+
+#include <emsr/orthogonal_polynomial.h>
+
+namespace emsr
+{
+
+  /**
+   * A quadrature rule with nodes in increasing order.
+   */
+  template<typename Real>
+    struct QuadratureRule
+    {
+      std::vector<Real> nodes;
+      std::vector<Real> weights;
+
+      /// Return the number of nodes.
+      std::size_t
+      size() const
+      { return this->nodes.size(); }
+
+      /// Return the weighted sum of a function over the nodes.
+      template<typename Func>
+	auto
+	integrate(Func f) const
+	{
+	  decltype(f(Real{})) sum{};
+	  for (std::size_t i = 0; i < this->nodes.size(); ++i)
+	    sum += this->weights[i] * f(this->nodes[i]);
+	  return sum;
+	}
+    };
+
+  /**
+   * The second order differential equation
+   * @f[
+   *    s(x) y'' + t(x) y' + r(x) y = 0
+   * @f]
+   * with quadratic coefficients satisfied by an orthogonal polynomial
+   * or by the polynomial times a nonvanishing factor.
+   * The coefficients are stored low order first.
+   */
+  template<typename Real>
+    struct GaussOde
+    {
+      Real s[3];
+      Real t[3];
+      Real r[3];
+    };
+
+  /**
+   * The properties of a family of orthogonal polynomials needed to build
+   * its Gauss rules.  This is specialized for the recurrences in
+   * orthogonal_polynomial.h.  A specialization is constructed from the
+   * recurrence and provides:
+   *
+   *  - parameters(): the family parameters, used as the cache key;
+   *  - weight_integral(): the integral of the weight function;
+   *  - closed_form(n, rule): fills a rule known in closed form and
+   *    returns true, or returns false;
+   *  - s_march: true if the members below exist.
+   *
+   * For the node march:
+   *  - ode(n): the differential equation satisfied by y = e^{f(x)} P_n(x);
+   *  - log_factor(x): the function f(x);
+   *  - log_weight(x): the logarithm of w_i (y'(x_i))^2 up to a constant;
+   *  - dlog_weight(x): the derivative of log_weight;
+   *  - singular_distance(x): the distance to the nearest singular point
+   *    of the differential equation;
+   *  - guess(n, nodes): a starting point for the next node given those
+   *    found so far in the order of the march;
+   *  - s_descending: true if the march runs from the largest node down.
+   */
+  template<typename Recurrence>
+    struct GaussFamily;
+
+  /**
+   * The Gauss-Jacobi properties shared by the Legendre and Jacobi families.
+   */
+  template<typename Real>
+    struct JacobiGaussFamily
+    {
+      static constexpr bool s_march = true;
+      static constexpr bool s_descending = true;
+
+      Real alpha;
+      Real beta;
+
+      std::vector<Real>
+      parameters() const
+      { return {this->alpha, this->beta}; }
+
+      Real
+      weight_integral() const
+      {
+	const auto ab = this->alpha + this->beta;
+	return std::exp((ab + Real{1}) * std::log(Real{2})
+			+ std::lgamma(this->alpha + Real{1})
+			+ std::lgamma(this->beta + Real{1})
+			- std::lgamma(ab + Real{2}));
+      }
+
+      bool
+      closed_form(unsigned, QuadratureRule<Real>&) const
+      { return false; }
+
+      GaussOde<Real>
+      ode(unsigned n) const
+      {
+	const auto ab = this->alpha + this->beta;
+	return {{Real{1}, Real{0}, Real{-1}},
+		{this->beta - this->alpha, -(ab + Real{2}), Real{0}},
+		{Real(n) * (Real(n) + ab + Real{1}), Real{0}, Real{0}}};
+      }
+
+      Real
+      log_factor(Real) const
+      { return Real{0}; }
+
+      Real
+      log_weight(Real x) const
+      { return -std::log((Real{1} - x) * (Real{1} + x)); }
+
+      Real
+      dlog_weight(Real x) const
+      { return Real{2} * x / ((Real{1} - x) * (Real{1} + x)); }
+
+      Real
+      singular_distance(Real x) const
+      { return Real{1} - std::abs(x); }
+
+      Real
+      guess(unsigned n, const std::vector<Real>& nodes) const;
+    };
+
+  /**
+   * The Gauss-Legendre rules.
+   */
+  template<typename Real>
+    struct GaussFamily<LegendreRecurrence<Real>>
+    : JacobiGaussFamily<Real>
+    {
+      explicit
+      GaussFamily(const LegendreRecurrence<Real>&)
+      : JacobiGaussFamily<Real>{Real{0}, Real{0}}
+      { }
+    };
+
+  /**
+   * The Gauss-Jacobi rules.
+   */
+  template<typename Real>
+    struct GaussFamily<JacobiRecurrence<Real>>
+    : JacobiGaussFamily<Real>
+    {
+      explicit
+      GaussFamily(const JacobiRecurrence<Real>& rec)
+      : JacobiGaussFamily<Real>{rec.alpha, rec.beta}
+      { }
+    };
+
+  /**
+   * The Gauss-Chebyshev rules of the first kind.
+   */
+  template<typename Real>
+    struct GaussFamily<ChebyshevTRecurrence<Real>>
+    {
+      static constexpr bool s_march = false;
+
+      explicit
+      GaussFamily(const ChebyshevTRecurrence<Real>&)
+      { }
+
+      std::vector<Real>
+      parameters() const
+      { return {}; }
+
+      Real
+      weight_integral() const;
+
+      bool
+      closed_form(unsigned n, QuadratureRule<Real>& rule) const;
+    };
+
+  /**
+   * The Gauss-Chebyshev rules of the second kind.
+   */
+  template<typename Real>
+    struct GaussFamily<ChebyshevURecurrence<Real>>
+    {
+      static constexpr bool s_march = false;
+
+      explicit
+      GaussFamily(const ChebyshevURecurrence<Real>&)
+      { }
+
+      std::vector<Real>
+      parameters() const
+      { return {}; }
+
+      Real
+      weight_integral() const;
+
+      bool
+      closed_form(unsigned n, QuadratureRule<Real>& rule) const;
+    };
+
+  /**
+   * The Gauss-Hermite rules.  The march follows the Hermite function
+   * e^{-x^2/2} H_n(x) which stays bounded where H_n overflows.
+   */
+  template<typename Real>
+    struct GaussFamily<HermiteRecurrence<Real>>
+    {
+      static constexpr bool s_march = true;
+      static constexpr bool s_descending = true;
+
+      explicit
+      GaussFamily(const HermiteRecurrence<Real>&)
+      { }
+
+      std::vector<Real>
+      parameters() const
+      { return {}; }
+
+      Real
+      weight_integral() const;
+
+      bool
+      closed_form(unsigned, QuadratureRule<Real>&) const
+      { return false; }
+
+      GaussOde<Real>
+      ode(unsigned n) const
+      {
+	return {{Real{1}, Real{0}, Real{0}},
+		{Real{0}, Real{0}, Real{0}},
+		{Real(2 * n + 1), Real{0}, Real{-1}}};
+      }
+
+      Real
+      log_factor(Real x) const
+      { return -x * x / Real{2}; }
+
+      Real
+      log_weight(Real x) const
+      { return -x * x; }
+
+      Real
+      dlog_weight(Real x) const
+      { return Real{-2} * x; }
+
+      Real
+      singular_distance(Real) const
+      { return std::numeric_limits<Real>::infinity(); }
+
+      Real
+      guess(unsigned n, const std::vector<Real>& nodes) const;
+    };
+
+  /**
+   * The Gauss-Laguerre rules.  The march follows the Laguerre function
+   * x^{(alpha+1)/2} e^{-x/2} L_n^{(alpha)}(x).
+   */
+  template<typename Real>
+    struct GaussFamily<LaguerreRecurrence<Real>>
+    {
+      static constexpr bool s_march = true;
+      static constexpr bool s_descending = false;
+
+      Real alpha;
+
+      explicit
+      GaussFamily(const LaguerreRecurrence<Real>& rec)
+      : alpha(rec.alpha)
+      { }
+
+      std::vector<Real>
+      parameters() const
+      { return {this->alpha}; }
+
+      Real
+      weight_integral() const
+      { return std::tgamma(this->alpha + Real{1}); }
+
+      bool
+      closed_form(unsigned, QuadratureRule<Real>&) const
+      { return false; }
+
+      GaussOde<Real>
+      ode(unsigned n) const
+      {
+	const auto nu = Real(2 * n + 1) + this->alpha;
+	return {{Real{0}, Real{0}, Real{4}},
+		{Real{0}, Real{0}, Real{0}},
+		{Real{1} - this->alpha * this->alpha, Real{2} * nu, Real{-1}}};
+      }
+
+      Real
+      log_factor(Real x) const
+      { return (this->alpha + Real{1}) * std::log(x) / Real{2} - x / Real{2}; }
+
+      Real
+      log_weight(Real x) const
+      { return this->alpha * std::log(x) - x; }
+
+      Real
+      dlog_weight(Real x) const
+      { return this->alpha / x - Real{1}; }
+
+      Real
+      singular_distance(Real x) const
+      { return x; }
+
+      Real
+      guess(unsigned n, const std::vector<Real>& nodes) const;
+    };
+
+  /**
+   * The largest rule computed by the Golub-Welsch algorithm
+   * when a node march is available.
+   */
+  constexpr unsigned gauss_golub_welsch_max = 100;
+
+  /**
+   * Return the Gauss rule with n nodes for the recurrence
+   * by the Golub-Welsch algorithm.
+   *
+   * The nodes are the eigenvalues of the symmetric tridiagonal Jacobi
+   * matrix of the recurrence and the weights are mu_0 times the squares
+   * of the first components of the normalized eigenvectors.
+   * The implicit QL iteration only accumulates the first row of the
+   * eigenvector matrix so the cost is O(n^2).
+   *
+   * @throws std::runtime_error if the QL iteration does not converge.
+   */
+  template<typename Recurrence>
+    QuadratureRule<typename Recurrence::value_type>
+    golub_welsch(unsigned n, const Recurrence& rec,
+		 typename Recurrence::value_type weight_integral);
+
+  /**
+   * Return the Gauss rule with n nodes by marching from node to node.
+   *
+   * This is the method of Glaser, Liu and Rokhlin.  Each node is found by
+   * Newton's method on the Taylor series of the solution about the previous
+   * node.  The Taylor coefficients come from the differential equation
+   * of the family in O(1) each so a rule costs O(n).  The march starts,
+   * and continues wherever the series does not converge quickly near a
+   * singular point, with Newton's method on the recurrence from an
+   * asymptotic or extrapolated guess.  The weights follow from the
+   * derivatives at the nodes and are normalized to the weight integral.
+   *
+   * @throws std::runtime_error if a node cannot be found.
+   */
+  template<typename Recurrence>
+    QuadratureRule<typename Recurrence::value_type>
+    gauss_march(unsigned n, const Recurrence& rec);
+
+  /**
+   * Return the Gauss rule with n nodes for the recurrence.
+   * A closed form is used if there is one.  Otherwise small rules use
+   * golub_welsch and large rules gauss_march.
+   */
+  template<typename Recurrence>
+    QuadratureRule<typename Recurrence::value_type>
+    gauss_quadrature(unsigned n, const Recurrence& rec = Recurrence{});
+
+  /**
+   * Return the Gauss rule with n nodes for the recurrence from a cache
+   * keyed by the family, its parameters and n.
+   * The cache is shared between threads and is guarded by a mutex;
+   * rules are computed outside the lock.
+   */
+  template<typename Recurrence>
+    std::shared_ptr<const QuadratureRule<typename Recurrence::value_type>>
+    gauss_rule(unsigned n, const Recurrence& rec = Recurrence{});
+
+} // namespace emsr
+
+#include <emsr/gauss_quadrature.tcc>
+
+#endif // GAUSS_QUADRATURE_H
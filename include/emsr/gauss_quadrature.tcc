@@ -0,0 +1,659 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file gauss_quadrature.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * Gauss quadrature rules.
+ *
+ * @see gauss_quadrature.h
+ */
+
+/**
+ * @def  GAUSS_QUADRATURE_TCC
+ *
+ * @brief  A guard for the Gauss quadrature implementation header.
+ */
+#ifndef GAUSS_QUADRATURE_TCC
+#define GAUSS_QUADRATURE_TCC 1
+
+#include <algorithm>
+#include <numeric>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <stdexcept>
+
+namespace emsr
+{
+
+  /**
+   * Predict the next zero of a solution of s(x) y'' + t(x) y' + r(x) y = 0
+   * after the zero at x in the given direction.
+   *
+   * The substitution y = exp(-\int t/2s) u gives the normal form
+   * u'' + q u = 0 with
+   * @f[
+   *    q = \frac{4rs - t^2 - 2t's + 2ts'}{4s^2}
+   * @f]
+   * and the same zeros.  In the Prüfer variables u = rho q^{-1/4} sin(theta),
+   * u' = rho q^{1/4} cos(theta) the zeros are at multiples of pi and
+   * @f[
+   *    \frac{dx}{d\theta}
+   *      = \left(\sqrt{q} + \frac{q'}{4q}\sin 2\theta\right)^{-1}.
+   * @f]
+   * This is integrated over a half period with a few Runge-Kutta steps
+   * as in Glaser, Liu and Rokhlin.  A NaN is returned if
+   * q is not positive along the way.
+   */
+  template<typename Real>
+    Real
+    gauss_prufer_guess(const GaussOde<Real>& ode, Real x, int direction)
+    {
+      constexpr int s_num_steps = 8;
+      const auto s_pi = Real(3.1415926535897932384626433832795029L);
+
+      const auto deriv = [&ode](Real x, Real theta)
+	{
+	  const auto nan = std::numeric_limits<Real>::quiet_NaN();
+	  const auto s = ode.s[0] + x * (ode.s[1] + x * ode.s[2]);
+	  const auto ds = ode.s[1] + Real{2} * x * ode.s[2];
+	  const auto d2s = Real{2} * ode.s[2];
+	  const auto t = ode.t[0] + x * (ode.t[1] + x * ode.t[2]);
+	  const auto dt = ode.t[1] + Real{2} * x * ode.t[2];
+	  const auto d2t = Real{2} * ode.t[2];
+	  const auto r = ode.r[0] + x * (ode.r[1] + x * ode.r[2]);
+	  const auto dr = ode.r[1] + Real{2} * x * ode.r[2];
+	  const auto num = Real{4} * r * s - t * t
+			 - Real{2} * dt * s + Real{2} * t * ds;
+	  const auto dnum = Real{4} * (dr * s + r * ds) - Real{2} * t * dt
+			  - Real{2} * d2t * s + Real{2} * t * d2s;
+	  const auto q = num / (Real{4} * s * s);
+	  if (!(q > Real{0}))
+	    return nan;
+	  const auto dq = (dnum * s - Real{2} * num * ds) / (Real{4} * s * s * s);
+	  const auto den = std::sqrt(q)
+			 + dq * std::sin(Real{2} * theta) / (Real{4} * q);
+	  return den > Real{0} ? Real{1} / den : nan;
+	};
+
+      const auto dtheta = Real(direction) * s_pi / Real(s_num_steps);
+      auto theta = Real{0};
+      for (int i = 0; i < s_num_steps; ++i)
+	{
+	  const auto k1 = dtheta * deriv(x, theta);
+	  const auto k2 = dtheta * deriv(x + k1 / Real{2},
+					 theta + dtheta / Real{2});
+	  const auto k3 = dtheta * deriv(x + k2 / Real{2},
+					 theta + dtheta / Real{2});
+	  const auto k4 = dtheta * deriv(x + k3, theta + dtheta);
+	  x += (k1 + Real{2} * (k2 + k3) + k4) / Real{6};
+	  theta += dtheta;
+	}
+      return x;
+    }
+
+  /**
+   * Return the first positive zero of the Bessel function J_alpha
+   * from McMahon's expansion.  This is good to a few percent
+   * for moderate alpha which is enough for a starting point.
+   */
+  template<typename Real>
+    Real
+    gauss_bessel_zero(Real alpha)
+    {
+      const auto s_pi = Real(3.1415926535897932384626433832795029L);
+      const auto mu = Real{4} * alpha * alpha;
+      const auto b8 = Real{8} * (Real{0.75L} + alpha / Real{2}) * s_pi;
+      return b8 / Real{8} - (mu - Real{1}) / b8
+	   - Real{4} * (mu - Real{1}) * (Real{7} * mu - Real{31})
+	     / (Real{3} * b8 * b8 * b8);
+    }
+
+  /**
+   * Return a starting point for the next Gauss-Jacobi node
+   * from the largest down.  The largest node is near cos(j / rho)
+   * where j is the first zero of J_alpha and rho = n + (alpha + beta + 1)/2;
+   * the rest are predicted from the last.
+   */
+  template<typename Real>
+    Real
+    JacobiGaussFamily<Real>::guess(unsigned n,
+				   const std::vector<Real>& nodes) const
+    {
+      const auto rho = Real(n) + (this->alpha + this->beta + Real{1}) / Real{2};
+      if (nodes.empty())
+	return std::cos(gauss_bessel_zero(this->alpha) / rho);
+      return gauss_prufer_guess(this->ode(n), nodes.back(), -1);
+    }
+
+  /**
+   * Return a starting point for the next Gauss-Hermite node
+   * from the largest down.  The largest node is near
+   * sqrt(2n+1) - 2^{-1/3} |a_1| (2n+1)^{-1/6} where a_1 is the first zero
+   * of the Airy function; the rest are predicted from the last.
+   */
+  template<typename Real>
+    Real
+    GaussFamily<HermiteRecurrence<Real>>::guess(unsigned n,
+				const std::vector<Real>& nodes) const
+    {
+      const auto m = Real(2 * n + 1);
+      if (nodes.empty())
+	return std::sqrt(m) - Real{1.8557571883L} * std::pow(m, Real{-1} / Real{6});
+      return gauss_prufer_guess(this->ode(n), nodes.back(), -1);
+    }
+
+  /**
+   * Return a starting point for the next Gauss-Laguerre node
+   * from the smallest up.  The smallest node is near j^2 / (4n + 2alpha + 2)
+   * where j is the first zero of the Bessel function J_alpha;
+   * the rest are predicted from the last.
+   */
+  template<typename Real>
+    Real
+    GaussFamily<LaguerreRecurrence<Real>>::guess(unsigned n,
+				const std::vector<Real>& nodes) const
+    {
+      if (nodes.empty())
+	{
+	  const auto j = gauss_bessel_zero(this->alpha);
+	  return j * j / (Real(4 * n + 2) + Real{2} * this->alpha);
+	}
+      return gauss_prufer_guess(this->ode(n), nodes.back(), +1);
+    }
+
+  /**
+   * Return the integral of the Chebyshev weight of the first kind.
+   */
+  template<typename Real>
+    Real
+    GaussFamily<ChebyshevTRecurrence<Real>>::weight_integral() const
+    { return Real(3.1415926535897932384626433832795029L); }
+
+  /**
+   * Fill the Gauss-Chebyshev rule of the first kind.
+   */
+  template<typename Real>
+    bool
+    GaussFamily<ChebyshevTRecurrence<Real>>::closed_form(unsigned n,
+					QuadratureRule<Real>& rule) const
+    {
+      const auto s_pi = Real(3.1415926535897932384626433832795029L);
+      rule.nodes.resize(n);
+      rule.weights.assign(n, s_pi / Real(n));
+      for (unsigned i = 0; i < n; ++i)
+	rule.nodes[i] = std::cos(s_pi * Real(2 * (n - i) - 1) / Real(2 * n));
+      return true;
+    }
+
+  /**
+   * Return the integral of the Chebyshev weight of the second kind.
+   */
+  template<typename Real>
+    Real
+    GaussFamily<ChebyshevURecurrence<Real>>::weight_integral() const
+    { return Real(3.1415926535897932384626433832795029L) / Real{2}; }
+
+  /**
+   * Fill the Gauss-Chebyshev rule of the second kind.
+   */
+  template<typename Real>
+    bool
+    GaussFamily<ChebyshevURecurrence<Real>>::closed_form(unsigned n,
+					QuadratureRule<Real>& rule) const
+    {
+      const auto s_pi = Real(3.1415926535897932384626433832795029L);
+      rule.nodes.resize(n);
+      rule.weights.resize(n);
+      for (unsigned i = 0; i < n; ++i)
+	{
+	  const auto theta = s_pi * Real(n - i) / Real(n + 1);
+	  const auto s = std::sin(theta);
+	  rule.nodes[i] = std::cos(theta);
+	  rule.weights[i] = s_pi * s * s / Real(n + 1);
+	}
+      return true;
+    }
+
+  /**
+   * Return the integral of the Hermite weight.
+   */
+  template<typename Real>
+    Real
+    GaussFamily<HermiteRecurrence<Real>>::weight_integral() const
+    { return std::sqrt(Real(3.1415926535897932384626433832795029L)); }
+
+  /**
+   * Return the Gauss rule with n nodes by the Golub-Welsch algorithm.
+   */
+  template<typename Recurrence>
+    QuadratureRule<typename Recurrence::value_type>
+    golub_welsch(unsigned n, const Recurrence& rec,
+		 typename Recurrence::value_type weight_integral)
+    {
+      using Real = typename Recurrence::value_type;
+      const auto eps = std::numeric_limits<Real>::epsilon();
+
+      QuadratureRule<Real> rule;
+      if (n == 0)
+	return rule;
+
+      // The Jacobi matrix: P_{k+1} = (a_k x + b_k) P_k - c_k P_{k-1}
+      // has diagonal -b_k/a_k and off-diagonal sqrt(c_{k+1}/(a_k a_{k+1})).
+      std::vector<Real> d(n), e(n), z(n);
+      auto abc = rec(0);
+      for (unsigned k = 0; k < n; ++k)
+	{
+	  d[k] = -abc.b / abc.a;
+	  const auto abc1 = rec(k + 1);
+	  if (k + 1 < n)
+	    e[k] = std::sqrt(abc1.c / (abc.a * abc1.a));
+	  abc = abc1;
+	}
+      e[n - 1] = Real{0};
+      z[0] = Real{1};
+
+      // The implicit QL iteration with the rotations applied
+      // to the first row of the eigenvector matrix.
+      const int nn = n;
+      for (int l = 0; l < nn; ++l)
+	{
+	  int iter = 0;
+	  int m;
+	  do
+	    {
+	      for (m = l; m < nn - 1; ++m)
+		{
+		  const auto dd = std::abs(d[m]) + std::abs(d[m + 1]);
+		  if (std::abs(e[m]) <= eps * dd)
+		    break;
+		}
+	      if (m != l)
+		{
+		  if (iter++ == 60)
+		    throw std::runtime_error("golub_welsch: "
+					     "QL iteration did not converge");
+		  auto g = (d[l + 1] - d[l]) / (Real{2} * e[l]);
+		  auto r = std::hypot(g, Real{1});
+		  g = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+		  auto s = Real{1}, c = Real{1}, p = Real{0};
+		  int i;
+		  for (i = m - 1; i >= l; --i)
+		    {
+		      auto f = s * e[i];
+		      const auto b = c * e[i];
+		      e[i + 1] = (r = std::hypot(f, g));
+		      if (r == Real{0})
+			{
+			  d[i + 1] -= p;
+			  e[m] = Real{0};
+			  break;
+			}
+		      s = f / r;
+		      c = g / r;
+		      g = d[i + 1] - p;
+		      r = (d[i] - g) * s + Real{2} * c * b;
+		      p = s * r;
+		      d[i + 1] = g + p;
+		      g = c * r - b;
+		      f = z[i + 1];
+		      z[i + 1] = s * z[i] + c * f;
+		      z[i] = c * z[i] - s * f;
+		    }
+		  if (r == Real{0} && i >= l)
+		    continue;
+		  d[l] -= p;
+		  e[l] = g;
+		  e[m] = Real{0};
+		}
+	    }
+	  while (m != l);
+	}
+
+      std::vector<unsigned> order(n);
+      std::iota(order.begin(), order.end(), 0u);
+      std::sort(order.begin(), order.end(),
+		[&d](unsigned i, unsigned j) { return d[i] < d[j]; });
+      rule.nodes.resize(n);
+      rule.weights.resize(n);
+      for (unsigned i = 0; i < n; ++i)
+	{
+	  rule.nodes[i] = d[order[i]];
+	  rule.weights[i] = weight_integral * z[order[i]] * z[order[i]];
+	}
+      return rule;
+    }
+
+  /**
+   * A zero of an orthogonal polynomial, the Newton correction that remains
+   * and the logarithm and sign of the derivative there.
+   */
+  template<typename Real>
+    struct GaussNewtonResult
+    {
+      Real x;
+      Real correction;
+      Real log_deriv;
+      int sign_deriv;
+      bool converged;
+    };
+
+  /**
+   * Find a zero of an orthogonal polynomial by Newton's method on the
+   * recurrence.  The recurrence is rescaled by powers of the radix
+   * as it grows so that very large values do not overflow.
+   */
+  template<typename Recurrence>
+    GaussNewtonResult<typename Recurrence::value_type>
+    gauss_recurrence_newton(const OrthogonalPolynomial<Recurrence>& poly,
+			    typename Recurrence::value_type x,
+			    int max_iter = 100)
+    {
+      using Real = typename Recurrence::value_type;
+      const auto eps = std::numeric_limits<Real>::epsilon();
+      const int shift = std::numeric_limits<Real>::max_exponent / 2;
+      const auto big = std::ldexp(Real{1}, shift);
+
+      // Return P_n(x) and P_n'(x) scaled by 2^{-scale}.
+      const auto eval = [&poly, shift, big](Real x, Real& dp, long& scale)
+	{
+	  auto pm1 = Real{0}, p = Real{1};
+	  auto dpm1 = Real{0};
+	  dp = Real{0};
+	  scale = 0;
+	  for (unsigned k = 0; k < poly.degree(); ++k)
+	    {
+	      const auto abc = poly.coefficients(k);
+	      const auto t = abc.a * x + abc.b;
+	      const auto dpp1 = abc.a * p + t * dp - abc.c * dpm1;
+	      const auto pp1 = t * p - abc.c * pm1;
+	      dpm1 = dp;
+	      dp = dpp1;
+	      pm1 = p;
+	      p = pp1;
+	      if (std::abs(p) > big || std::abs(dp) > big)
+		{
+		  p = std::ldexp(p, -shift);
+		  pm1 = std::ldexp(pm1, -shift);
+		  dp = std::ldexp(dp, -shift);
+		  dpm1 = std::ldexp(dpm1, -shift);
+		  scale += shift;
+		}
+	    }
+	  return p;
+	};
+
+      Real dp;
+      long scale;
+      auto dx_prev = std::numeric_limits<Real>::infinity();
+      for (int iter = 0; iter < max_iter; ++iter)
+	{
+	  const auto p = eval(x, dp, scale);
+	  if (dp == Real{0})
+	    break;
+	  const auto dx = p / dp;
+	  x -= dx;
+	  // Stop at the tolerance or when the steps stop shrinking
+	  // because the recurrence has reached its rounding level.
+	  if (std::abs(dx) <= Real{4} * eps * std::abs(x)
+	      || (std::abs(dx) > std::abs(dx_prev) / Real{2}
+		  && std::abs(dx_prev) <= std::sqrt(eps) * std::abs(x)))
+	    {
+	      // The derivative is sensitive to x near the ends of the
+	      // interval so it is taken at the final node.
+	      const auto p = eval(x, dp, scale);
+	      return {x, p / dp,
+		      std::log(std::abs(dp)) + Real(scale) * std::log(Real{2}),
+		      dp < Real{0} ? -1 : 1, true};
+	    }
+	  dx_prev = dx;
+	}
+      return {x, Real{0}, Real{0}, 1, false};
+    }
+
+  /**
+   * Take one step of the node march.  The solution of the differential
+   * equation with y(x) = y0 and y'(x) = y1 is expanded in a Taylor series
+   * about x and Newton's method finds its zero near the target.
+   * On success x, y0 and y1 are replaced by the new node and the values
+   * there and true is returned.  False is returned if the series does
+   * not converge quickly or the zero is not in the range of the step.
+   */
+  template<typename Real>
+    bool
+    gauss_taylor_step(const GaussOde<Real>& ode, Real& x, Real& y0, Real& y1,
+		      Real target, Real singular_distance)
+    {
+      constexpr int s_max_terms = 80;
+      // The series is expanded over a step past the target
+      // so that the zero is inside the unit interval of tau.
+      const auto s_overshoot = Real{1.5L};
+      const auto eps = std::numeric_limits<Real>::epsilon();
+
+      const auto h = s_overshoot * (target - x);
+      if (h == Real{0} || !(std::abs(h) < singular_distance / Real{2}))
+	return false;
+
+      const auto quad = [x](const Real* c)
+	{ return c[0] + x * (c[1] + x * c[2]); };
+      const auto dquad = [x](const Real* c)
+	{ return c[1] + Real{2} * x * c[2]; };
+      const auto S0 = quad(ode.s), S1 = dquad(ode.s) * h,
+		 S2 = ode.s[2] * h * h;
+      const auto T0 = quad(ode.t) * h, T1 = dquad(ode.t) * h * h,
+		 T2 = ode.t[2] * h * h * h;
+      const auto R0 = quad(ode.r) * h * h, R1 = dquad(ode.r) * h * h * h,
+		 R2 = ode.r[2] * h * h * h * h;
+      if (S0 == Real{0})
+	return false;
+
+      // The scaled Taylor coefficients b_k = y^{(k)}(x) h^k / k!.
+      Real b[s_max_terms];
+      b[0] = y0;
+      b[1] = y1 * h;
+      const auto scale = std::abs(b[0]) + std::abs(b[1]);
+      auto bmax = scale;
+      int num_terms = 0;
+      for (int k = 0; k + 2 < s_max_terms; ++k)
+	{
+	  const auto kk = Real(k);
+	  auto sum = (S1 * (kk + Real{1}) * kk + T0 * (kk + Real{1})) * b[k + 1]
+		   + (S2 * kk * (kk - Real{1}) + T1 * kk + R0) * b[k];
+	  if (k >= 1)
+	    sum += (T2 * (kk - Real{1}) + R1) * b[k - 1];
+	  if (k >= 2)
+	    sum += R2 * b[k - 2];
+	  b[k + 2] = -sum / (S0 * (kk + Real{2}) * (kk + Real{1}));
+	  bmax = std::max(bmax, std::abs(b[k + 2]));
+	  if (std::abs(b[k + 2]) + std::abs(b[k + 1]) <= eps * scale / Real{4})
+	    {
+	      num_terms = k + 3;
+	      break;
+	    }
+	}
+      if (num_terms == 0 || bmax > Real{1024} * scale)
+	return false;
+
+      const auto eval = [&b, num_terms](Real tau, Real& dy)
+	{
+	  auto y = b[num_terms - 1];
+	  dy = Real{0};
+	  for (int k = num_terms - 1; k-- > 0;)
+	    {
+	      dy = dy * tau + y;
+	      y = y * tau + b[k];
+	    }
+	  return y;
+	};
+
+      auto tau = Real{1} / s_overshoot;
+      bool converged = false;
+      Real dy;
+      for (int iter = 0; iter < 20; ++iter)
+	{
+	  const auto y = eval(tau, dy);
+	  if (dy == Real{0})
+	    break;
+	  const auto dtau = y / dy;
+	  tau -= dtau;
+	  if (std::abs(dtau) <= Real{4} * eps * std::abs(tau))
+	    {
+	      converged = true;
+	      break;
+	    }
+	}
+      if (!converged || !(tau > Real{0.2L} && tau <= Real{1}))
+	return false;
+
+      x += tau * h;
+      y0 = eval(tau, dy);
+      y1 = dy / h;
+      return true;
+    }
+
+  /**
+   * Return the Gauss rule with n nodes by marching from node to node.
+   */
+  template<typename Recurrence>
+    QuadratureRule<typename Recurrence::value_type>
+    gauss_march(unsigned n, const Recurrence& rec)
+    {
+      using Real = typename Recurrence::value_type;
+      using Family = GaussFamily<Recurrence>;
+
+      QuadratureRule<Real> rule;
+      if (n == 0)
+	return rule;
+
+      const Family fam(rec);
+      const OrthogonalPolynomial<Recurrence> poly(n, rec);
+      const auto ode = fam.ode(n);
+
+      auto& nodes = rule.nodes;
+      auto& weights = rule.weights;
+      nodes.reserve(n);
+      weights.reserve(n);
+      auto x = Real{0}, y0 = Real{0}, y1 = Real{0};
+      // The solution is carried relative to its derivative at the first node
+      // since the values themselves may overflow.
+      auto log_scale = Real{0};
+      for (unsigned k = 0; k < n; ++k)
+	{
+	  const auto target = fam.guess(n, nodes);
+	  if (k == 0 || !gauss_taylor_step(ode, x, y0, y1, target,
+					   fam.singular_distance(x)))
+	    {
+	      const auto zero = gauss_recurrence_newton(poly, target);
+	      if (!zero.converged)
+		throw std::runtime_error("gauss_march: Newton's method failed");
+	      x = zero.x;
+	      const auto log_deriv = zero.log_deriv + fam.log_factor(x);
+	      if (k == 0)
+		log_scale = log_deriv;
+	      y1 = Real(zero.sign_deriv) * std::exp(log_deriv - log_scale);
+	      y0 = zero.correction * y1;
+	    }
+	  if (k > 0 && (Family::s_descending ? !(x < nodes.back())
+					     : !(x > nodes.back())))
+	    throw std::runtime_error("gauss_march: Nodes out of order");
+	  nodes.push_back(x);
+	  // Store the log weights for now.  The weight is sensitive to the
+	  // position of the node near a singular point so it is corrected
+	  // to first order for the residual: at a zero y'' = -(t/s) y'.
+	  const auto s = ode.s[0] + x * (ode.s[1] + x * ode.s[2]);
+	  const auto t = ode.t[0] + x * (ode.t[1] + x * ode.t[2]);
+	  const auto dx = -y0 / y1;
+	  weights.push_back(fam.log_weight(x) - Real{2} * std::log(std::abs(y1))
+			    + (fam.dlog_weight(x) + Real{2} * t / s) * dx);
+	}
+
+      const auto log_max = *std::max_element(weights.begin(), weights.end());
+      auto sum = Real{0};
+      for (auto& w : weights)
+	{
+	  w = std::exp(w - log_max);
+	  sum += w;
+	}
+      const auto norm = fam.weight_integral() / sum;
+      for (auto& w : weights)
+	w *= norm;
+
+      if (Family::s_descending)
+	{
+	  std::reverse(nodes.begin(), nodes.end());
+	  std::reverse(weights.begin(), weights.end());
+	}
+      return rule;
+    }
+
+  /**
+   * Return the Gauss rule with n nodes for the recurrence.
+   */
+  template<typename Recurrence>
+    QuadratureRule<typename Recurrence::value_type>
+    gauss_quadrature(unsigned n, const Recurrence& rec)
+    {
+      using Family = GaussFamily<Recurrence>;
+
+      const Family fam(rec);
+      QuadratureRule<typename Recurrence::value_type> rule;
+      if (n == 0 || fam.closed_form(n, rule))
+	return rule;
+      if constexpr (Family::s_march)
+	if (n > gauss_golub_welsch_max)
+	  return gauss_march(n, rec);
+      return golub_welsch(n, rec, fam.weight_integral());
+    }
+
+  /**
+   * Return the Gauss rule with n nodes for the recurrence from a cache.
+   */
+  template<typename Recurrence>
+    std::shared_ptr<const QuadratureRule<typename Recurrence::value_type>>
+    gauss_rule(unsigned n, const Recurrence& rec)
+    {
+      using Real = typename Recurrence::value_type;
+      using Rule = QuadratureRule<Real>;
+      using Key = std::pair<std::vector<Real>, unsigned>;
+
+      // One cache for each family.
+      static std::mutex s_mutex;
+      static std::map<Key, std::shared_ptr<const Rule>> s_cache;
+
+      Key key{GaussFamily<Recurrence>(rec).parameters(), n};
+      {
+	std::lock_guard<std::mutex> lock(s_mutex);
+	const auto it = s_cache.find(key);
+	if (it != s_cache.end())
+	  return it->second;
+      }
+
+      auto rule = std::make_shared<const Rule>(gauss_quadrature(n, rec));
+      std::lock_guard<std::mutex> lock(s_mutex);
+      return s_cache.emplace(std::move(key), std::move(rule)).first->second;
+    }
+
+} // namespace emsr
+
+#endif // GAUSS_QUADRATURE_TCC
@@ -0,0 +1,459 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file multi_polynomial.h
+ *
+ * This file contains a sparse multivariate polynomial class
+ * with packed monomial exponents.
+ */
+
+/**
+ * @def  MULTI_POLYNOMIAL_H
+ *
+ * @brief  A guard for the multivariate polynomial header.
+ */
+#ifndef MULTI_POLYNOMIAL_H
+#define MULTI_POLYNOMIAL_H 1
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <utility> // For pair.
+#include <initializer_list>
+#include <iosfwd>
+
+#include <emsr/polynomial.h> // For real_type_t.
+
+namespace emsr
+{
+
+  /**
+   * @brief A sparse polynomial in NVars variables:
+   * @f[
+   *    P(x) = \sum_k a_k x_0^{e_{k0}} x_1^{e_{k1}} ... x_{NVars-1}^{e_{k,NVars-1}}
+   * @f]
+   *
+   * Each monomial is packed into one 64-bit word of NVars + 1 fields:
+   * the total degree in the most significant field followed by the
+   * exponents of x_0, x_1, ... in decreasing significance.
+   * Integer comparison of the words is then the graded lexicographic
+   * order and the product of two monomials is the sum of their words.
+   * The top bit of each field is a guard which is set when a product
+   * overflows a field.
+   *
+   * The terms are kept in increasing graded lexicographic order with no
+   * zero coefficients; the zero polynomial has no terms.
+   */
+  template<typename Tp, std::size_t NVars>
+    class MultiPolynomial
+    {
+      static_assert(NVars >= 1 && NVars <= 15,
+		    "MultiPolynomial: Between 1 and 15 variables");
+
+    public:
+      /**
+       * Typedefs.
+       */
+      using value_type = Tp;
+      using size_type = std::size_t;
+      using real_type = real_type_t<Tp>;
+      using monomial_type = std::uint64_t;
+      using exponents_type = std::array<unsigned, NVars>;
+      using point_type = std::array<value_type, NVars>;
+      using term_type = std::pair<exponents_type, value_type>;
+
+      /**
+       * The number of variables.
+       */
+      static constexpr size_type s_num_vars = NVars;
+
+      /**
+       * The width of each field of a packed monomial.
+       */
+      static constexpr unsigned s_field_bits = 64 / (NVars + 1);
+
+      /**
+       * The largest total degree of a monomial.
+       */
+      static constexpr unsigned s_max_degree
+	= (1u << (s_field_bits - 1)) - 1;
+
+      /**
+       * The number of points evaluated together by the range evaluator.
+       */
+      static constexpr size_type s_lanes = 8;
+
+      /**
+       * Return the packed monomial for an array of exponents.
+       *
+       * @throws std::domain_error if the total degree exceeds s_max_degree.
+       */
+      static monomial_type
+      pack(const exponents_type& expon);
+
+      /**
+       * Return the array of exponents of a packed monomial.
+       */
+      static exponents_type
+      unpack(monomial_type mono) noexcept
+      {
+	exponents_type expon;
+	for (size_type k = 0; k < NVars; ++k)
+	  expon[k] = (mono >> s_shift(k)) & s_field_mask;
+	return expon;
+      }
+
+      /**
+       * Return the total degree of a packed monomial.
+       */
+      static unsigned
+      total_degree(monomial_type mono) noexcept
+      { return mono >> s_degree_shift; }
+
+      /**
+       * Create the zero polynomial.
+       */
+      MultiPolynomial() = default;
+
+      /**
+       * Create a monomial.
+       */
+      explicit
+      MultiPolynomial(value_type a, const exponents_type& expon = {})
+      {
+	if (a != value_type{})
+	  {
+	    this->m_mono.push_back(pack(expon));
+	    this->m_coeff.push_back(a);
+	  }
+      }
+
+      /**
+       * Create a polynomial from an initializer list of
+       * (exponents, coefficient) terms in any order.
+       * Terms with equal exponents are added.
+       */
+      MultiPolynomial(std::initializer_list<term_type> ila)
+      : MultiPolynomial(ila.begin(), ila.end())
+      { }
+
+      /**
+       * Create a polynomial from an input iterator range of
+       * (exponents, coefficient) terms in any order.
+       * Terms with equal exponents are added.
+       */
+      template<typename InIter,
+	       typename = std::_RequireInputIter<InIter>>
+	MultiPolynomial(InIter tbegin, InIter tend);
+
+      /**
+       * Return the polynomial x_k.
+       */
+      static MultiPolynomial
+      variable(size_type k)
+      {
+	exponents_type expon{};
+	expon[k] = 1;
+	return MultiPolynomial(value_type{1}, expon);
+      }
+
+      /**
+       * Return the number of nonzero terms.
+       */
+      size_type
+      num_terms() const noexcept
+      { return this->m_coeff.size(); }
+
+      /**
+       * Return true if this is the zero polynomial.
+       */
+      bool
+      empty() const noexcept
+      { return this->m_coeff.empty(); }
+
+      /**
+       * Return the total degree or zero for the zero polynomial.
+       */
+      unsigned
+      degree() const noexcept
+      { return this->empty() ? 0u : total_degree(this->m_mono.back()); }
+
+      /**
+       * Return the packed monomial of term @c i.
+       */
+      monomial_type
+      monomial(size_type i) const noexcept
+      { return this->m_mono[i]; }
+
+      /**
+       * Return the exponents of term @c i.
+       */
+      exponents_type
+      exponents(size_type i) const noexcept
+      { return unpack(this->m_mono[i]); }
+
+      /**
+       * Return the coefficient of term @c i.
+       */
+      value_type
+      term_coefficient(size_type i) const noexcept
+      { return this->m_coeff[i]; }
+
+      /**
+       * Return the coefficient of a monomial, which may be zero.
+       * This is a binary search.
+       */
+      value_type
+      coefficient(const exponents_type& expon) const;
+
+      /**
+       * Evaluate the polynomial at a point.
+       */
+      value_type
+      operator()(const point_type& x) const
+      {
+	value_type r;
+	this->template m_eval_lanes<1>(this->m_max_exponents(), &x, &r);
+	return r;
+      }
+
+      /**
+       * Evaluate the polynomial at a range of points.
+       * The points are processed in blocks of s_lanes.  For each block
+       * a table of the powers of the coordinates is built and the terms
+       * are then accumulated for all points of the block together.
+       * The next available output iterator is returned.
+       */
+      template<typename InIter, typename OutIter,
+	       typename = std::_RequireInputIter<InIter>>
+	OutIter
+	operator()(InIter xbegin, InIter xend, OutIter rbegin) const;
+
+      /**
+       * Return the partial derivative with respect to x_k.
+       * Subtracting the same packed monomial from each word keeps the
+       * terms in order so no sorting is needed.
+       */
+      MultiPolynomial
+      derivative(size_type k) const;
+
+      /**
+       * Unary plus.
+       */
+      MultiPolynomial
+      operator+() const
+      { return *this; }
+
+      /**
+       * Unary minus.
+       */
+      MultiPolynomial
+      operator-() const
+      {
+	auto poly = *this;
+	for (auto& a : poly.m_coeff)
+	  a = -a;
+	return poly;
+      }
+
+      /**
+       * Add a scalar to the polynomial.
+       */
+      MultiPolynomial&
+      operator+=(const value_type& x)
+      { return *this += MultiPolynomial(x); }
+
+      /**
+       * Subtract a scalar from the polynomial.
+       */
+      MultiPolynomial&
+      operator-=(const value_type& x)
+      { return *this -= MultiPolynomial(x); }
+
+      /**
+       * Multiply the polynomial by a scalar.
+       */
+      MultiPolynomial&
+      operator*=(const value_type& c)
+      {
+	if (c == value_type{})
+	  {
+	    this->m_mono.clear();
+	    this->m_coeff.clear();
+	  }
+	else
+	  for (auto& a : this->m_coeff)
+	    a *= c;
+	return *this;
+      }
+
+      /**
+       * Divide the polynomial by a scalar.
+       */
+      MultiPolynomial&
+      operator/=(const value_type& c)
+      {
+	for (auto& a : this->m_coeff)
+	  a /= c;
+	return *this;
+      }
+
+      /**
+       * Add another polynomial to the polynomial by merging the terms.
+       */
+      MultiPolynomial&
+      operator+=(const MultiPolynomial& poly)
+      {
+	*this = m_merge(*this, poly, value_type{1});
+	return *this;
+      }
+
+      /**
+       * Subtract another polynomial from the polynomial
+       * by merging the terms.
+       */
+      MultiPolynomial&
+      operator-=(const MultiPolynomial& poly)
+      {
+	*this = m_merge(*this, poly, value_type{-1});
+	return *this;
+      }
+
+      /**
+       * Multiply the polynomial by another polynomial.
+       *
+       * This is Johnson's heap method as for SparsePolynomial with
+       * the packed monomials as keys: a product of monomials is one
+       * integer addition, an order comparison is one integer comparison
+       * and an overflow check is one mask.
+       *
+       * @throws std::overflow_error if a product exceeds s_max_degree.
+       */
+      MultiPolynomial&
+      operator*=(const MultiPolynomial& poly);
+
+      friend bool
+      operator==(const MultiPolynomial& pa, const MultiPolynomial& pb)
+      { return pa.m_mono == pb.m_mono && pa.m_coeff == pb.m_coeff; }
+
+      friend bool
+      operator!=(const MultiPolynomial& pa, const MultiPolynomial& pb)
+      { return !(pa == pb); }
+
+    private:
+
+      /// The position of the exponent field of x_k.
+      static constexpr unsigned
+      s_shift(size_type k) noexcept
+      { return (NVars - 1 - k) * s_field_bits; }
+
+      /// The position of the total degree field.
+      static constexpr unsigned s_degree_shift = NVars * s_field_bits;
+
+      static constexpr monomial_type s_field_mask
+	= (monomial_type{1} << s_field_bits) - 1;
+
+      /// The guard bits at the top of every field.
+      static constexpr monomial_type
+      s_guard_mask() noexcept
+      {
+	monomial_type mask = 0;
+	for (size_type f = 0; f <= NVars; ++f)
+	  mask |= monomial_type{1} << ((f + 1) * s_field_bits - 1);
+	return mask;
+      }
+
+      exponents_type
+      m_max_exponents() const noexcept;
+
+      template<size_type Lanes>
+	void
+	m_eval_lanes(const exponents_type& max_expon,
+		     const point_type* x, value_type* r) const;
+
+      static MultiPolynomial
+      m_merge(const MultiPolynomial& pa, const MultiPolynomial& pb,
+	      value_type sign);
+
+      std::vector<monomial_type> m_mono;
+      std::vector<value_type> m_coeff;
+    };
+
+  /**
+   * Return the sum of two multivariate polynomials.
+   */
+  template<typename Tp, std::size_t NVars>
+    inline MultiPolynomial<Tp, NVars>
+    operator+(const MultiPolynomial<Tp, NVars>& pa,
+	      const MultiPolynomial<Tp, NVars>& pb)
+    { return MultiPolynomial<Tp, NVars>(pa) += pb; }
+
+  /**
+   * Return the difference of two multivariate polynomials.
+   */
+  template<typename Tp, std::size_t NVars>
+    inline MultiPolynomial<Tp, NVars>
+    operator-(const MultiPolynomial<Tp, NVars>& pa,
+	      const MultiPolynomial<Tp, NVars>& pb)
+    { return MultiPolynomial<Tp, NVars>(pa) -= pb; }
+
+  /**
+   * Return the product of two multivariate polynomials.
+   */
+  template<typename Tp, std::size_t NVars>
+    inline MultiPolynomial<Tp, NVars>
+    operator*(const MultiPolynomial<Tp, NVars>& pa,
+	      const MultiPolynomial<Tp, NVars>& pb)
+    { return MultiPolynomial<Tp, NVars>(pa) *= pb; }
+
+  /**
+   * Return the product of a multivariate polynomial with a scalar.
+   */
+  template<typename Tp, std::size_t NVars>
+    inline MultiPolynomial<Tp, NVars>
+    operator*(const MultiPolynomial<Tp, NVars>& poly, const Tp& x)
+    { return MultiPolynomial<Tp, NVars>(poly) *= x; }
+
+  /**
+   * Return the product of a scalar with a multivariate polynomial.
+   */
+  template<typename Tp, std::size_t NVars>
+    inline MultiPolynomial<Tp, NVars>
+    operator*(const Tp& x, const MultiPolynomial<Tp, NVars>& poly)
+    { return MultiPolynomial<Tp, NVars>(poly) *= x; }
+
+  /**
+   * Write a multivariate polynomial to a stream.
+   * The format is a parenthesized comma-delimited list of
+   * (coefficient,(exponents)) terms.
+   */
+  template<typename CharT, typename Traits, typename Tp, std::size_t NVars>
+    std::basic_ostream<CharT, Traits>&
+    operator<<(std::basic_ostream<CharT, Traits>& os,
+	       const MultiPolynomial<Tp, NVars>& poly);
+
+} // namespace emsr
+
+#include <emsr/multi_polynomial.tcc>
+
+#endif // MULTI_POLYNOMIAL_H
@@ -0,0 +1,406 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file multi_polynomial.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * multivariate polynomial class.
+ *
+ * @see multi_polynomial.h
+ */
+
+/**
+ * @def  MULTI_POLYNOMIAL_TCC
+ *
+ * @brief  A guard for the multivariate polynomial implementation header.
+ */
+#ifndef MULTI_POLYNOMIAL_TCC
+#define MULTI_POLYNOMIAL_TCC 1
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <ostream>
+
+namespace emsr
+{
+
+  /**
+   * Return the packed monomial for an array of exponents.
+   */
+  template<typename Tp, std::size_t NVars>
+    typename MultiPolynomial<Tp, NVars>::monomial_type
+    MultiPolynomial<Tp, NVars>::pack(const exponents_type& expon)
+    {
+      unsigned long long deg = 0;
+      for (auto e : expon)
+	deg += e;
+      if (deg > s_max_degree)
+	throw std::domain_error("MultiPolynomial::pack: "
+				"Total degree too large");
+      auto mono = monomial_type(deg) << s_degree_shift;
+      for (size_type k = 0; k < NVars; ++k)
+	mono |= monomial_type(expon[k]) << s_shift(k);
+      return mono;
+    }
+
+  /**
+   * Create a polynomial from a range of terms in any order.
+   */
+  template<typename Tp, std::size_t NVars>
+    template<typename InIter, typename>
+      MultiPolynomial<Tp, NVars>::MultiPolynomial(InIter tbegin, InIter tend)
+      {
+	std::vector<std::pair<monomial_type, value_type>> terms;
+	for (; tbegin != tend; ++tbegin)
+	  terms.emplace_back(pack(tbegin->first), tbegin->second);
+	std::stable_sort(terms.begin(), terms.end(),
+			 [](const auto& x, const auto& y)
+			 { return x.first < y.first; });
+	this->m_mono.reserve(terms.size());
+	this->m_coeff.reserve(terms.size());
+	for (std::size_t k = 0; k < terms.size();)
+	  {
+	    const auto mono = terms[k].first;
+	    auto a = terms[k].second;
+	    for (++k; k < terms.size() && terms[k].first == mono; ++k)
+	      a += terms[k].second;
+	    if (a != value_type{})
+	      {
+		this->m_mono.push_back(mono);
+		this->m_coeff.push_back(a);
+	      }
+	  }
+      }
+
+  /**
+   * Return the coefficient of a monomial.
+   */
+  template<typename Tp, std::size_t NVars>
+    typename MultiPolynomial<Tp, NVars>::value_type
+    MultiPolynomial<Tp, NVars>::coefficient(const exponents_type& expon) const
+    {
+      const auto mono = pack(expon);
+      const auto it = std::lower_bound(this->m_mono.begin(),
+				       this->m_mono.end(), mono);
+      if (it == this->m_mono.end() || *it != mono)
+	return value_type{};
+      return this->m_coeff[it - this->m_mono.begin()];
+    }
+
+  /**
+   * Return the largest exponent of each variable.
+   */
+  template<typename Tp, std::size_t NVars>
+    typename MultiPolynomial<Tp, NVars>::exponents_type
+    MultiPolynomial<Tp, NVars>::m_max_exponents() const noexcept
+    {
+      exponents_type max_expon{};
+      for (const auto mono : this->m_mono)
+	{
+	  const auto expon = unpack(mono);
+	  for (size_type k = 0; k < NVars; ++k)
+	    max_expon[k] = std::max(max_expon[k], expon[k]);
+	}
+      return max_expon;
+    }
+
+  /**
+   * Evaluate the polynomial at a block of points.
+   * The powers x_k^e of lane l are at pw[(off_k + e) * Lanes + l].
+   */
+  template<typename Tp, std::size_t NVars>
+    template<typename MultiPolynomial<Tp, NVars>::size_type Lanes>
+      void
+      MultiPolynomial<Tp, NVars>::m_eval_lanes(const exponents_type& max_expon,
+					       const point_type* x,
+					       value_type* r) const
+      {
+	std::array<size_type, NVars> off;
+	size_type len = 0;
+	for (size_type k = 0; k < NVars; ++k)
+	  {
+	    off[k] = len;
+	    len += max_expon[k] + 1;
+	  }
+	std::vector<value_type> pw(len * Lanes);
+	for (size_type k = 0; k < NVars; ++k)
+	  {
+	    auto* p = pw.data() + off[k] * Lanes;
+	    for (size_type l = 0; l < Lanes; ++l)
+	      p[l] = value_type{1};
+	    for (unsigned e = 1; e <= max_expon[k]; ++e)
+	      for (size_type l = 0; l < Lanes; ++l)
+		p[e * Lanes + l] = p[(e - 1) * Lanes + l] * x[l][k];
+	  }
+
+	value_type acc[Lanes], t[Lanes];
+	for (size_type l = 0; l < Lanes; ++l)
+	  acc[l] = value_type{};
+	for (size_type i = 0; i < this->num_terms(); ++i)
+	  {
+	    const auto expon = unpack(this->m_mono[i]);
+	    for (size_type l = 0; l < Lanes; ++l)
+	      t[l] = this->m_coeff[i];
+	    for (size_type k = 0; k < NVars; ++k)
+	      {
+		const auto* p = pw.data() + (off[k] + expon[k]) * Lanes;
+		for (size_type l = 0; l < Lanes; ++l)
+		  t[l] *= p[l];
+	      }
+	    for (size_type l = 0; l < Lanes; ++l)
+	      acc[l] += t[l];
+	  }
+	for (size_type l = 0; l < Lanes; ++l)
+	  r[l] = acc[l];
+      }
+
+  /**
+   * Evaluate the polynomial at a range of points.
+   */
+  template<typename Tp, std::size_t NVars>
+    template<typename InIter, typename OutIter, typename>
+      OutIter
+      MultiPolynomial<Tp, NVars>::operator()(InIter xbegin, InIter xend,
+					     OutIter rbegin) const
+      {
+	const auto max_expon = this->m_max_exponents();
+	point_type x[s_lanes];
+	value_type r[s_lanes];
+	size_type k = 0;
+	for (; xbegin != xend; ++xbegin)
+	  {
+	    x[k++] = *xbegin;
+	    if (k == s_lanes)
+	      {
+		this->template m_eval_lanes<s_lanes>(max_expon, x, r);
+		for (size_type j = 0; j < s_lanes; ++j)
+		  *rbegin++ = r[j];
+		k = 0;
+	      }
+	  }
+	for (size_type j = 0; j < k; ++j)
+	  {
+	    this->template m_eval_lanes<1>(max_expon, x + j, r + j);
+	    *rbegin++ = r[j];
+	  }
+	return rbegin;
+      }
+
+  /**
+   * Return the partial derivative with respect to x_k.
+   */
+  template<typename Tp, std::size_t NVars>
+    MultiPolynomial<Tp, NVars>
+    MultiPolynomial<Tp, NVars>::derivative(size_type k) const
+    {
+      const auto unit = (monomial_type{1} << s_shift(k))
+		      | (monomial_type{1} << s_degree_shift);
+      MultiPolynomial res;
+      res.m_mono.reserve(this->num_terms());
+      res.m_coeff.reserve(this->num_terms());
+      for (size_type i = 0; i < this->num_terms(); ++i)
+	{
+	  const auto e = (this->m_mono[i] >> s_shift(k)) & s_field_mask;
+	  if (e > 0)
+	    {
+	      res.m_mono.push_back(this->m_mono[i] - unit);
+	      res.m_coeff.push_back(real_type(e) * this->m_coeff[i]);
+	    }
+	}
+      return res;
+    }
+
+  /**
+   * Return the sum pa + sign pb by a linear merge of the terms.
+   */
+  template<typename Tp, std::size_t NVars>
+    MultiPolynomial<Tp, NVars>
+    MultiPolynomial<Tp, NVars>::m_merge(const MultiPolynomial& pa,
+					const MultiPolynomial& pb,
+					value_type sign)
+    {
+      MultiPolynomial res;
+      const auto na = pa.num_terms();
+      const auto nb = pb.num_terms();
+      res.m_mono.reserve(na + nb);
+      res.m_coeff.reserve(na + nb);
+      std::size_t i = 0, j = 0;
+      while (i < na || j < nb)
+	{
+	  monomial_type mono;
+	  value_type a;
+	  if (j == nb || (i < na && pa.m_mono[i] < pb.m_mono[j]))
+	    {
+	      mono = pa.m_mono[i];
+	      a = pa.m_coeff[i++];
+	    }
+	  else if (i == na || pb.m_mono[j] < pa.m_mono[i])
+	    {
+	      mono = pb.m_mono[j];
+	      a = sign * pb.m_coeff[j++];
+	    }
+	  else
+	    {
+	      mono = pa.m_mono[i];
+	      a = pa.m_coeff[i++] + sign * pb.m_coeff[j++];
+	    }
+	  if (a != value_type{})
+	    {
+	      res.m_mono.push_back(mono);
+	      res.m_coeff.push_back(a);
+	    }
+	}
+      return res;
+    }
+
+  /**
+   * Multiply the polynomial by another polynomial by Johnson's method.
+   */
+  template<typename Tp, std::size_t NVars>
+    MultiPolynomial<Tp, NVars>&
+    MultiPolynomial<Tp, NVars>::operator*=(const MultiPolynomial& poly)
+    {
+      struct HeapEntry
+      {
+	monomial_type mono;
+	std::size_t i;
+	std::size_t j;
+      };
+      const auto later = [](const HeapEntry& x, const HeapEntry& y)
+			 { return x.mono > y.mono; };
+
+      const bool swap = this->num_terms() > poly.num_terms();
+      const auto& pa = swap ? poly : *this;
+      const auto& pb = swap ? *this : poly;
+      const auto na = pa.num_terms();
+      const auto nb = pb.num_terms();
+
+      MultiPolynomial res;
+      if (na == 0)
+	{
+	  *this = res;
+	  return *this;
+	}
+
+      constexpr auto guard = s_guard_mask();
+      const auto entry = [&pa, &pb](std::size_t i, std::size_t j)
+	{
+	  const auto mono = pa.m_mono[i] + pb.m_mono[j];
+	  if (mono & guard)
+	    throw std::overflow_error("MultiPolynomial: "
+				      "Total degree too large");
+	  return HeapEntry{mono, i, j};
+	};
+
+      // Replace the top of the heap and sift it down.  This is half
+      // the work of a pop followed by a push.
+      std::vector<HeapEntry> heap;
+      heap.reserve(na);
+      const auto replace_top = [&heap](const HeapEntry& ent)
+	{
+	  const auto n = heap.size();
+	  std::size_t k = 0;
+	  for (auto c = 2 * k + 1; c < n; c = 2 * k + 1)
+	    {
+	      if (c + 1 < n && heap[c + 1].mono < heap[c].mono)
+		++c;
+	      if (!(heap[c].mono < ent.mono))
+		break;
+	      heap[k] = heap[c];
+	      k = c;
+	    }
+	  heap[k] = ent;
+	};
+
+      heap.push_back(entry(0, 0));
+      auto mono = heap.front().mono;
+      auto sum = value_type{};
+      while (!heap.empty())
+	{
+	  const auto top = heap.front();
+	  if (top.mono != mono)
+	    {
+	      if (sum != value_type{})
+		{
+		  res.m_mono.push_back(mono);
+		  res.m_coeff.push_back(sum);
+		}
+	      mono = top.mono;
+	      sum = value_type{};
+	    }
+	  sum += pa.m_coeff[top.i] * pb.m_coeff[top.j];
+
+	  // Advance this stream and start the next one when the first
+	  // product of this stream is consumed.
+	  if (top.j + 1 < nb)
+	    replace_top(entry(top.i, top.j + 1));
+	  else
+	    {
+	      std::pop_heap(heap.begin(), heap.end(), later);
+	      heap.pop_back();
+	    }
+	  if (top.j == 0 && top.i + 1 < na)
+	    {
+	      heap.push_back(entry(top.i + 1, 0));
+	      std::push_heap(heap.begin(), heap.end(), later);
+	    }
+	}
+      if (sum != value_type{})
+	{
+	  res.m_mono.push_back(mono);
+	  res.m_coeff.push_back(sum);
+	}
+
+      *this = std::move(res);
+      return *this;
+    }
+
+  /**
+   * Write a multivariate polynomial to a stream.
+   */
+  template<typename CharT, typename Traits, typename Tp, std::size_t NVars>
+    std::basic_ostream<CharT, Traits>&
+    operator<<(std::basic_ostream<CharT, Traits>& os,
+	       const MultiPolynomial<Tp, NVars>& poly)
+    {
+      int old_prec = os.precision(std::numeric_limits<Tp>::max_digits10);
+      os << "(";
+      for (std::size_t i = 0; i < poly.num_terms(); ++i)
+	{
+	  if (i > 0)
+	    os << ",";
+	  os << "(" << poly.term_coefficient(i) << ",(";
+	  const auto expon = poly.exponents(i);
+	  for (std::size_t k = 0; k < NVars; ++k)
+	    os << (k > 0 ? "," : "") << expon[k];
+	  os << "))";
+	}
+      os << ")";
+      os.precision(old_prec);
+      return os;
+    }
+
+} // namespace emsr
+
+#endif // MULTI_POLYNOMIAL_TCC
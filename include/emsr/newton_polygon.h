@@ -0,0 +1,117 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file newton_polygon.h
+ *
+ * This file contains bounds on the moduli of the zeros of a polynomial
+ * and starting points for the iterative solvers from the Newton polygon.
+ */
+
+/**
+ * @def  NEWTON_POLYGON_H
+ *
+ * @brief  A guard for the Newton polygon header.
+ */
+#ifndef NEWTON_POLYGON_H
+#define NEWTON_POLYGON_H 1
+
+#include <vector>
+#include <complex>
+#include <utility>
+
+#include <emsr/polynomial.h>
+
+namespace emsr
+{
+
+  /**
+   * Return the Cauchy lower bound on the moduli of the zeros of
+   * a polynomial: the positive zero of
+   * @f[
+   *    |a_n| x^n + ... + |a_1| x - |a_0|
+   * @f]
+   * The moduli are given high order first as the solvers take them.
+   * The zero is bracketed by chopping from the smaller of the
+   * geometric mean and the Newton step at the origin and is then
+   * refined by Newton's method to relative tolerance @c tol.
+   * The Newton steps are added to @c num_iters.
+   */
+  template<typename Real>
+    Real
+    cauchy_lower_bound(const std::vector<Real>& moduli, Real tol,
+		       int& num_iters);
+
+  /**
+   * Return the Cauchy lower bound on the moduli of the zeros.
+   */
+  template<typename Real>
+    Real
+    cauchy_lower_bound(const std::vector<Real>& moduli,
+		       Real tol = Real{0.005L})
+    {
+      int num_iters = 0;
+      return cauchy_lower_bound(moduli, tol, num_iters);
+    }
+
+  /**
+   * Return the indices of the vertices of the Newton polygon:
+   * the upper convex hull of the points (k, log|a_k|).
+   * Zero coefficients are not points of the polygon.
+   * The hull is found in one pass in O(n).
+   */
+  template<typename Tp>
+    std::vector<std::size_t>
+    newton_polygon(const Polynomial<Tp>& poly);
+
+  /**
+   * Return the radii of the annuli of the Newton polygon and
+   * the number of zeros attributed to each, smallest radius first.
+   * An edge from vertex i to vertex j gives j - i zeros near
+   * @f[
+   *    u = |a_i / a_j|^{1/(j - i)}
+   * @f]
+   */
+  template<typename Tp>
+    std::vector<std::pair<real_type_t<Tp>, int>>
+    newton_polygon_radii(const Polynomial<Tp>& poly);
+
+  /**
+   * Return starting approximations for all the zeros of a polynomial
+   * placed on the circles of the Newton polygon radii as
+   * suggested by Bini, smallest modulus first.
+   * The points on each circle are equally spaced and the circles are
+   * rotated against each other by 2 pi / n and an offset @c sigma
+   * to avoid symmetry with real coefficients.
+   * The zero coefficients of a polynomial with zeros at the origin
+   * give starting points at the origin.
+   */
+  template<typename Tp>
+    std::vector<std::complex<real_type_t<Tp>>>
+    initial_approximations(const Polynomial<Tp>& poly,
+			   real_type_t<Tp> sigma = real_type_t<Tp>{0.7L});
+
+} // namespace emsr
+
+#include <emsr/newton_polygon.tcc>
+
+#endif // NEWTON_POLYGON_H
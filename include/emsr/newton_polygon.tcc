@@ -0,0 +1,206 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file newton_polygon.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * Newton polygon functions.
+ *
+ * @see newton_polygon.h
+ */
+
+/**
+ * @def  NEWTON_POLYGON_TCC
+ *
+ * @brief  A guard for the Newton polygon implementation header.
+ */
+#ifndef NEWTON_POLYGON_TCC
+#define NEWTON_POLYGON_TCC 1
+
+#include <cmath>
+#include <limits>
+
+#include <emsr/notsospecfun.h>
+
+namespace emsr
+{
+
+  /**
+   * Return the Cauchy lower bound on the moduli of the zeros.
+   */
+  template<typename Real>
+    Real
+    cauchy_lower_bound(const std::vector<Real>& moduli, Real tol,
+		       int& num_iters)
+    {
+      using std::abs;
+      using std::exp;
+      using std::log;
+      const int n = moduli.size() - 1;
+      if (n < 1 || moduli[n] == Real{0})
+	return Real{0};
+
+      // Compute upper estimate of bound.
+      auto x = exp((log(moduli[n]) - log(moduli[0])) / Real(n));
+      // If Newton step at the origin is better, use it.
+      if (moduli[n - 1] != Real{0})
+	{
+	  const auto xm = moduli[n] / moduli[n - 1];
+	  if (xm < x)
+	    x = xm;
+	}
+
+      // Chop the interval (0,x) until ff <= 0.
+      while (true)
+	{
+	  const auto xm = x * Real{0.1L};
+	  auto ff = moduli[0];
+	  for (int i = 1; i < n; ++i)
+	    ff = ff * xm + moduli[i];
+	  ff = ff * xm - moduli[n];
+	  if (ff <= Real{0})
+	    break;
+	  x = xm;
+	}
+
+      // Do Newton iteration until x converges to the tolerance.
+      auto dx = x;
+      while (abs(dx / x) > tol)
+	{
+	  auto ff = moduli[0];
+	  auto df = ff;
+	  for (int i = 1; i < n; ++i)
+	    {
+	      ff = ff * x + moduli[i];
+	      df = df * x + ff;
+	    }
+	  ff = ff * x - moduli[n];
+	  dx = ff / df;
+	  x -= dx;
+	  ++num_iters;
+	}
+
+      return x;
+    }
+
+  /**
+   * Return the indices of the vertices of the Newton polygon.
+   */
+  template<typename Tp>
+    std::vector<std::size_t>
+    newton_polygon(const Polynomial<Tp>& poly)
+    {
+      using std::abs;
+      using std::log;
+      using Real = real_type_t<Tp>;
+
+      const auto n = poly.degree();
+      std::vector<Real> lg(n + 1);
+      for (std::size_t k = 0; k <= n; ++k)
+	lg[k] = log(abs(poly[k]));
+
+      // Andrew's monotone chain: the points are already sorted by k.
+      // The point k is dropped from the hull if it is on or below
+      // the chord from the previous vertex to k.
+      std::vector<std::size_t> hull;
+      hull.reserve(n + 1);
+      for (std::size_t k = 0; k <= n; ++k)
+	{
+	  if (poly[k] == Tp{})
+	    continue;
+	  while (hull.size() >= 2)
+	    {
+	      const auto i = hull[hull.size() - 2];
+	      const auto j = hull.back();
+	      const auto cross = (lg[j] - lg[i]) * Real(k - i)
+			       - (lg[k] - lg[i]) * Real(j - i);
+	      if (cross > Real{0})
+		break;
+	      hull.pop_back();
+	    }
+	  hull.push_back(k);
+	}
+      return hull;
+    }
+
+  /**
+   * Return the radii of the annuli of the Newton polygon.
+   */
+  template<typename Tp>
+    std::vector<std::pair<real_type_t<Tp>, int>>
+    newton_polygon_radii(const Polynomial<Tp>& poly)
+    {
+      using std::abs;
+      using std::exp;
+      using std::log;
+      using Real = real_type_t<Tp>;
+
+      const auto hull = newton_polygon(poly);
+      std::vector<std::pair<Real, int>> radii;
+      if (!hull.empty() && hull.front() > 0)
+	radii.emplace_back(Real{0}, int(hull.front()));
+      for (std::size_t e = 1; e < hull.size(); ++e)
+	{
+	  const auto i = hull[e - 1];
+	  const auto j = hull[e];
+	  const auto u = exp((log(abs(poly[i])) - log(abs(poly[j])))
+			     / Real(j - i));
+	  radii.emplace_back(u, int(j - i));
+	}
+      return radii;
+    }
+
+  /**
+   * Return starting approximations for all the zeros of a polynomial.
+   */
+  template<typename Tp>
+    std::vector<std::complex<real_type_t<Tp>>>
+    initial_approximations(const Polynomial<Tp>& poly,
+			   real_type_t<Tp> sigma)
+    {
+      using std::sin;
+      using std::cos;
+      using Real = real_type_t<Tp>;
+      using Cmplx = std::complex<Real>;
+
+      const auto pi = Real{3.1415926535897932384626433832795029L};
+      const auto n = poly.degree();
+      std::vector<Cmplx> zeros;
+      zeros.reserve(n);
+      int edge = 0;
+      for (const auto& [u, m] : newton_polygon_radii(poly))
+	{
+	  for (int j = 0; j < m; ++j)
+	    {
+	      const auto theta = Real{2} * pi * Real(j) / Real(m)
+			       + Real{2} * pi * Real(edge) / Real(n) + sigma;
+	      zeros.push_back(u * Cmplx(cos(theta), sin(theta)));
+	    }
+	  ++edge;
+	}
+      return zeros;
+    }
+
+} // namespace emsr
+
+#endif // NEWTON_POLYGON_TCC
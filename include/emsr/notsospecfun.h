@@ -24,6 +24,7 @@
 #ifndef NOTSOSPECFUN_H
 #define NOTSOSPECFUN_H 1
 
+#include <cmath>
 #include <complex>
 
 // This was from another part of cxx_math and brought here to decouple.
@@ -468,8 +469,8 @@ namespace emsr
       const auto [ar, ai] = reinterpret_cast<const Tp(&)[2]>(a);
       const auto [zr, zi] = reinterpret_cast<const Tp(&)[2]>(z);
       const auto [br, bi] = reinterpret_cast<const Tp(&)[2]>(b);
-      const auto wr = std::fma(ar, ai, -std::fma(ai, zi, -br));
-      const auto wi = std::fma(ar, zi, std::fma(ai, zr, bi));
+      const auto wr = fma(ar, ai, -fma(ai, zi, -br));
+      const auto wi = fma(ar, zi, fma(ai, zr, bi));
       return {wr, wi};
     }
 
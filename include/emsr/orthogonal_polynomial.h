@@ -0,0 +1,317 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file orthogonal_polynomial.h
+ *
+ * This file contains the classical orthogonal polynomial families
+ * evaluated by their three-term recurrences.
+ */
+
+/**
+ * @def  ORTHOGONAL_POLYNOMIAL_H
+ *
+ * @brief  A guard for the orthogonal polynomial header.
+ */
+#ifndef ORTHOGONAL_POLYNOMIAL_H
+#define ORTHOGONAL_POLYNOMIAL_H 1
+
+#include <vector>
+#include <utility>
+
+#include <emsr/polynomial.h>
+
+namespace emsr
+{
+
+  /**
+   * The coefficients of one step of a three-term recurrence
+   * @f[
+   *    P_{k+1}(x) = (a_k x + b_k) P_k(x) - c_k P_{k-1}(x)
+   * @f]
+   * with P_{-1} = 0 and P_0 = 1.
+   */
+  template<typename Real>
+    struct RecurrenceCoefficients
+    {
+      Real a;
+      Real b;
+      Real c;
+    };
+
+  /**
+   * The recurrence for the Legendre polynomials P_n(x).
+   */
+  template<typename Real>
+    struct LegendreRecurrence
+    {
+      using value_type = Real;
+
+      RecurrenceCoefficients<Real>
+      operator()(unsigned k) const
+      {
+	return {Real(2 * k + 1) / Real(k + 1), Real{0},
+		Real(k) / Real(k + 1)};
+      }
+    };
+
+  /**
+   * The recurrence for the Chebyshev polynomials of the first kind T_n(x).
+   */
+  template<typename Real>
+    struct ChebyshevTRecurrence
+    {
+      using value_type = Real;
+
+      RecurrenceCoefficients<Real>
+      operator()(unsigned k) const
+      { return {k == 0 ? Real{1} : Real{2}, Real{0}, Real{1}}; }
+    };
+
+  /**
+   * The recurrence for the Chebyshev polynomials of the second kind U_n(x).
+   */
+  template<typename Real>
+    struct ChebyshevURecurrence
+    {
+      using value_type = Real;
+
+      RecurrenceCoefficients<Real>
+      operator()(unsigned) const
+      { return {Real{2}, Real{0}, Real{1}}; }
+    };
+
+  /**
+   * The recurrence for the physicists' Hermite polynomials H_n(x).
+   */
+  template<typename Real>
+    struct HermiteRecurrence
+    {
+      using value_type = Real;
+
+      RecurrenceCoefficients<Real>
+      operator()(unsigned k) const
+      { return {Real{2}, Real{0}, Real(2 * k)}; }
+    };
+
+  /**
+   * The recurrence for the generalized Laguerre polynomials
+   * L_n^{(alpha)}(x).
+   */
+  template<typename Real>
+    struct LaguerreRecurrence
+    {
+      using value_type = Real;
+
+      Real alpha = Real{0};
+
+      RecurrenceCoefficients<Real>
+      operator()(unsigned k) const
+      {
+	const auto kp1 = Real(k + 1);
+	return {Real{-1} / kp1, (Real(2 * k + 1) + alpha) / kp1,
+		(Real(k) + alpha) / kp1};
+      }
+    };
+
+  /**
+   * The recurrence for the Jacobi polynomials P_n^{(alpha, beta)}(x).
+   * Parameters for which 2k + alpha + beta vanishes for some k > 0
+   * are not supported.
+   */
+  template<typename Real>
+    struct JacobiRecurrence
+    {
+      using value_type = Real;
+
+      Real alpha = Real{0};
+      Real beta = Real{0};
+
+      RecurrenceCoefficients<Real>
+      operator()(unsigned k) const
+      {
+	const auto ab = alpha + beta;
+	if (k == 0)
+	  return {(ab + Real{2}) / Real{2}, (alpha - beta) / Real{2},
+		  Real{0}};
+	const auto kk = Real(k);
+	const auto s = Real{2} * kk + ab;
+	const auto den = Real{2} * (kk + Real{1}) * (kk + ab + Real{1}) * s;
+	return {(s + Real{1}) * (s + Real{2}) * s / den,
+		(s + Real{1}) * (alpha * alpha - beta * beta) / den,
+		Real{2} * (kk + alpha) * (kk + beta) * (s + Real{2}) / den};
+      }
+    };
+
+  /**
+   * An orthogonal polynomial of degree n given by a three-term recurrence.
+   *
+   * The recurrence coefficients are computed once on construction.
+   * Evaluation runs the recurrence in O(n) per point without
+   * forming the monomial coefficients, which is both faster and far
+   * more stable than evaluating the expanded polynomial.
+   *
+   * @tparam Recurrence  A callable returning RecurrenceCoefficients
+   *                     for step k.
+   */
+  template<typename Recurrence>
+    class OrthogonalPolynomial
+    {
+    public:
+
+      using recurrence_type = Recurrence;
+      using value_type = typename Recurrence::value_type;
+      using size_type = std::size_t;
+
+      /**
+       * The number of points evaluated together by the range evaluator.
+       */
+      static constexpr size_type s_lanes = 8;
+
+      /**
+       * Construct the polynomial of degree n of the family.
+       */
+      explicit
+      OrthogonalPolynomial(unsigned n, Recurrence rec = Recurrence{});
+
+      /**
+       * Return the degree.
+       */
+      unsigned
+      degree() const noexcept
+      { return this->m_degree; }
+
+      /**
+       * Return the recurrence.
+       */
+      const Recurrence&
+      recurrence() const noexcept
+      { return this->m_rec; }
+
+      /**
+       * Return the recurrence coefficients of step k < n.
+       */
+      RecurrenceCoefficients<value_type>
+      coefficients(unsigned k) const
+      { return {this->m_a[k], this->m_b[k], this->m_c[k]}; }
+
+      /**
+       * Evaluate the polynomial at a point.
+       */
+      value_type
+      operator()(value_type x) const
+      {
+	value_type r;
+	this->template m_eval_lanes<1>(&x, &r);
+	return r;
+      }
+
+      /**
+       * Evaluate the polynomial at a range of input points.
+       * The points are processed in blocks of s_lanes and within a block
+       * the recurrences for all points are run together.
+       * The next available output iterator is returned.
+       */
+      template<typename InIter, typename OutIter,
+	       typename = std::_RequireInputIter<InIter>>
+	OutIter
+	operator()(InIter xbegin, InIter xend, OutIter rbegin) const;
+
+      /**
+       * Write P_0(x), ..., P_n(x) to the output iterator.
+       * The next available output iterator is returned.
+       */
+      template<typename OutIter>
+	OutIter
+	all(value_type x, OutIter rbegin) const;
+
+      /**
+       * Return the value and the derivative at a point.
+       * The derivative is carried by the differentiated recurrence.
+       */
+      std::pair<value_type, value_type>
+      value_and_derivative(value_type x) const;
+
+      /**
+       * Return the polynomial in the monomial basis.
+       * This costs O(n^2) and the coefficients can be badly conditioned;
+       * it is meant for interoperation and testing.
+       */
+      Polynomial<value_type>
+      polynomial() const;
+
+    private:
+
+      template<size_type Lanes>
+	void
+	m_eval_lanes(const value_type* x, value_type* r) const;
+
+      unsigned m_degree;
+      Recurrence m_rec;
+      std::vector<value_type> m_a;
+      std::vector<value_type> m_b;
+      std::vector<value_type> m_c;
+    };
+
+  /**
+   * The Legendre polynomial of degree n.
+   */
+  template<typename Real>
+    using LegendrePolynomial = OrthogonalPolynomial<LegendreRecurrence<Real>>;
+
+  /**
+   * The Chebyshev polynomial of the first kind of degree n.
+   */
+  template<typename Real>
+    using ChebyshevTPolynomial
+      = OrthogonalPolynomial<ChebyshevTRecurrence<Real>>;
+
+  /**
+   * The Chebyshev polynomial of the second kind of degree n.
+   */
+  template<typename Real>
+    using ChebyshevUPolynomial
+      = OrthogonalPolynomial<ChebyshevURecurrence<Real>>;
+
+  /**
+   * The physicists' Hermite polynomial of degree n.
+   */
+  template<typename Real>
+    using HermitePolynomial = OrthogonalPolynomial<HermiteRecurrence<Real>>;
+
+  /**
+   * The generalized Laguerre polynomial of degree n.
+   */
+  template<typename Real>
+    using LaguerrePolynomial = OrthogonalPolynomial<LaguerreRecurrence<Real>>;
+
+  /**
+   * The Jacobi polynomial of degree n.
+   */
+  template<typename Real>
+    using JacobiPolynomial = OrthogonalPolynomial<JacobiRecurrence<Real>>;
+
+} // namespace emsr
+
+#include <emsr/orthogonal_polynomial.tcc>
+
+#endif // ORTHOGONAL_POLYNOMIAL_H
@@ -0,0 +1,193 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file orthogonal_polynomial.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * orthogonal polynomial class.
+ *
+ * @see orthogonal_polynomial.h
+ */
+
+/**
+ * @def  ORTHOGONAL_POLYNOMIAL_TCC
+ *
+ * @brief  A guard for the orthogonal polynomial implementation header.
+ */
+#ifndef ORTHOGONAL_POLYNOMIAL_TCC
+#define ORTHOGONAL_POLYNOMIAL_TCC 1
+
+namespace emsr
+{
+
+  /**
+   * Construct the polynomial of degree n of the family.
+   */
+  template<typename Recurrence>
+    OrthogonalPolynomial<Recurrence>::
+    OrthogonalPolynomial(unsigned n, Recurrence rec)
+    : m_degree(n), m_rec(rec), m_a(n), m_b(n), m_c(n)
+    {
+      for (unsigned k = 0; k < n; ++k)
+	{
+	  const auto abc = this->m_rec(k);
+	  this->m_a[k] = abc.a;
+	  this->m_b[k] = abc.b;
+	  this->m_c[k] = abc.c;
+	}
+    }
+
+  /**
+   * Run the recurrence for a block of points.
+   */
+  template<typename Recurrence>
+    template<typename OrthogonalPolynomial<Recurrence>::size_type Lanes>
+      void
+      OrthogonalPolynomial<Recurrence>::m_eval_lanes(const value_type* x,
+						     value_type* r) const
+      {
+	value_type pm1[Lanes], p[Lanes];
+	for (size_type l = 0; l < Lanes; ++l)
+	  {
+	    pm1[l] = value_type{0};
+	    p[l] = value_type{1};
+	  }
+	for (unsigned k = 0; k < this->m_degree; ++k)
+	  {
+	    const auto a = this->m_a[k];
+	    const auto b = this->m_b[k];
+	    const auto c = this->m_c[k];
+	    for (size_type l = 0; l < Lanes; ++l)
+	      {
+		const auto pp1 = (a * x[l] + b) * p[l] - c * pm1[l];
+		pm1[l] = p[l];
+		p[l] = pp1;
+	      }
+	  }
+	for (size_type l = 0; l < Lanes; ++l)
+	  r[l] = p[l];
+      }
+
+  /**
+   * Evaluate the polynomial at a range of input points.
+   */
+  template<typename Recurrence>
+    template<typename InIter, typename OutIter, typename>
+      OutIter
+      OrthogonalPolynomial<Recurrence>::operator()(InIter xbegin, InIter xend,
+						   OutIter rbegin) const
+      {
+	value_type x[s_lanes], r[s_lanes];
+	size_type k = 0;
+	for (; xbegin != xend; ++xbegin)
+	  {
+	    x[k++] = *xbegin;
+	    if (k == s_lanes)
+	      {
+		this->template m_eval_lanes<s_lanes>(x, r);
+		for (size_type j = 0; j < s_lanes; ++j)
+		  *rbegin++ = r[j];
+		k = 0;
+	      }
+	  }
+	for (size_type j = 0; j < k; ++j)
+	  {
+	    this->template m_eval_lanes<1>(x + j, r + j);
+	    *rbegin++ = r[j];
+	  }
+	return rbegin;
+      }
+
+  /**
+   * Write P_0(x), ..., P_n(x) to the output iterator.
+   */
+  template<typename Recurrence>
+    template<typename OutIter>
+      OutIter
+      OrthogonalPolynomial<Recurrence>::all(value_type x,
+					    OutIter rbegin) const
+      {
+	auto pm1 = value_type{0};
+	auto p = value_type{1};
+	*rbegin++ = p;
+	for (unsigned k = 0; k < this->m_degree; ++k)
+	  {
+	    const auto pp1 = (this->m_a[k] * x + this->m_b[k]) * p
+			   - this->m_c[k] * pm1;
+	    pm1 = p;
+	    p = pp1;
+	    *rbegin++ = p;
+	  }
+	return rbegin;
+      }
+
+  /**
+   * Return the value and the derivative at a point.
+   */
+  template<typename Recurrence>
+    std::pair<typename OrthogonalPolynomial<Recurrence>::value_type,
+	      typename OrthogonalPolynomial<Recurrence>::value_type>
+    OrthogonalPolynomial<Recurrence>::value_and_derivative(value_type x) const
+    {
+      auto pm1 = value_type{0};
+      auto p = value_type{1};
+      auto dpm1 = value_type{0};
+      auto dp = value_type{0};
+      for (unsigned k = 0; k < this->m_degree; ++k)
+	{
+	  const auto a = this->m_a[k];
+	  const auto t = a * x + this->m_b[k];
+	  const auto c = this->m_c[k];
+	  const auto dpp1 = a * p + t * dp - c * dpm1;
+	  const auto pp1 = t * p - c * pm1;
+	  dpm1 = dp;
+	  dp = dpp1;
+	  pm1 = p;
+	  p = pp1;
+	}
+      return {p, dp};
+    }
+
+  /**
+   * Return the polynomial in the monomial basis.
+   */
+  template<typename Recurrence>
+    Polynomial<typename OrthogonalPolynomial<Recurrence>::value_type>
+    OrthogonalPolynomial<Recurrence>::polynomial() const
+    {
+      using Poly = Polynomial<value_type>;
+      Poly pm1(value_type{0});
+      Poly p(value_type{1});
+      for (unsigned k = 0; k < this->m_degree; ++k)
+	{
+	  Poly pp1 = Poly({this->m_b[k], this->m_a[k]}) * p
+		   - this->m_c[k] * pm1;
+	  pm1 = std::move(p);
+	  p = std::move(pp1);
+	}
+      return p;
+    }
+
+} // namespace emsr
+
+#endif // ORTHOGONAL_POLYNOMIAL_TCC
@@ -0,0 +1,204 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file partial_fraction.h
+ *
+ * This file contains the partial fraction decomposition of a rational
+ * polynomial and the evaluation of its inverse Laplace transform.
+ * @see rational_polynomial.h
+ */
+
+/**
+ * @def  PARTIAL_FRACTION_H
+ *
+ * @brief  A guard for the partial fraction header.
+ */
+#ifndef PARTIAL_FRACTION_H
+#define PARTIAL_FRACTION_H 1
+
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <limits>
+
+#include <emsr/rational_polynomial.h>
+
+namespace emsr
+{
+
+  /**
+   * The terms of a partial fraction expansion belonging to one pole
+   * @f[
+   *    \sum_{j=1}^{m} \frac{r_j}{(s - p)^j}
+   * @f]
+   * where m is the multiplicity of the pole.
+   */
+  template<typename Real>
+    struct PoleTerm
+    {
+      /// The pole.
+      std::complex<Real> pole;
+
+      /// The coefficient of 1/(s - pole)^(j + 1) is residue[j].
+      std::vector<std::complex<Real>> residue;
+
+      /// Return the multiplicity of the pole.
+      std::size_t
+      multiplicity() const
+      { return this->residue.size(); }
+    };
+
+  /**
+   * The partial fraction expansion of a real rational polynomial
+   * into a polynomial part and a sum of pole terms.
+   */
+  template<typename Real>
+    struct PartialFractions
+    {
+      /// The polynomial part of the expansion.
+      Polynomial<Real> direct;
+
+      /// The pole terms of the expansion.
+      std::vector<PoleTerm<Real>> terms;
+
+      /**
+       * Evaluate the expansion at a point.
+       */
+      std::complex<Real>
+      operator()(std::complex<Real> s) const;
+    };
+
+  /**
+   * Return the partial fraction expansion of a real rational polynomial.
+   *
+   * The poles are the zeros of the denominator found by the
+   * Jenkins-Traub solver.  A multiple pole is returned by the solver as a
+   * cluster of nearby zeros whose spread grows with the multiplicity:
+   * about @c cluster_tol^(1/m) for an m-fold pole.  The largest set of
+   * m zeros within @c cluster_tol^(1/m) times max(1, |p|) of their
+   * centroid p is merged into one pole at the centroid with
+   * multiplicity m.
+   *
+   * The residues of a pole p of multiplicity m are the Taylor coefficients
+   * about p of N(s)/D_p(s), where D_p is the denominator with the factor
+   * (s - p)^m removed.  They are obtained by shifting N and D_p to p and
+   * dividing the series.
+   *
+   * @throws std::runtime_error if the denominator zeros cannot be found.
+   */
+  template<typename Real>
+    PartialFractions<Real>
+    partial_fractions(const RationalPolynomial<Real>& rat,
+		      Real cluster_tol
+			= Real{65536} * std::numeric_limits<Real>::epsilon());
+
+  /**
+   * The impulse response (inverse Laplace transform) of the strictly
+   * proper part of a partial fraction expansion
+   * @f[
+   *    h(t) = \sum_{p} e^{pt} \sum_{j=1}^{m} r_j \frac{t^{j-1}}{(j-1)!}
+   * @f]
+   * for t >= 0 and zero for t < 0.
+   * The polynomial part of the expansion gives impulses and their
+   * derivatives at t = 0 and is not included.
+   *
+   * Conjugate pole pairs are folded into one term of twice the
+   * weight so only poles in the upper half plane are summed.
+   * The coefficients are stored by power of t across terms
+   * so that the sums run over contiguous arrays.
+   */
+  template<typename Real>
+    class ImpulseResponse
+    {
+    public:
+
+      /**
+       * The number of times evaluated together by the range evaluator.
+       */
+      static constexpr std::size_t s_lanes = 8;
+
+      /**
+       * The number of steps of the uniform grid evaluator between
+       * direct recomputations of the exponentials.
+       */
+      static constexpr std::size_t s_reanchor = 256;
+
+      explicit ImpulseResponse(const PartialFractions<Real>& pf);
+
+      /**
+       * Evaluate the impulse response at time t.
+       */
+      Real
+      operator()(Real t) const;
+
+      /**
+       * Evaluate the impulse response at a range of times.
+       * The output is written to the output iterator which
+       * must be large enough to contain the results.
+       * The next available output iterator is returned.
+       */
+      template<typename InIter, typename OutIter>
+	OutIter
+	operator()(InIter tbegin, InIter tend, OutIter hbegin) const;
+
+      /**
+       * Evaluate the impulse response at the num times t0 + k dt.
+       * The exponentials are advanced by multiplication by exp(p dt)
+       * and recomputed every s_reanchor steps so no transcendental
+       * functions are needed in the inner loop.
+       * The next available output iterator is returned.
+       */
+      template<typename OutIter>
+	OutIter
+	grid(Real t0, Real dt, std::size_t num, OutIter hbegin) const;
+
+      /**
+       * Return the number of summed terms.
+       */
+      std::size_t
+      num_terms() const
+      { return this->m_pole_re.size(); }
+
+    private:
+
+      template<std::size_t Lanes>
+	void
+	m_eval_lanes(const Real* t, Real* h) const;
+
+      /// The real and imaginary parts of the poles.
+      std::vector<Real> m_pole_re;
+      std::vector<Real> m_pole_im;
+
+      /// The coefficients of t^j/j! by power then term.
+      std::vector<Real> m_coeff_re;
+      std::vector<Real> m_coeff_im;
+
+      /// The largest multiplicity.
+      std::size_t m_max_mult = 0;
+    };
+
+} // namespace emsr
+
+#include <emsr/partial_fraction.tcc>
+
+#endif // PARTIAL_FRACTION_H
@@ -0,0 +1,364 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file partial_fraction.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * partial fraction expansion and the impulse response.
+ *
+ * @see partial_fraction.h
+ */
+
+/**
+ * @def  PARTIAL_FRACTION_TCC
+ *
+ * @brief  A guard for the partial fraction implementation header.
+ */
+#ifndef PARTIAL_FRACTION_TCC
+#define PARTIAL_FRACTION_TCC 1
+
+#include <stdexcept>
+#include <algorithm>
+
+#include <emsr/solver_jenkins_traub.h>
+
+namespace emsr
+{
+
+  /**
+   * Evaluate the expansion at a point.
+   */
+  template<typename Real>
+    std::complex<Real>
+    PartialFractions<Real>::operator()(std::complex<Real> s) const
+    {
+      auto sum = std::complex<Real>(this->direct(s));
+      for (const auto& term : this->terms)
+	{
+	  const auto rs = Real{1} / (s - term.pole);
+	  auto part = std::complex<Real>{};
+	  for (std::size_t j = term.multiplicity(); j-- > 0;)
+	    part = (part + term.residue[j]) * rs;
+	  sum += part;
+	}
+      return sum;
+    }
+
+  /**
+   * Return the partial fraction expansion of a real rational polynomial.
+   */
+  template<typename Real>
+    PartialFractions<Real>
+    partial_fractions(const RationalPolynomial<Real>& rat, Real cluster_tol)
+    {
+      using std::real;
+      using std::imag;
+      using Cmplx = std::complex<Real>;
+
+      auto den = rat.denom();
+      while (den.degree() > 0 && den[den.degree()] == Real{0})
+	den.degree(den.degree() - 1);
+      if (den[den.degree()] == Real{0})
+	throw std::domain_error("partial_fractions: Zero denominator");
+
+      PartialFractions<Real> pf;
+      Polynomial<Real> rem;
+      divmod(rat.numer(), den, pf.direct, rem);
+      if (den.degree() == 0)
+	return pf;
+
+      // Find the poles.  The solver takes coefficients high order first.
+      std::vector<Real> coef(den.rbegin(), den.rend());
+      JenkinsTraubSolver<Real> jt(coef);
+      const auto zeros = jt.solve();
+      std::vector<Cmplx> roots;
+      for (const auto& z : zeros)
+	if (is_valid(z))
+	  roots.emplace_back(real(z), imag(z));
+      if (roots.size() != den.degree())
+	throw std::runtime_error("partial_fractions: Failed to find the poles");
+
+      // Merge clusters of zeros into multiple poles.  The zeros of an
+      // m-fold pole spread about cluster_tol^(1/m) so the k zeros nearest
+      // to a zero form a pole if they are within cluster_tol^(1/k)
+      // of their centroid.  The largest such cluster is taken.
+      std::vector<Cmplx> pole;
+      std::vector<std::size_t> mult;
+      std::vector<bool> used(roots.size(), false);
+      std::vector<std::size_t> near;
+      for (std::size_t i = 0; i < roots.size(); ++i)
+	{
+	  if (used[i])
+	    continue;
+	  near.clear();
+	  for (std::size_t j = i; j < roots.size(); ++j)
+	    if (!used[j])
+	      near.push_back(j);
+	  std::sort(near.begin(), near.end(),
+		    [&roots, i](std::size_t a, std::size_t b)
+		    {
+		      return std::abs(roots[a] - roots[i])
+			   < std::abs(roots[b] - roots[i]);
+		    });
+
+	  const auto scale = std::max(Real{1}, std::abs(roots[i]));
+	  auto center = roots[i];
+	  auto tol = Real{0};
+	  std::size_t num = 1;
+	  auto sum = Cmplx{};
+	  for (std::size_t k = 1; k <= near.size(); ++k)
+	    {
+	      sum += roots[near[k - 1]];
+	      const auto cent = sum / Real(k);
+	      const auto tol_k = scale * std::pow(cluster_tol, Real{1} / Real(k));
+	      auto rad = Real{0};
+	      for (std::size_t l = 0; l < k; ++l)
+		rad = std::max(rad, std::abs(roots[near[l]] - cent));
+	      if (rad <= tol_k)
+		{
+		  num = k;
+		  center = cent;
+		  tol = tol_k;
+		}
+	    }
+	  for (std::size_t l = 0; l < num; ++l)
+	    used[near[l]] = true;
+	  if (std::abs(std::imag(center)) <= tol)
+	    center = Cmplx(std::real(center), Real{0});
+	  pole.push_back(center);
+	  mult.push_back(num);
+	}
+
+      Polynomial<Cmplx> num(rem.begin(), rem.end());
+      const auto lead = den[den.degree()];
+      for (std::size_t k = 0; k < pole.size(); ++k)
+	{
+	  // Build the denominator without this pole.
+	  Polynomial<Cmplx> den_k{Cmplx(lead)};
+	  for (std::size_t l = 0; l < pole.size(); ++l)
+	    if (l != k)
+	      for (std::size_t i = 0; i < mult[l]; ++i)
+		den_k *= Polynomial<Cmplx>({-pole[l], Cmplx{1}});
+
+	  // Taylor coefficients of num/den_k about the pole.
+	  auto num_k = num;
+	  num_k.shift(pole[k]);
+	  den_k.shift(pole[k]);
+	  const auto m = mult[k];
+	  std::vector<Cmplx> g(m);
+	  for (std::size_t j = 0; j < m; ++j)
+	    {
+	      auto sum = j <= num_k.degree() ? num_k[j] : Cmplx{};
+	      for (std::size_t i = 1; i <= std::min(j, den_k.degree()); ++i)
+		sum -= den_k[i] * g[j - i];
+	      g[j] = sum / den_k[0];
+	    }
+
+	  PoleTerm<Real> term;
+	  term.pole = pole[k];
+	  term.residue.assign(g.rbegin(), g.rend());
+	  pf.terms.push_back(std::move(term));
+	}
+
+      return pf;
+    }
+
+  /**
+   * Set up the impulse response of a partial fraction expansion.
+   */
+  template<typename Real>
+    ImpulseResponse<Real>::ImpulseResponse(const PartialFractions<Real>& pf)
+    {
+      for (const auto& term : pf.terms)
+	if (std::imag(term.pole) >= Real{0})
+	  this->m_max_mult = std::max(this->m_max_mult, term.multiplicity());
+
+      const std::size_t num_terms
+	= std::count_if(pf.terms.begin(), pf.terms.end(),
+			[](const PoleTerm<Real>& term)
+			{ return std::imag(term.pole) >= Real{0}; });
+      this->m_pole_re.reserve(num_terms);
+      this->m_pole_im.reserve(num_terms);
+      this->m_coeff_re.assign(this->m_max_mult * num_terms, Real{0});
+      this->m_coeff_im.assign(this->m_max_mult * num_terms, Real{0});
+
+      std::size_t i = 0;
+      for (const auto& term : pf.terms)
+	{
+	  const auto im = std::imag(term.pole);
+	  if (im < Real{0})
+	    continue;
+	  const auto weight = im > Real{0} ? Real{2} : Real{1};
+	  this->m_pole_re.push_back(std::real(term.pole));
+	  this->m_pole_im.push_back(im);
+	  auto fact = Real{1};
+	  for (std::size_t j = 0; j < term.multiplicity(); ++j)
+	    {
+	      if (j > 0)
+		fact *= Real(j);
+	      const auto c = weight * term.residue[j] / fact;
+	      this->m_coeff_re[j * num_terms + i] = std::real(c);
+	      this->m_coeff_im[j * num_terms + i] = std::imag(c);
+	    }
+	  ++i;
+	}
+    }
+
+  /**
+   * Evaluate the impulse response at Lanes times.
+   */
+  template<typename Real>
+    template<std::size_t Lanes>
+      void
+      ImpulseResponse<Real>::m_eval_lanes(const Real* t, Real* h) const
+      {
+	const auto nt = this->num_terms();
+	const auto mm = this->m_max_mult;
+	for (std::size_t k = 0; k < Lanes; ++k)
+	  h[k] = Real{0};
+	for (std::size_t i = 0; i < nt; ++i)
+	  {
+	    const auto pr = this->m_pole_re[i];
+	    const auto pi = this->m_pole_im[i];
+	    for (std::size_t k = 0; k < Lanes; ++k)
+	      {
+		auto cr = this->m_coeff_re[(mm - 1) * nt + i];
+		auto ci = this->m_coeff_im[(mm - 1) * nt + i];
+		for (std::size_t j = mm - 1; j-- > 0;)
+		  {
+		    cr = cr * t[k] + this->m_coeff_re[j * nt + i];
+		    ci = ci * t[k] + this->m_coeff_im[j * nt + i];
+		  }
+		const auto mag = std::exp(pr * t[k]);
+		const auto er = mag * std::cos(pi * t[k]);
+		const auto ei = mag * std::sin(pi * t[k]);
+		const auto hk = er * cr - ei * ci;
+		h[k] += t[k] < Real{0} ? Real{0} : hk;
+	      }
+	  }
+      }
+
+  /**
+   * Evaluate the impulse response at time t.
+   */
+  template<typename Real>
+    Real
+    ImpulseResponse<Real>::operator()(Real t) const
+    {
+      Real h;
+      this->template m_eval_lanes<1>(&t, &h);
+      return h;
+    }
+
+  /**
+   * Evaluate the impulse response at a range of times.
+   */
+  template<typename Real>
+    template<typename InIter, typename OutIter>
+      OutIter
+      ImpulseResponse<Real>::operator()(InIter tbegin, InIter tend,
+					OutIter hbegin) const
+      {
+	Real t[s_lanes], h[s_lanes];
+	std::size_t k = 0;
+	for (; tbegin != tend; ++tbegin)
+	  {
+	    t[k++] = *tbegin;
+	    if (k == s_lanes)
+	      {
+		this->template m_eval_lanes<s_lanes>(t, h);
+		for (std::size_t j = 0; j < s_lanes; ++j)
+		  *hbegin++ = h[j];
+		k = 0;
+	      }
+	  }
+	for (std::size_t j = 0; j < k; ++j)
+	  {
+	    this->template m_eval_lanes<1>(t + j, h + j);
+	    *hbegin++ = h[j];
+	  }
+	return hbegin;
+      }
+
+  /**
+   * Evaluate the impulse response on a uniform grid of times.
+   */
+  template<typename Real>
+    template<typename OutIter>
+      OutIter
+      ImpulseResponse<Real>::grid(Real t0, Real dt, std::size_t num,
+				  OutIter hbegin) const
+      {
+	const auto nt = this->num_terms();
+	const auto mm = this->m_max_mult;
+	if (nt == 0)
+	  return std::fill_n(hbegin, num, Real{0});
+
+	// The step factors exp(p dt) and the running exponentials exp(p t).
+	std::vector<Real> zr(nt), zi(nt), er(nt), ei(nt), cr(nt), ci(nt);
+	for (std::size_t i = 0; i < nt; ++i)
+	  {
+	    const auto mag = std::exp(this->m_pole_re[i] * dt);
+	    zr[i] = mag * std::cos(this->m_pole_im[i] * dt);
+	    zi[i] = mag * std::sin(this->m_pole_im[i] * dt);
+	  }
+
+	for (std::size_t k = 0; k < num; ++k)
+	  {
+	    const auto t = t0 + Real(k) * dt;
+	    if (k % s_reanchor == 0)
+	      for (std::size_t i = 0; i < nt; ++i)
+		{
+		  const auto mag = std::exp(this->m_pole_re[i] * t);
+		  er[i] = mag * std::cos(this->m_pole_im[i] * t);
+		  ei[i] = mag * std::sin(this->m_pole_im[i] * t);
+		}
+
+	    std::copy_n(this->m_coeff_re.begin() + (mm - 1) * nt, nt,
+			cr.begin());
+	    std::copy_n(this->m_coeff_im.begin() + (mm - 1) * nt, nt,
+			ci.begin());
+	    for (std::size_t j = mm - 1; j-- > 0;)
+	      for (std::size_t i = 0; i < nt; ++i)
+		{
+		  cr[i] = cr[i] * t + this->m_coeff_re[j * nt + i];
+		  ci[i] = ci[i] * t + this->m_coeff_im[j * nt + i];
+		}
+
+	    auto h = Real{0};
+	    for (std::size_t i = 0; i < nt; ++i)
+	      {
+		h += er[i] * cr[i] - ei[i] * ci[i];
+		const auto tr = er[i] * zr[i] - ei[i] * zi[i];
+		ei[i] = er[i] * zi[i] + ei[i] * zr[i];
+		er[i] = tr;
+	      }
+	    *hbegin++ = t < Real{0} ? Real{0} : h;
+	  }
+
+	return hbegin;
+      }
+
+} // namespace emsr
+
+#endif // PARTIAL_FRACTION_TCC
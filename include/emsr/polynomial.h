@@ -124,6 +124,17 @@ namespace emsr
   template<typename Tp>
     using real_type_t = typename real_type<Tp>::type;
 
+  /**
+   * Return the square root of the machine epsilon of a real type.
+   */
+  template<typename Real>
+    inline Real
+    sqrt_epsilon()
+    {
+      using std::sqrt;
+      return sqrt(std::numeric_limits<Real>::epsilon());
+    }
+
 
   /**
    * @brief A dense polynomial class with a contiguous array of coefficients.
@@ -251,9 +262,10 @@ namespace emsr
       value_type
       operator()(value_type x) const
       {
+	using std::abs;
 	if (this->degree() > 0)
 	  {
-	    if (std::abs(x) <= real_type{1})
+	    if (abs(x) <= real_type{1})
 	      {
 		value_type poly(this->coefficient(this->degree()));
 		for (int i = this->degree() - 1; i >= 0; --i)
@@ -283,9 +295,10 @@ namespace emsr
 	operator()(Up x) const
 	-> decltype(value_type{} * Up{})
 	{
+	  using std::abs;
 	  if (this->degree() > 0)
 	    {
-	      if (std::abs(x) <= real_type{1})
+	      if (abs(x) <= real_type{1})
 		{
 		  auto poly(Up{1} * this->coefficient(this->degree()));
 		  for (int i = this->degree() - 1; i >= 0; --i)
@@ -414,7 +427,7 @@ namespace emsr
 	Polynomial res(value_type{},
 			  this->degree() > 0UL ? this->degree() - 1 : 0UL);
 	for (size_type n = this->degree(), i = 1; i <= n; ++i)
-	  res.m_coeff[i - 1] = i * this->m_coeff[i];
+	  res.m_coeff[i - 1] = real_type(i) * this->m_coeff[i];
 	return res;
       }
 
@@ -826,9 +839,10 @@ namespace emsr
       Polynomial&
       deflate(real_type max_abs_coef)
       {
+	using std::abs;
 	size_type n = this->degree();
 	for (size_type i = this->degree(); i > 0; --i)
-	  if (std::abs(this->m_coeff[i]) < max_abs_coef)
+	  if (abs(this->m_coeff[i]) < max_abs_coef)
 	    --n;
 	  else
 	    break;
@@ -844,13 +858,14 @@ namespace emsr
       deflate(const Polynomial<value_type>& poly,
 	      real_type max_abs_coef)
       {
+	using std::abs;
 	Polynomial<value_type> quo, rem;
 	divmod(*this, poly, quo, rem);
 
 	// Remainder should be null.
 	size_type n = rem.degree();
 	for (size_type i = rem.degree(); i > 0; --i)
-	  if (std::abs(rem[i]) < max_abs_coef)
+	  if (abs(rem[i]) < max_abs_coef)
 	    --n;
 	  else
 	    break;
@@ -902,9 +917,12 @@ namespace emsr
    * Return the scale for a number.
    */
   template<typename Tp>
-    decltype(std::abs(Tp()))
+    real_type_t<Tp>
     get_scale(const Tp& x)
-    { return std::abs(x); }
+    {
+      using std::abs;
+      return abs(x);
+    }
 
   /**
    * Return the sum of a polynomial with a scalar.
@@ -1034,6 +1052,25 @@ namespace emsr
     divmod(const Polynomial<Tp>& num, const Polynomial<Tp>& den,
            Polynomial<Tp>& quo, Polynomial<Tp>& rem);
 
+  /**
+   * Return the approximate greatest common divisor of two polynomials.
+   *
+   * The Euclidean remainder sequence is computed on copies scaled to unit
+   * maximum coefficient.  A remainder is taken to vanish when its largest
+   * coefficient is below @c tol times the size of the rounding error
+   * committed in forming it.  The result is monic.  If the polynomials
+   * have no common factor within the tolerance the unit polynomial
+   * is returned.
+   *
+   * @param  pa   The first polynomial.
+   * @param  pb   The second polynomial.
+   * @param  tol  The relative tolerance on vanishing remainders.
+   */
+  template<typename Tp>
+    Polynomial<Tp>
+    gcd(const Polynomial<Tp>& pa, const Polynomial<Tp>& pb,
+	real_type_t<Tp> tol = sqrt_epsilon<real_type_t<Tp>>());
+
   /**
    * Write a polynomial to a stream.
    * The format is a parenthesized comma-delimited list of coefficients.
@@ -117,8 +117,8 @@ This scaling thing can only apply to real or complex polynomials.
 	  // Scale polynomial.
 	  if (scale == real_type{0})
 	    scale = s_tiny;
-	  const auto lg = std::ilogb(scale);
-	  this->m_scale = std::pow(s_base, lg);
+	  const auto lg = ilogb(scale);
+	  this->m_scale = pow(s_base, lg);
 	  //if (this->m_scale != real_type{1})
 	  //  for (int i = 0; i <= this->degree(); ++i)
 	  //    this->m_coeff[i] *= this->m_scale;
@@ -188,8 +188,8 @@ This scaling thing can only apply to real or complex polynomials.
 	      {
 		int nn = std::min(arr.size() - 1, sz - 1 - i);
 		for (int j = nn; j >= 1; --j)
-		  arr[j] = std::fma(arr[j], x, arr[j - 1]);
-		arr[0] = std::fma(arr[0], x, this->coefficient(i));
+		  arr[j] = fma(arr[j], x, arr[j - 1]);
+		arr[0] = fma(arr[0], x, this->coefficient(i));
 	      }
 	    //  Now put in the factorials.
 	    value_type fact = value_type(1);
@@ -221,8 +221,8 @@ This scaling thing can only apply to real or complex polynomials.
 	      {
 		for (auto it = std::reverse_iterator<OutIter>(e);
 		     it != std::reverse_iterator<OutIter>(b) - 1; ++it)
-		  *it = std::fma(*it, x, *(it + 1));
-		*b = std::fma(*b, x, m_coeff[i]);
+		  *it = fma(*it, x, *(it + 1));
+		*b = fma(*b, x, m_coeff[i]);
 	      }
 	    //  Now put in the factorials.
 	    int i = 0;
@@ -249,7 +249,7 @@ This scaling thing can only apply to real or complex polynomials.
 	  const auto xx = x * x;
 	  auto poly(this->coefficient(this->degree() - odd));
 	  for (int i = this->degree() - odd - 2; i >= 0; i -= 2)
-	    poly = std::fma(xx, poly, this->coefficient(i));
+	    poly = fma(xx, poly, this->coefficient(i));
 	  return poly;
 	}
       else
@@ -269,7 +269,7 @@ This scaling thing can only apply to real or complex polynomials.
 	  const auto xx = x * x;
 	  auto poly(this->coefficient(this->degree() - even));
 	  for (int i = this->degree() - even - 2; i >= 0; i -= 2)
-	    poly = std::fma(xx, poly, this->coefficient(i));
+	    poly = fma(xx, poly, this->coefficient(i));
 	  return x * poly;
 	}
       else
@@ -308,7 +308,7 @@ This scaling thing can only apply to real or complex polynomials.
 	    auto aa = this->coefficient(n);
 	    auto bb = this->coefficient(n - 2);
 	    for (size_type j = 4; j <= n; j += 2)
-	      bb = std::fma(-s, std::exchange(aa, bb + r * aa),
+	      bb = fma(-s, std::exchange(aa, bb + r * aa),
 			      this->coefficient(n - j));
 	    return emsr::fma(cmplx_t(aa), cmplx_t(zz), cmplx_t(bb));
 	  }
@@ -348,7 +348,7 @@ This scaling thing can only apply to real or complex polynomials.
 	    auto aa = this->coefficient(n);
 	    auto bb = this->coefficient(n - 2);
 	    for (size_type j = 4; j <= n; j += 2)
-	      bb = std::fma(-s, std::exchange(aa, bb + r * aa),
+	      bb = fma(-s, std::exchange(aa, bb + r * aa),
 			      this->coefficient(n - j));
 	    return z
 		 * emsr::fma(cmplx_t(aa), cmplx_t(zz), cmplx_t(bb));
@@ -407,6 +407,61 @@ This scaling thing can only apply to real or complex polynomials.
 	quo.degree(0);
     }
 
+  /**
+   * Return the approximate greatest common divisor of two polynomials.
+   */
+  template<typename Tp>
+    Polynomial<Tp>
+    gcd(const Polynomial<Tp>& pa, const Polynomial<Tp>& pb,
+	real_type_t<Tp> tol)
+    {
+      using std::abs;
+      using real_t = real_type_t<Tp>;
+
+      const auto norm = [](const Polynomial<Tp>& poly)
+      {
+	auto nrm = real_t{0};
+	for (const auto& c : poly)
+	  nrm = std::max(nrm, real_t(abs(c)));
+	return nrm;
+      };
+
+      auto a = pa;
+      auto b = pb;
+      const auto na = norm(a);
+      const auto nb = norm(b);
+      if (na == real_t{0} && nb == real_t{0})
+	return Polynomial<Tp>(Tp{1});
+      else if (na == real_t{0})
+	std::swap(a, b);
+      else if (nb != real_t{0})
+	{
+	  a /= na;
+	  b /= nb;
+	}
+      a.deflate(tol);
+      b.deflate(tol);
+      if (a.degree() < b.degree())
+	std::swap(a, b);
+
+      Polynomial<Tp> quo, rem;
+      while (b.degree() > 0)
+	{
+	  divmod(a, b, quo, rem);
+	  const auto nr = norm(rem);
+	  if (nr <= tol * std::max(real_t{1}, norm(quo)))
+	    break;
+	  a = std::move(b);
+	  b = rem / nr;
+	  b.deflate(tol);
+	}
+
+      if (b.degree() == 0)
+	return Polynomial<Tp>(Tp{1});
+      else
+	return b / b[b.degree()];
+    }
+
   /**
    * Write a polynomial to a stream.
    * The format is a parenthesized comma-delimited list of coefficients.
@@ -441,6 +496,8 @@ This scaling thing can only apply to real or complex polynomials.
       is >> ch;
       if (ch == '(')
 	{
+	  // Replace the polynomial rather than appending to it.
+	  poly.m_coeff.clear();
 	  do
 	    {
 	      is >> x >> ch;
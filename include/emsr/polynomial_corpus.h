@@ -0,0 +1,314 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file polynomial_corpus.h
+ *
+ * This file contains a binary container format for large collections
+ * of polynomials with a writer and a memory-mapped reader.
+ */
+
+/**
+ * @def  POLYNOMIAL_CORPUS_H
+ *
+ * @brief  A guard for the polynomial corpus header.
+ */
+#ifndef POLYNOMIAL_CORPUS_H
+#define POLYNOMIAL_CORPUS_H 1
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <complex>
+#include <utility> // For exchange.
+
+#include <emsr/polynomial.h>
+#include <emsr/polynomial_view.h>
+
+namespace emsr
+{
+
+  /**
+   * The alignment of the header, the index and each coefficient block
+   * in a corpus file.
+   */
+  constexpr std::size_t corpus_alignment = 64;
+
+  /**
+   * A code for the coefficient type stored in a corpus.
+   * Only the standard floating point types and their complex
+   * counterparts are supported.
+   */
+  template<typename Tp>
+    struct corpus_type_code;
+
+  template<>
+    struct corpus_type_code<float>
+    { static constexpr std::uint32_t value = 1; };
+
+  template<>
+    struct corpus_type_code<double>
+    { static constexpr std::uint32_t value = 2; };
+
+  template<>
+    struct corpus_type_code<long double>
+    { static constexpr std::uint32_t value = 3; };
+
+  template<>
+    struct corpus_type_code<std::complex<float>>
+    { static constexpr std::uint32_t value = 4; };
+
+  template<>
+    struct corpus_type_code<std::complex<double>>
+    { static constexpr std::uint32_t value = 5; };
+
+  template<>
+    struct corpus_type_code<std::complex<long double>>
+    { static constexpr std::uint32_t value = 6; };
+
+  /**
+   * The 64-byte header at the start of a corpus file.
+   * The endianness mark is written in the byte order of the writer so
+   * a reader with the other byte order sees it reversed.
+   */
+  struct CorpusHeader
+  {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t endian_mark;
+    std::uint32_t type_code;
+    std::uint32_t value_size;
+    std::uint64_t count;
+    std::uint64_t index_offset;
+    std::uint64_t reserved[3];
+
+    static constexpr char s_magic[8] = {'E', 'M', 'S', 'R',
+					'P', 'O', 'L', 'Y'};
+    static constexpr std::uint32_t s_version = 1;
+    static constexpr std::uint32_t s_endian_mark = 0x01020304u;
+  };
+
+  static_assert(sizeof(CorpusHeader) == corpus_alignment,
+		"CorpusHeader: Unexpected padding");
+
+  /**
+   * An entry of the corpus index: the file offset in bytes and
+   * the number of coefficients of one polynomial.
+   */
+  struct CorpusIndexEntry
+  {
+    std::uint64_t offset;
+    std::uint64_t size;
+  };
+
+  /**
+   * @brief Write polynomials to a corpus file.
+   *
+   * The file has a header, the coefficient blocks and, at the end,
+   * the offset index which is what allows polynomials of different
+   * degrees to be stored back to back.  The coefficients are stored
+   * lowest-order first in native byte order and every block starts
+   * on a 64-byte boundary.
+   *
+   * The index is kept in memory (16 bytes per polynomial) and written
+   * with the header by close() or the destructor.
+   */
+  template<typename Tp>
+    class PolynomialCorpusWriter
+    {
+    public:
+      using value_type = Tp;
+      using size_type = std::size_t;
+
+      /**
+       * Create a corpus file.
+       *
+       * @throws std::runtime_error if the file cannot be opened.
+       */
+      explicit
+      PolynomialCorpusWriter(const std::string& filename);
+
+      PolynomialCorpusWriter(const PolynomialCorpusWriter&) = delete;
+      PolynomialCorpusWriter& operator=(const PolynomialCorpusWriter&)
+	= delete;
+
+      /**
+       * Finish the file if it has not been closed.
+       */
+      ~PolynomialCorpusWriter()
+      {
+	if (this->m_file.is_open())
+	  try
+	    {
+	      this->close();
+	    }
+	  catch (...)
+	    { }
+      }
+
+      /**
+       * Append a polynomial from an array of n coefficients.
+       *
+       * @throws std::domain_error if there are no coefficients.
+       * @throws std::runtime_error if writing fails.
+       */
+      void
+      append(const value_type* coeff, size_type n);
+
+      /**
+       * Append a polynomial.
+       */
+      void
+      append(const Polynomial<value_type>& poly)
+      { this->append(poly.data(), poly.degree() + 1); }
+
+      /**
+       * Return the number of polynomials written so far.
+       */
+      size_type
+      size() const noexcept
+      { return this->m_index.size(); }
+
+      /**
+       * Write the index and the header and close the file.
+       *
+       * @throws std::runtime_error if writing fails.
+       */
+      void
+      close();
+
+    private:
+
+      void
+      m_pad();
+
+      std::ofstream m_file;
+      std::uint64_t m_pos = 0;
+      std::vector<CorpusIndexEntry> m_index;
+    };
+
+  /**
+   * @brief A read-only corpus of polynomials.
+   *
+   * The file is memory-mapped where the platform has mmap and read into
+   * one aligned buffer otherwise.  Either way the coefficients are used
+   * in place: data(i) points into the mapping and nothing is copied
+   * or parsed when a polynomial is accessed.  The pointers stay valid
+   * for the lifetime of the corpus.
+   */
+  template<typename Tp>
+    class PolynomialCorpus
+    {
+    public:
+      using value_type = Tp;
+      using size_type = std::size_t;
+
+      /**
+       * Open a corpus file.
+       *
+       * @throws std::runtime_error if the file cannot be read or has
+       *         a different coefficient type, version or byte order.
+       */
+      explicit
+      PolynomialCorpus(const std::string& filename);
+
+      PolynomialCorpus(PolynomialCorpus&& other) noexcept
+      : m_base(std::exchange(other.m_base, nullptr)),
+	m_length(std::exchange(other.m_length, 0)),
+	m_mapped(other.m_mapped),
+	m_index(std::exchange(other.m_index, nullptr)),
+	m_count(std::exchange(other.m_count, 0))
+      { }
+
+      PolynomialCorpus(const PolynomialCorpus&) = delete;
+      PolynomialCorpus& operator=(const PolynomialCorpus&) = delete;
+      PolynomialCorpus& operator=(PolynomialCorpus&&) = delete;
+
+      ~PolynomialCorpus()
+      { this->m_release(); }
+
+      /**
+       * Return the number of polynomials.
+       */
+      size_type
+      size() const noexcept
+      { return this->m_count; }
+
+      /**
+       * Return the number of coefficients of polynomial @c i.
+       */
+      size_type
+      size(size_type i) const noexcept
+      { return this->m_index[i].size; }
+
+      /**
+       * Return the degree of polynomial @c i.
+       */
+      size_type
+      degree(size_type i) const noexcept
+      { return this->m_index[i].size - 1; }
+
+      /**
+       * Return a pointer to the 64-byte aligned coefficients
+       * of polynomial @c i, lowest-order first.
+       */
+      const value_type*
+      data(size_type i) const noexcept
+      {
+	return reinterpret_cast<const value_type*>(this->m_base
+						   + this->m_index[i].offset);
+      }
+
+      /**
+       * Return a view of polynomial @c i which solvers take directly.
+       */
+      PolynomialView<value_type>
+      view(size_type i) const
+      { return PolynomialView<value_type>(this->data(i), this->size(i)); }
+
+      /**
+       * Return a copy of polynomial @c i.
+       */
+      Polynomial<value_type>
+      polynomial(size_type i) const
+      { return Polynomial<value_type>(this->data(i),
+				      this->data(i) + this->size(i)); }
+
+    private:
+
+      void
+      m_release() noexcept;
+
+      const unsigned char* m_base = nullptr;
+      std::size_t m_length = 0;
+      bool m_mapped = false;
+      const CorpusIndexEntry* m_index = nullptr;
+      size_type m_count = 0;
+    };
+
+} // namespace emsr
+
+#include <emsr/polynomial_corpus.tcc>
+
+#endif // POLYNOMIAL_CORPUS_H
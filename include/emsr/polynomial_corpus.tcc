@@ -0,0 +1,243 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file polynomial_corpus.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * polynomial corpus writer and reader.
+ *
+ * @see polynomial_corpus.h
+ */
+
+/**
+ * @def  POLYNOMIAL_CORPUS_TCC
+ *
+ * @brief  A guard for the polynomial corpus implementation header.
+ */
+#ifndef POLYNOMIAL_CORPUS_TCC
+#define POLYNOMIAL_CORPUS_TCC 1
+
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#if __has_include(<sys/mman.h>)
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#  define EMSR_CORPUS_MMAP 1
+#else
+#  define EMSR_CORPUS_MMAP 0
+#endif
+
+namespace emsr
+{
+
+  /**
+   * Create a corpus file and reserve the header.
+   */
+  template<typename Tp>
+    PolynomialCorpusWriter<Tp>::PolynomialCorpusWriter(const std::string& filename)
+    : m_file(filename, std::ios::binary | std::ios::trunc)
+    {
+      if (!this->m_file)
+	throw std::runtime_error("PolynomialCorpusWriter: "
+				 "Cannot open " + filename);
+      const CorpusHeader blank{};
+      this->m_file.write(reinterpret_cast<const char*>(&blank), sizeof(blank));
+      this->m_pos = sizeof(blank);
+    }
+
+  /**
+   * Pad the file with zeros to the next 64-byte boundary.
+   */
+  template<typename Tp>
+    void
+    PolynomialCorpusWriter<Tp>::m_pad()
+    {
+      static const char zeros[corpus_alignment] = {};
+      const auto rem = this->m_pos % corpus_alignment;
+      if (rem != 0)
+	{
+	  this->m_file.write(zeros, corpus_alignment - rem);
+	  this->m_pos += corpus_alignment - rem;
+	}
+    }
+
+  /**
+   * Append a polynomial from an array of coefficients.
+   */
+  template<typename Tp>
+    void
+    PolynomialCorpusWriter<Tp>::append(const value_type* coeff, size_type n)
+    {
+      if (n == 0)
+	throw std::domain_error("PolynomialCorpusWriter::append: "
+				"No coefficients");
+      this->m_pad();
+      this->m_index.push_back({this->m_pos, n});
+      const auto bytes = n * sizeof(value_type);
+      this->m_file.write(reinterpret_cast<const char*>(coeff), bytes);
+      this->m_pos += bytes;
+      if (!this->m_file)
+	throw std::runtime_error("PolynomialCorpusWriter::append: "
+				 "Write failed");
+    }
+
+  /**
+   * Write the index and the header and close the file.
+   */
+  template<typename Tp>
+    void
+    PolynomialCorpusWriter<Tp>::close()
+    {
+      this->m_pad();
+      CorpusHeader header{};
+      std::memcpy(header.magic, CorpusHeader::s_magic, sizeof(header.magic));
+      header.version = CorpusHeader::s_version;
+      header.endian_mark = CorpusHeader::s_endian_mark;
+      header.type_code = corpus_type_code<value_type>::value;
+      header.value_size = sizeof(value_type);
+      header.count = this->m_index.size();
+      header.index_offset = this->m_pos;
+
+      this->m_file.write(reinterpret_cast<const char*>(this->m_index.data()),
+			 this->m_index.size() * sizeof(CorpusIndexEntry));
+      this->m_file.seekp(0);
+      this->m_file.write(reinterpret_cast<const char*>(&header),
+			 sizeof(header));
+      this->m_file.close();
+      if (!this->m_file)
+	throw std::runtime_error("PolynomialCorpusWriter::close: "
+				 "Write failed");
+    }
+
+  /**
+   * Map a corpus file and check its header and index.
+   */
+  template<typename Tp>
+    PolynomialCorpus<Tp>::PolynomialCorpus(const std::string& filename)
+    {
+      const auto fail = [this, &filename](const char* msg)
+	{
+	  this->m_release();
+	  throw std::runtime_error(std::string("PolynomialCorpus: ") + msg
+				   + ": " + filename);
+	};
+
+#if EMSR_CORPUS_MMAP
+      const int fd = ::open(filename.c_str(), O_RDONLY);
+      if (fd < 0)
+	fail("Cannot open");
+      struct stat st;
+      if (::fstat(fd, &st) != 0 || std::size_t(st.st_size) < sizeof(CorpusHeader))
+	{
+	  ::close(fd);
+	  fail("Not a corpus file");
+	}
+      this->m_length = st.st_size;
+      void* addr = ::mmap(nullptr, this->m_length, PROT_READ, MAP_PRIVATE,
+			  fd, 0);
+      ::close(fd);
+      if (addr == MAP_FAILED)
+	{
+	  this->m_length = 0;
+	  fail("Cannot map");
+	}
+      this->m_base = static_cast<const unsigned char*>(addr);
+      this->m_mapped = true;
+#else
+      std::ifstream file(filename, std::ios::binary | std::ios::ate);
+      if (!file)
+	fail("Cannot open");
+      this->m_length = file.tellg();
+      if (this->m_length < sizeof(CorpusHeader))
+	fail("Not a corpus file");
+      auto* buf = static_cast<unsigned char*>(
+		::operator new(this->m_length,
+			       std::align_val_t(corpus_alignment)));
+      this->m_base = buf;
+      this->m_mapped = false;
+      file.seekg(0);
+      if (!file.read(reinterpret_cast<char*>(buf), this->m_length))
+	fail("Cannot read");
+#endif
+
+      CorpusHeader header;
+      std::memcpy(&header, this->m_base, sizeof(header));
+      if (std::memcmp(header.magic, CorpusHeader::s_magic,
+		      sizeof(header.magic)) != 0)
+	fail("Not a corpus file");
+      if (header.endian_mark != CorpusHeader::s_endian_mark)
+	fail("Byte order differs");
+      if (header.version != CorpusHeader::s_version)
+	fail("Unsupported version");
+      if (header.type_code != corpus_type_code<value_type>::value
+	  || header.value_size != sizeof(value_type))
+	fail("Coefficient type differs");
+      if (header.index_offset % corpus_alignment != 0
+	  || header.index_offset > this->m_length
+	  || header.count > (this->m_length - header.index_offset)
+			    / sizeof(CorpusIndexEntry))
+	fail("Corrupt index");
+
+      this->m_index = reinterpret_cast<const CorpusIndexEntry*>(this->m_base
+							+ header.index_offset);
+      this->m_count = header.count;
+      for (size_type i = 0; i < this->m_count; ++i)
+	{
+	  const auto& entry = this->m_index[i];
+	  if (entry.size == 0
+	      || entry.offset % corpus_alignment != 0
+	      || entry.offset > header.index_offset
+	      || entry.size > (header.index_offset - entry.offset)
+			      / sizeof(value_type))
+	    fail("Corrupt index");
+	}
+    }
+
+  /**
+   * Unmap or free the file contents.
+   */
+  template<typename Tp>
+    void
+    PolynomialCorpus<Tp>::m_release() noexcept
+    {
+      if (this->m_base == nullptr)
+	return;
+#if EMSR_CORPUS_MMAP
+      if (this->m_mapped)
+	::munmap(const_cast<unsigned char*>(this->m_base), this->m_length);
+      else
+#endif
+	::operator delete(const_cast<unsigned char*>(this->m_base),
+			  std::align_val_t(corpus_alignment));
+      this->m_base = nullptr;
+      this->m_index = nullptr;
+      this->m_count = 0;
+    }
+
+} // namespace emsr
+
+#endif // POLYNOMIAL_CORPUS_TCC
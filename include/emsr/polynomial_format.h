@@ -0,0 +1,146 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file polynomial_format.h
+ *
+ * This file contains a fast, exact text formatter for polynomials.
+ */
+
+/**
+ * @def  POLYNOMIAL_FORMAT_H
+ *
+ * @brief  A guard for the polynomial formatter header.
+ */
+#ifndef POLYNOMIAL_FORMAT_H
+#define POLYNOMIAL_FORMAT_H 1
+
+#include <charconv>
+#include <string>
+
+#include <emsr/polynomial.h>
+#include <emsr/static_polynomial.h>
+#include <emsr/polynomial_view.h>
+
+namespace emsr
+{
+
+  /**
+   * The text layouts of the polynomial formatter.
+   */
+  enum class PolynomialLayout
+  {
+    /// A parenthesized comma-delimited list of coefficients,
+    /// lowest-order first, as written by operator<< and read by
+    /// operator>> and parse_polynomials.
+    list,
+    /// A sum of terms a x^n, highest-order first, omitting zero terms
+    /// and unit coefficients.
+    algebraic,
+    /// A comma-delimited row of coefficients, lowest-order first,
+    /// ending in a newline.  A complex coefficient takes two columns.
+    csv
+  };
+
+  /**
+   * Write a polynomial into the character buffer [first, last).
+   *
+   * The numbers are written with std::to_chars in the shortest form
+   * which reads back to the same value, independent of the locale.
+   * As for std::to_chars, on success the returned ptr is one past the
+   * last character written and ec is value-initialized; if the buffer
+   * is too small ptr is last, ec is std::errc::value_too_large and the
+   * contents of the buffer are unspecified.  No null is written.
+   */
+  template<typename Tp>
+    std::to_chars_result
+    format_polynomial(char* first, char* last,
+		      const PolynomialView<Tp>& poly,
+		      PolynomialLayout layout = PolynomialLayout::list,
+		      char var = 'x');
+
+  /**
+   * Write a polynomial into a character buffer.
+   */
+  template<typename Tp>
+    inline std::to_chars_result
+    format_polynomial(char* first, char* last, const Polynomial<Tp>& poly,
+		      PolynomialLayout layout = PolynomialLayout::list,
+		      char var = 'x')
+    {
+      return format_polynomial(first, last, PolynomialView<Tp>(poly),
+			       layout, var);
+    }
+
+  /**
+   * Write a static polynomial into a character buffer.
+   */
+  template<typename Tp, std::size_t Size>
+    inline std::to_chars_result
+    format_polynomial(char* first, char* last,
+		      const StaticPolynomial<Tp, Size>& poly,
+		      PolynomialLayout layout = PolynomialLayout::list,
+		      char var = 'x')
+    {
+      return format_polynomial(first, last,
+			       PolynomialView<Tp>(poly.data(), Size),
+			       layout, var);
+    }
+
+  /**
+   * Append a polynomial to a string, growing it as needed.
+   */
+  template<typename Tp>
+    void
+    format_polynomial(std::string& str, const PolynomialView<Tp>& poly,
+		      PolynomialLayout layout = PolynomialLayout::list,
+		      char var = 'x');
+
+  /**
+   * Append a polynomial to a string.
+   */
+  template<typename Tp>
+    inline void
+    format_polynomial(std::string& str, const Polynomial<Tp>& poly,
+		      PolynomialLayout layout = PolynomialLayout::list,
+		      char var = 'x')
+    { format_polynomial(str, PolynomialView<Tp>(poly), layout, var); }
+
+  /**
+   * Append a static polynomial to a string.
+   */
+  template<typename Tp, std::size_t Size>
+    inline void
+    format_polynomial(std::string& str,
+		      const StaticPolynomial<Tp, Size>& poly,
+		      PolynomialLayout layout = PolynomialLayout::list,
+		      char var = 'x')
+    {
+      format_polynomial(str, PolynomialView<Tp>(poly.data(), Size),
+			layout, var);
+    }
+
+} // namespace emsr
+
+#include <emsr/polynomial_format.tcc>
+
+#endif // POLYNOMIAL_FORMAT_H
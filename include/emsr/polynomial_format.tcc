@@ -0,0 +1,231 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file polynomial_format.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * polynomial text formatter.
+ *
+ * @see polynomial_format.h
+ */
+
+/**
+ * @def  POLYNOMIAL_FORMAT_TCC
+ *
+ * @brief  A guard for the polynomial formatter implementation header.
+ */
+#ifndef POLYNOMIAL_FORMAT_TCC
+#define POLYNOMIAL_FORMAT_TCC 1
+
+#include <system_error>
+
+namespace emsr
+{
+
+  /**
+   * A cursor into the output buffer which stops writing
+   * once the buffer is full.
+   */
+  struct FormatCursor
+  {
+    char* ptr;
+    char* last;
+    bool ok = true;
+
+    void
+    put(char c) noexcept
+    {
+      if (this->ok && this->ptr != this->last)
+	*this->ptr++ = c;
+      else
+	this->ok = false;
+    }
+
+    void
+    put(const char* s) noexcept
+    {
+      while (*s != '\0')
+	this->put(*s++);
+    }
+
+    template<typename Real>
+      void
+      number(Real x) noexcept
+      {
+	if (!this->ok)
+	  return;
+	const auto [p, ec] = std::to_chars(this->ptr, this->last, x);
+	if (ec == std::errc{})
+	  this->ptr = p;
+	else
+	  this->ok = false;
+      }
+
+    void
+    integer(std::size_t n) noexcept
+    {
+      if (!this->ok)
+	return;
+      const auto [p, ec] = std::to_chars(this->ptr, this->last, n);
+      if (ec == std::errc{})
+	this->ptr = p;
+      else
+	this->ok = false;
+    }
+
+    /// Write a coefficient; complex numbers as (re,im) or, in csv, re,im.
+    template<typename Tp>
+      void
+      coefficient(const Tp& c, bool csv) noexcept
+      {
+	if constexpr (has_imag_v<Tp>)
+	  {
+	    if (!csv)
+	      this->put('(');
+	    this->number(c.real());
+	    this->put(',');
+	    this->number(c.imag());
+	    if (!csv)
+	      this->put(')');
+	  }
+	else
+	  this->number(c);
+      }
+  };
+
+  /**
+   * Write a polynomial into a character buffer.
+   */
+  template<typename Tp>
+    std::to_chars_result
+    format_polynomial(char* first, char* last,
+		      const PolynomialView<Tp>& poly,
+		      PolynomialLayout layout, char var)
+    {
+      FormatCursor out{first, last};
+      const auto n = poly.degree();
+
+      switch (layout)
+	{
+	case PolynomialLayout::list:
+	  out.put('(');
+	  for (std::size_t i = 0; i <= n; ++i)
+	    {
+	      if (i > 0)
+		out.put(',');
+	      out.coefficient(poly[i], false);
+	    }
+	  out.put(')');
+	  break;
+
+	case PolynomialLayout::csv:
+	  for (std::size_t i = 0; i <= n; ++i)
+	    {
+	      if (i > 0)
+		out.put(',');
+	      out.coefficient(poly[i], true);
+	    }
+	  out.put('\n');
+	  break;
+
+	case PolynomialLayout::algebraic:
+	  {
+	    bool first_term = true;
+	    for (std::size_t k = n + 1; k-- > 0;)
+	      {
+		auto c = poly[k];
+		if (c == Tp{} && !(k == 0 && first_term))
+		  continue;
+
+		// Real coefficients carry their sign in the operator.
+		bool negative = false;
+		if constexpr (!has_imag_v<Tp>)
+		  if (c < Tp{})
+		    {
+		      negative = true;
+		      c = -c;
+		    }
+		if (first_term)
+		  {
+		    if (negative)
+		      out.put('-');
+		  }
+		else
+		  out.put(negative ? " - " : " + ");
+		first_term = false;
+
+		if (k == 0 || c != Tp{1})
+		  {
+		    out.coefficient(c, false);
+		    if (k > 0)
+		      out.put(' ');
+		  }
+		if (k > 0)
+		  {
+		    out.put(var);
+		    if (k > 1)
+		      {
+			out.put('^');
+			out.integer(k);
+		      }
+		  }
+	      }
+	  }
+	  break;
+	}
+
+      if (out.ok)
+	return {out.ptr, std::errc{}};
+      else
+	return {last, std::errc::value_too_large};
+    }
+
+  /**
+   * Append a polynomial to a string.
+   */
+  template<typename Tp>
+    void
+    format_polynomial(std::string& str, const PolynomialView<Tp>& poly,
+		      PolynomialLayout layout, char var)
+    {
+      // Enough for most coefficients; grow and retry otherwise.
+      const auto old_size = str.size();
+      auto cap = 32 * (poly.size() + 1);
+      while (true)
+	{
+	  str.resize(old_size + cap);
+	  const auto [ptr, ec] = format_polynomial(str.data() + old_size,
+						   str.data() + str.size(),
+						   poly, layout, var);
+	  if (ec == std::errc{})
+	    {
+	      str.resize(ptr - str.data());
+	      return;
+	    }
+	  cap *= 2;
+	}
+    }
+
+} // namespace emsr
+
+#endif // POLYNOMIAL_FORMAT_TCC
@@ -0,0 +1,182 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file polynomial_parser.h
+ *
+ * This file contains a bulk parser for polynomial text files.
+ */
+
+/**
+ * @def  POLYNOMIAL_PARSER_H
+ *
+ * @brief  A guard for the polynomial parser header.
+ */
+#ifndef POLYNOMIAL_PARSER_H
+#define POLYNOMIAL_PARSER_H 1
+
+#include <cstddef>
+#include <vector>
+
+#include <emsr/polynomial.h>
+#include <emsr/polynomial_view.h>
+
+namespace emsr
+{
+
+  /**
+   * @brief Reusable storage for a batch of parsed polynomials.
+   *
+   * The coefficients of all polynomials are kept back to back in one
+   * array in the order they were read and located through an offset
+   * array.  Clearing the arena keeps its capacity so a second batch
+   * of similar size is parsed without allocation.
+   */
+  template<typename Tp>
+    class PolynomialArena
+    {
+    public:
+      using value_type = Tp;
+      using size_type = std::size_t;
+
+      PolynomialArena()
+      : m_start(1)
+      { }
+
+      /**
+       * Remove all polynomials but keep the storage.
+       */
+      void
+      clear() noexcept
+      {
+	this->m_coeff.clear();
+	this->m_start.resize(1);
+      }
+
+      /**
+       * Reserve storage for a number of polynomials and coefficients.
+       */
+      void
+      reserve(size_type num_polys, size_type num_coeffs)
+      {
+	this->m_start.reserve(num_polys + 1);
+	this->m_coeff.reserve(num_coeffs);
+      }
+
+      /**
+       * Return the number of polynomials.
+       */
+      size_type
+      size() const noexcept
+      { return this->m_start.size() - 1; }
+
+      /**
+       * Return the number of coefficients of polynomial @c i.
+       */
+      size_type
+      size(size_type i) const noexcept
+      { return this->m_start[i + 1] - this->m_start[i]; }
+
+      /**
+       * Return the coefficients of polynomial @c i in the order read.
+       */
+      const value_type*
+      data(size_type i) const noexcept
+      { return this->m_coeff.data() + this->m_start[i]; }
+
+      /**
+       * Return a view of polynomial @c i.  The order states how
+       * the coefficients were written in the text.
+       */
+      PolynomialView<value_type>
+      view(size_type i,
+	   CoefficientOrder order = CoefficientOrder::ascending) const
+      { return PolynomialView<value_type>(this->data(i), this->size(i), order); }
+
+      /**
+       * Append a coefficient to the polynomial being read.
+       */
+      void
+      push_back(const value_type& c)
+      { this->m_coeff.push_back(c); }
+
+      /**
+       * Complete the polynomial being read.
+       */
+      void
+      finish()
+      { this->m_start.push_back(this->m_coeff.size()); }
+
+      /**
+       * Drop the coefficients of an incomplete polynomial.
+       */
+      void
+      discard() noexcept
+      { this->m_coeff.resize(this->m_start.back()); }
+
+    private:
+
+      std::vector<value_type> m_coeff;
+      std::vector<size_type> m_start;
+    };
+
+  /**
+   * Parse polynomials in the format of the stream operators into an arena.
+   *
+   * Each polynomial is a parenthesized comma-delimited list of
+   * coefficients, lowest-order first, or a plain scalar.  A complex
+   * coefficient is a scalar or a parenthesized (real,imaginary) pair.
+   * Polynomials are separated by white space.  Parsing stops at the end
+   * of the buffer or at the first token which does not start
+   * a polynomial; the position of that token is returned.
+   *
+   * The numbers are read with std::from_chars: there is no locale,
+   * no stream state and no per-coefficient allocation.
+   *
+   * @throws std::domain_error on a syntax error inside a polynomial.
+   *         The arena then holds the polynomials before it.
+   */
+  template<typename Tp>
+    const char*
+    parse_polynomials(const char* first, const char* last,
+		      PolynomialArena<Tp>& arena);
+
+  /**
+   * Parse polynomials each written as a degree n followed by
+   * n + 1 coefficients as in the solver test input files.
+   * The coefficients are stored in the order written.
+   * Parsing stops at the end of the buffer or at the first token
+   * which is not a degree; the position of that token is returned.
+   *
+   * @throws std::domain_error if a polynomial is incomplete or malformed.
+   *         The arena then holds the polynomials before it.
+   */
+  template<typename Tp>
+    const char*
+    parse_counted_polynomials(const char* first, const char* last,
+			      PolynomialArena<Tp>& arena);
+
+} // namespace emsr
+
+#include <emsr/polynomial_parser.tcc>
+
+#endif // POLYNOMIAL_PARSER_H
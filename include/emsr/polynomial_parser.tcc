@@ -0,0 +1,218 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file polynomial_parser.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * polynomial text parser.
+ *
+ * @see polynomial_parser.h
+ */
+
+/**
+ * @def  POLYNOMIAL_PARSER_TCC
+ *
+ * @brief  A guard for the polynomial parser implementation header.
+ */
+#ifndef POLYNOMIAL_PARSER_TCC
+#define POLYNOMIAL_PARSER_TCC 1
+
+#include <charconv>
+#include <string>
+#include <stdexcept>
+#include <system_error>
+
+namespace emsr
+{
+
+  /**
+   * Return the first character at or after p which is not white space.
+   */
+  inline const char*
+  parse_skip_space(const char* p, const char* last) noexcept
+  {
+    while (p != last
+	   && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'
+	       || *p == '\f' || *p == '\v'))
+      ++p;
+    return p;
+  }
+
+  /**
+   * Read a real number with an optional leading plus sign.
+   * Return the position after it or nullptr if there is no number.
+   */
+  template<typename Real>
+    const char*
+    parse_real(const char* p, const char* last, Real& x)
+    {
+      p = parse_skip_space(p, last);
+      if (p != last && *p == '+')
+	++p;
+      const auto [ptr, ec] = std::from_chars(p, last, x);
+      if (ec != std::errc{})
+	return nullptr;
+      return ptr;
+    }
+
+  /**
+   * Read a coefficient: a real number or, for complex types,
+   * also a parenthesized (real,imaginary) pair.
+   * Return the position after it or nullptr on error.
+   */
+  template<typename Tp>
+    const char*
+    parse_coefficient(const char* p, const char* last, Tp& c)
+    {
+      if constexpr (has_imag_v<Tp>)
+	{
+	  using Real = typename Tp::value_type;
+	  Real re{}, im{};
+	  p = parse_skip_space(p, last);
+	  if (p != last && *p == '(')
+	    {
+	      p = parse_real(p + 1, last, re);
+	      if (p == nullptr)
+		return nullptr;
+	      p = parse_skip_space(p, last);
+	      if (p == last || *p != ',')
+		return nullptr;
+	      p = parse_real(p + 1, last, im);
+	      if (p == nullptr)
+		return nullptr;
+	      p = parse_skip_space(p, last);
+	      if (p == last || *p != ')')
+		return nullptr;
+	      ++p;
+	    }
+	  else if (p = parse_real(p, last, re); p == nullptr)
+	    return nullptr;
+	  c = Tp(re, im);
+	  return p;
+	}
+      else
+	return parse_real(p, last, c);
+    }
+
+  /**
+   * Throw a syntax error at an offset into the buffer.
+   */
+  [[noreturn]] inline void
+  parse_error(const char* func, const char* first, const char* p)
+  {
+    throw std::domain_error(std::string(func) + ": Syntax error at offset "
+			    + std::to_string(p - first));
+  }
+
+  /**
+   * Parse polynomials in the format of the stream operators.
+   */
+  template<typename Tp>
+    const char*
+    parse_polynomials(const char* first, const char* last,
+		      PolynomialArena<Tp>& arena)
+    {
+      const auto fail = [first, &arena](const char* p)
+	{
+	  arena.discard();
+	  parse_error("parse_polynomials", first, p);
+	};
+
+      auto p = parse_skip_space(first, last);
+      while (p != last)
+	{
+	  Tp c;
+	  if (*p == '(')
+	    {
+	      auto q = p + 1;
+	      while (true)
+		{
+		  q = parse_coefficient(q, last, c);
+		  if (q == nullptr)
+		    fail(p);
+		  arena.push_back(c);
+		  q = parse_skip_space(q, last);
+		  if (q == last)
+		    fail(p);
+		  if (*q == ')')
+		    break;
+		  if (*q != ',')
+		    fail(q);
+		  ++q;
+		}
+	      p = q + 1;
+	    }
+	  else
+	    {
+	      // A real scalar; anything else ends the input.
+	      real_type_t<Tp> x;
+	      const auto q = parse_real(p, last, x);
+	      if (q == nullptr)
+		return p;
+	      arena.push_back(Tp(x));
+	      p = q;
+	    }
+	  arena.finish();
+	  p = parse_skip_space(p, last);
+	}
+      return p;
+    }
+
+  /**
+   * Parse polynomials written as a degree and the coefficients.
+   */
+  template<typename Tp>
+    const char*
+    parse_counted_polynomials(const char* first, const char* last,
+			      PolynomialArena<Tp>& arena)
+    {
+      auto p = parse_skip_space(first, last);
+      while (p != last)
+	{
+	  std::size_t degree;
+	  const auto [q, ec] = std::from_chars(p, last, degree);
+	  if (ec != std::errc{} || (q != last && *q == '.'))
+	    return p;
+	  auto r = q;
+	  for (std::size_t i = 0; i <= degree; ++i)
+	    {
+	      Tp c;
+	      const auto s = parse_coefficient(r, last, c);
+	      if (s == nullptr)
+		{
+		  arena.discard();
+		  parse_error("parse_counted_polynomials", first,
+			      parse_skip_space(r, last));
+		}
+	      arena.push_back(c);
+	      r = s;
+	    }
+	  arena.finish();
+	  p = parse_skip_space(r, last);
+	}
+      return p;
+    }
+
+} // namespace emsr
+
+#endif // POLYNOMIAL_PARSER_TCC
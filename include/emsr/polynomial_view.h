@@ -0,0 +1,234 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file polynomial_view.h
+ *
+ * This file contains a non-owning view of polynomial coefficients
+ * held in external memory.
+ */
+
+/**
+ * @def  POLYNOMIAL_VIEW_H
+ *
+ * @brief  A guard for the polynomial view header.
+ */
+#ifndef POLYNOMIAL_VIEW_H
+#define POLYNOMIAL_VIEW_H 1
+
+#include <cstddef>
+#include <vector>
+#include <iterator> // For reverse_iterator.
+#include <stdexcept>
+
+#include <emsr/polynomial.h>
+
+namespace emsr
+{
+
+  /**
+   * The storage order of a coefficient array.
+   * Ascending is lowest-order first as in Polynomial; descending is
+   * highest-order first as taken by the Jenkins-Traub solvers.
+   */
+  enum class CoefficientOrder
+  {
+    ascending,
+    descending
+  };
+
+  /**
+   * @brief A non-owning view of the coefficients of a polynomial
+   * in an array of either storage order.
+   *
+   * This is a pointer and a size in the manner of C and Fortran
+   * interfaces.  The viewed memory must outlive the view.
+   * Coefficient i is always that of x^i whatever the storage order.
+   */
+  template<typename Tp>
+    class PolynomialView
+    {
+    public:
+      using value_type = Tp;
+      using size_type = std::size_t;
+      using real_type = real_type_t<Tp>;
+
+      /**
+       * View an array of size coefficients.
+       *
+       * @throws std::domain_error if size is zero.
+       */
+      PolynomialView(const value_type* coeff, size_type size,
+		     CoefficientOrder order = CoefficientOrder::ascending)
+      : m_data(coeff), m_size(size), m_order(order)
+      {
+	if (size == 0)
+	  throw std::domain_error("PolynomialView: No coefficients");
+      }
+
+      /**
+       * View a vector of coefficients.
+       */
+      PolynomialView(const std::vector<value_type>& coeff,
+		     CoefficientOrder order = CoefficientOrder::ascending)
+      : PolynomialView(coeff.data(), coeff.size(), order)
+      { }
+
+      /**
+       * View the coefficients of a polynomial.
+       */
+      PolynomialView(const Polynomial<value_type>& poly)
+      : m_data(poly.data()), m_size(poly.degree() + 1),
+	m_order(CoefficientOrder::ascending)
+      { }
+
+      /**
+       * Return the number of coefficients.
+       */
+      size_type
+      size() const noexcept
+      { return this->m_size; }
+
+      /**
+       * Return the degree.
+       */
+      size_type
+      degree() const noexcept
+      { return this->m_size - 1; }
+
+      /**
+       * Return the storage order.
+       */
+      CoefficientOrder
+      order() const noexcept
+      { return this->m_order; }
+
+      /**
+       * Return a pointer to the viewed array.
+       */
+      const value_type*
+      data() const noexcept
+      { return this->m_data; }
+
+      /**
+       * Return the coefficient of x^i.
+       */
+      value_type
+      operator[](size_type i) const noexcept
+      {
+	return this->m_order == CoefficientOrder::ascending
+	     ? this->m_data[i]
+	     : this->m_data[this->m_size - 1 - i];
+      }
+
+      /**
+       * Return the coefficient of x^i.
+       */
+      value_type
+      coefficient(size_type i) const noexcept
+      { return (*this)[i]; }
+
+      /**
+       * Evaluate the polynomial at the input point by Horner's rule
+       * running through the array in storage order.
+       */
+      template<typename Up>
+	auto
+	operator()(Up x) const
+	-> decltype(value_type{} * Up{})
+	{
+	  const auto n = this->degree();
+	  auto poly = Up{1} * (*this)[n];
+	  if (this->m_order == CoefficientOrder::ascending)
+	    for (size_type i = n; i-- > 0;)
+	      poly = poly * x + this->m_data[i];
+	  else
+	    for (size_type i = 1; i <= n; ++i)
+	      poly = poly * x + this->m_data[i];
+	  return poly;
+	}
+
+      /**
+       * Return the coefficients as a vector in the given storage order.
+       */
+      std::vector<value_type>
+      to_vector(CoefficientOrder order = CoefficientOrder::ascending) const
+      {
+	if (order == this->m_order)
+	  return std::vector<value_type>(this->m_data,
+					 this->m_data + this->m_size);
+	else
+	  return std::vector<value_type>(
+		std::reverse_iterator<const value_type*>(this->m_data
+							 + this->m_size),
+		std::reverse_iterator<const value_type*>(this->m_data));
+      }
+
+      /**
+       * Return an owning copy of the polynomial.
+       */
+      Polynomial<value_type>
+      polynomial() const
+      {
+	const auto a = this->to_vector(CoefficientOrder::ascending);
+	return Polynomial<value_type>(a.begin(), a.end());
+      }
+
+      /**
+       * Return the derivative polynomial.
+       */
+      Polynomial<value_type>
+      derivative() const
+      {
+	const auto n = this->degree();
+	if (n == 0)
+	  return Polynomial<value_type>(value_type{});
+	Polynomial<value_type> dp(value_type{}, n - 1);
+	for (size_type i = 1; i <= n; ++i)
+	  dp[i - 1] = real_type(i) * (*this)[i];
+	return dp;
+      }
+
+      /**
+       * Return the integral polynomial with given integration constant.
+       */
+      Polynomial<value_type>
+      integral(value_type c = value_type{}) const
+      {
+	const auto n = this->degree();
+	Polynomial<value_type> ip(value_type{}, n + 1);
+	ip[0] = c;
+	for (size_type i = 0; i <= n; ++i)
+	  ip[i + 1] = (*this)[i] / real_type(i + 1);
+	return ip;
+      }
+
+    private:
+
+      const value_type* m_data;
+      size_type m_size;
+      CoefficientOrder m_order;
+    };
+
+} // namespace emsr
+
+#endif // POLYNOMIAL_VIEW_H
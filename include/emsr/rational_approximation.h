@@ -0,0 +1,201 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file rational_approximation.h
+ *
+ * This file contains builders for Padé and minimax rational approximations.
+ * @see rational_polynomial.h
+ */
+
+/**
+ * @def  RATIONAL_APPROXIMATION_H
+ *
+ * @brief  A guard for the rational approximation header.
+ */
+#ifndef RATIONAL_APPROXIMATION_H
+#define RATIONAL_APPROXIMATION_H 1
+
+#include <vector>
+#include <string>
+#include <utility> // For pair.
+#include <iosfwd>
+
+#include <emsr/rational_polynomial.h>
+#include <emsr/static_polynomial.h>
+#include <emsr/chebyshev_polynomial.h>
+
+namespace emsr
+{
+
+  /**
+   * Solve the Toeplitz system
+   * @f[
+   *    \sum_{j=0}^{N-1} r_{N-1+i-j} x_j = y_i,\quad i = 0, ..., N-1
+   * @f]
+   * by the Levinson recursion in O(N^2) operations.
+   * The vector r has the 2N-1 diagonals of the matrix starting with the
+   * lower left corner.  The matrix need not be symmetric.
+   *
+   * Returns false if a leading principal minor is singular
+   * in which case the recursion breaks down and the contents
+   * of x are unspecified.
+   */
+  template<typename Tp>
+    bool
+    toeplitz_solve(const std::vector<Tp>& r, const std::vector<Tp>& y,
+		   std::vector<Tp>& x);
+
+  /**
+   * Solve the dense system A x = b by LU decomposition
+   * with partial pivoting.  The matrix is N x N stored by rows
+   * and is overwritten.
+   *
+   * Returns false if the matrix is singular.
+   */
+  template<typename Tp>
+    bool
+    lu_solve(std::vector<Tp>& a, std::vector<Tp>& b, std::vector<Tp>& x);
+
+  /**
+   * Solve the overdetermined system A x = b with M rows and N <= M
+   * columns in the least squares sense by Householder QR decomposition.
+   * The matrix is M x N stored by rows; it and b are overwritten.
+   *
+   * Returns false if the matrix is rank deficient to working precision.
+   */
+  template<typename Tp>
+    bool
+    qr_least_squares(std::vector<Tp>& a, std::vector<Tp>& b,
+		     std::vector<Tp>& x);
+
+  /**
+   * Return the [m/n] Padé approximant of a function whose Taylor series
+   * coefficients are those of the polynomial @c taylor.
+   * Coefficients beyond the degree of @c taylor are taken to be zero.
+   * The denominator is normalized so that its constant term is one.
+   *
+   * The denominator is found by solving the Toeplitz system for the
+   * vanishing series coefficients of order m+1 through m+n
+   * by the Levinson recursion.  If a leading minor of that system is
+   * singular, as happens for example when the series has zero coefficients
+   * in a regular pattern, the system is solved by LU decomposition instead.
+   *
+   * @throws std::domain_error if the Padé system is singular.
+   */
+  template<typename Tp>
+    RationalPolynomial<Tp>
+    pade(const Polynomial<Tp>& taylor, unsigned int m, unsigned int n);
+
+  /**
+   * The result of a minimax rational approximation.
+   */
+  template<typename Tp>
+    struct MinimaxApproximant
+    {
+      /// The rational approximation.
+      RationalPolynomial<Tp> approx;
+
+      /// The largest absolute error of the returned approximation
+      /// found on the interval.
+      Tp max_error = Tp{0};
+
+      /// The number of Remez exchanges taken.
+      int num_iters = 0;
+
+      /// True if the error equioscillated to within the requested tolerance.
+      bool converged = false;
+    };
+
+  /**
+   * Return the [m/n] minimax rational approximation to a function
+   * on the interval [a, b] using the Remez exchange algorithm.
+   *
+   * The fit is done in the variable t = (2x - a - b)/(b - a) on [-1, 1]
+   * with the numerator and denominator in the Chebyshev basis, which is
+   * well conditioned there, and the result is transformed back to x.
+   * The iteration starts from the linearized least squares fit
+   * of p - f q at the Chebyshev points, a discrete Chebyshev-Padé
+   * approximation, lowering the denominator degree if that fit has
+   * poles in the interval.  The leveled reference system has m + n + 2
+   * unknowns and is solved by LU decomposition, iterating on the
+   * leveled error that multiplies the denominator.
+   *
+   * All the points of the reference are exchanged when the error has
+   * enough alternating extrema.  Otherwise the point of largest error
+   * alone is exchanged into the reference keeping the alternation.
+   * The iteration stops when the error is leveled to within tol or is
+   * at the rounding level of the function values.  If the reference
+   * system becomes singular or the denominator acquires a zero in the
+   * interval the best approximation found so far is returned
+   * unconverged.  This happens at high degree when the error nears the
+   * rounding level of the denominator in the Chebyshev basis, as for
+   * functions with singularities close to an end of the interval.
+   *
+   * A function symmetric about the midpoint of the interval has a best
+   * approximation that equioscillates at more points than the degrees
+   * require and the reference system can be degenerate.  Fit an even
+   * function f(x) on [0, b] as g(u) = f(sqrt(u)) on [0, b^2] instead.
+   *
+   * @param  func      The function to approximate.
+   * @param  a         The lower limit of the interval.
+   * @param  b         The upper limit of the interval.
+   * @param  m         The degree of the numerator.
+   * @param  n         The degree of the denominator.
+   * @param  tol       The relative tolerance on the leveling of the error.
+   * @param  max_iter  The maximum number of exchanges.
+   *
+   * @throws std::domain_error if the interval is empty.
+   * @throws std::runtime_error if not even a polynomial starting
+   *         approximation can be fit.
+   */
+  template<typename Tp, typename Func>
+    MinimaxApproximant<Tp>
+    minimax(Func func, Tp a, Tp b, unsigned int m, unsigned int n,
+	    Tp tol = Tp{1.0e-6}, int max_iter = 100);
+
+  /**
+   * Return the numerator and denominator of a rational polynomial
+   * as static polynomials suitable for constant expressions.
+   *
+   * @throws std::domain_error if either degree will not fit.
+   */
+  template<std::size_t SizeN, std::size_t SizeD, typename Tp>
+    std::pair<StaticPolynomial<Tp, SizeN>, StaticPolynomial<Tp, SizeD>>
+    to_static(const RationalPolynomial<Tp>& rat);
+
+  /**
+   * Write C++ source defining constexpr static polynomials for the
+   * numerator and denominator of a rational polynomial.
+   * The definitions are named name_num and name_den.
+   * The coefficients are written with enough digits to round trip.
+   */
+  template<typename CharT, typename Traits, typename Tp>
+    std::basic_ostream<CharT, Traits>&
+    write_static(std::basic_ostream<CharT, Traits>& os,
+		 const RationalPolynomial<Tp>& rat, const std::string& name);
+
+} // namespace emsr
+
+#include <emsr/rational_approximation.tcc>
+
+#endif // RATIONAL_APPROXIMATION_H
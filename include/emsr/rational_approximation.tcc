@@ -0,0 +1,775 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file rational_approximation.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * rational approximation builders.
+ *
+ * @see rational_approximation.h
+ */
+
+/**
+ * @def  RATIONAL_APPROXIMATION_TCC
+ *
+ * @brief  A guard for the rational approximation implementation header.
+ */
+#ifndef RATIONAL_APPROXIMATION_TCC
+#define RATIONAL_APPROXIMATION_TCC 1
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <ios>
+#include <ostream>
+
+namespace emsr
+{
+
+  /**
+   * Solve a general Toeplitz system by the Levinson recursion.
+   *
+   * The forward and backward solutions g and h of the growing
+   * leading subsystems are updated together with the solution x.
+   */
+  template<typename Tp>
+    bool
+    toeplitz_solve(const std::vector<Tp>& r, const std::vector<Tp>& y,
+		   std::vector<Tp>& x)
+    {
+      const auto n = y.size();
+      x.assign(n, Tp{0});
+      if (n == 0)
+	return true;
+
+      // r(k) with k in [-(n-1), n-1] is the diagonal k below the main one.
+      const auto rr = [&r, n](std::ptrdiff_t k) -> const Tp&
+		      { return r[n - 1 + k]; };
+
+      if (rr(0) == Tp{0})
+	return false;
+      x[0] = y[0] / rr(0);
+      if (n == 1)
+	return true;
+
+      std::vector<Tp> g(n - 1), h(n - 1);
+      g[0] = rr(-1) / rr(0);
+      h[0] = rr(1) / rr(0);
+
+      for (std::size_t m = 1; m < n; ++m)
+	{
+	  // Extend the solution to order m + 1.
+	  auto sxn = -y[m];
+	  auto sd = -rr(0);
+	  for (std::size_t j = 0; j < m; ++j)
+	    {
+	      sxn += rr(m - j) * x[j];
+	      sd += rr(m - j) * g[m - 1 - j];
+	    }
+	  if (sd == Tp{0})
+	    return false;
+	  x[m] = sxn / sd;
+	  for (std::size_t j = 0; j < m; ++j)
+	    x[j] -= x[m] * g[m - 1 - j];
+	  if (m + 1 == n)
+	    return true;
+
+	  // Extend the forward and backward solutions to order m + 1.
+	  auto sgn = -rr(-std::ptrdiff_t(m + 1));
+	  auto shn = -rr(m + 1);
+	  auto sgd = -rr(0);
+	  for (std::size_t j = 0; j < m; ++j)
+	    {
+	      sgn += rr(std::ptrdiff_t(j) - std::ptrdiff_t(m)) * g[j];
+	      shn += rr(m - j) * h[j];
+	      sgd += rr(std::ptrdiff_t(j) - std::ptrdiff_t(m)) * h[m - 1 - j];
+	    }
+	  if (sgd == Tp{0})
+	    return false;
+	  g[m] = sgn / sgd;
+	  h[m] = shn / sd;
+
+	  const auto gm = g[m];
+	  const auto hm = h[m];
+	  for (std::size_t j = 0, k = m - 1; j < (m + 1) / 2; ++j, --k)
+	    {
+	      const auto gj = g[j], gk = g[k];
+	      const auto hj = h[j], hk = h[k];
+	      g[j] = gj - gm * hk;
+	      g[k] = gk - gm * hj;
+	      h[j] = hj - hm * gk;
+	      h[k] = hk - hm * gj;
+	    }
+	}
+
+      return true;
+    }
+
+  /**
+   * Solve a dense system by LU decomposition with partial pivoting.
+   */
+  template<typename Tp>
+    bool
+    lu_solve(std::vector<Tp>& a, std::vector<Tp>& b, std::vector<Tp>& x)
+    {
+      const auto n = b.size();
+      for (std::size_t k = 0; k < n; ++k)
+	{
+	  auto piv = k;
+	  for (std::size_t i = k + 1; i < n; ++i)
+	    if (std::abs(a[i * n + k]) > std::abs(a[piv * n + k]))
+	      piv = i;
+	  if (a[piv * n + k] == Tp{0})
+	    return false;
+	  if (piv != k)
+	    {
+	      for (std::size_t j = 0; j < n; ++j)
+		std::swap(a[k * n + j], a[piv * n + j]);
+	      std::swap(b[k], b[piv]);
+	    }
+	  for (std::size_t i = k + 1; i < n; ++i)
+	    {
+	      const auto l = a[i * n + k] / a[k * n + k];
+	      for (std::size_t j = k + 1; j < n; ++j)
+		a[i * n + j] -= l * a[k * n + j];
+	      b[i] -= l * b[k];
+	    }
+	}
+
+      x.assign(n, Tp{0});
+      for (std::size_t i = n; i-- > 0;)
+	{
+	  auto sum = b[i];
+	  for (std::size_t j = i + 1; j < n; ++j)
+	    sum -= a[i * n + j] * x[j];
+	  x[i] = sum / a[i * n + i];
+	}
+
+      return true;
+    }
+
+  /**
+   * Solve an overdetermined system in the least squares sense
+   * by Householder QR decomposition.
+   */
+  template<typename Tp>
+    bool
+    qr_least_squares(std::vector<Tp>& a, std::vector<Tp>& b,
+		     std::vector<Tp>& x)
+    {
+      const auto rows = b.size();
+      const auto cols = rows == 0 ? 0 : a.size() / rows;
+      if (cols > rows)
+	return false;
+
+      auto rmax = Tp{0};
+      for (std::size_t k = 0; k < cols; ++k)
+	{
+	  auto norm = Tp{0};
+	  for (std::size_t i = k; i < rows; ++i)
+	    norm = std::hypot(norm, a[i * cols + k]);
+	  if (norm == Tp{0})
+	    return false;
+	  const auto alpha = a[k * cols + k] > Tp{0} ? -norm : norm;
+
+	  // The reflector is v = x - alpha e_k stored in place of x.
+	  a[k * cols + k] -= alpha;
+	  const auto vnorm2 = -alpha * a[k * cols + k];
+	  for (std::size_t j = k + 1; j < cols; ++j)
+	    {
+	      auto dot = Tp{0};
+	      for (std::size_t i = k; i < rows; ++i)
+		dot += a[i * cols + k] * a[i * cols + j];
+	      const auto s = dot / vnorm2;
+	      for (std::size_t i = k; i < rows; ++i)
+		a[i * cols + j] -= s * a[i * cols + k];
+	    }
+	  auto dot = Tp{0};
+	  for (std::size_t i = k; i < rows; ++i)
+	    dot += a[i * cols + k] * b[i];
+	  const auto s = dot / vnorm2;
+	  for (std::size_t i = k; i < rows; ++i)
+	    b[i] -= s * a[i * cols + k];
+
+	  a[k * cols + k] = alpha;
+	  rmax = std::max(rmax, std::abs(alpha));
+	}
+
+      const auto small = Tp(cols) * std::numeric_limits<Tp>::epsilon() * rmax;
+      x.assign(cols, Tp{0});
+      for (std::size_t i = cols; i-- > 0;)
+	{
+	  if (std::abs(a[i * cols + i]) <= small)
+	    return false;
+	  auto sum = b[i];
+	  for (std::size_t j = i + 1; j < cols; ++j)
+	    sum -= a[i * cols + j] * x[j];
+	  x[i] = sum / a[i * cols + i];
+	}
+
+      return true;
+    }
+
+  /**
+   * Return the [m/n] Padé approximant of a Taylor series.
+   */
+  template<typename Tp>
+    RationalPolynomial<Tp>
+    pade(const Polynomial<Tp>& taylor, unsigned int m, unsigned int n)
+    {
+      const auto c = [&taylor](std::ptrdiff_t k)
+		     {
+		       return k < 0 || std::size_t(k) > taylor.degree()
+			    ? Tp{0}
+			    : taylor[k];
+		     };
+
+      std::vector<Tp> q(n + 1);
+      q[0] = Tp{1};
+      if (n > 0)
+	{
+	  // Row i is the coefficient of x^(m+1+i) and column j is q_(j+1).
+	  std::vector<Tp> r(2 * n - 1), y(n), x;
+	  for (std::size_t s = 0; s < r.size(); ++s)
+	    r[s] = c(std::ptrdiff_t(m + s) - std::ptrdiff_t(n - 1));
+	  for (std::size_t i = 0; i < n; ++i)
+	    y[i] = -c(m + 1 + i);
+
+	  if (!toeplitz_solve(r, y, x))
+	    {
+	      std::vector<Tp> mat(n * n);
+	      for (std::size_t i = 0; i < n; ++i)
+		for (std::size_t j = 0; j < n; ++j)
+		  mat[i * n + j] = r[n - 1 + i - j];
+	      if (!lu_solve(mat, y, x))
+		throw std::domain_error("pade: Singular Padé system");
+	    }
+	  std::copy(x.begin(), x.end(), q.begin() + 1);
+	}
+
+      std::vector<Tp> p(m + 1);
+      for (std::size_t k = 0; k <= m; ++k)
+	{
+	  auto sum = Tp{0};
+	  for (std::size_t j = 0; j <= std::min<std::size_t>(k, n); ++j)
+	    sum += q[j] * c(k - j);
+	  p[k] = sum;
+	}
+
+      return RationalPolynomial<Tp>(Polynomial<Tp>(p.begin(), p.end()),
+				    Polynomial<Tp>(q.begin(), q.end()));
+    }
+
+  /**
+   * Fill a row with the Chebyshev polynomials T_0(t), ..., T_n(t).
+   */
+  template<typename Tp>
+    void
+    chebyshev_row(Tp t, std::size_t n, Tp* row)
+    {
+      row[0] = Tp{1};
+      if (n > 0)
+	row[1] = t;
+      for (std::size_t k = 2; k <= n; ++k)
+	row[k] = Tp{2} * t * row[k - 1] - row[k - 2];
+    }
+
+  /**
+   * Fit p(t)/q(t) to f(t) in the least squares sense at the Chebyshev
+   * points with p and q in the Chebyshev basis and the constant
+   * coefficient of q equal to one.  The linearized residual
+   * p(t) - f(t) q(t) is weighted by the reciprocal of the previous
+   * denominator (the Sanathanan-Koerner iteration) starting from
+   * the unweighted fit, a discrete form of the Chebyshev-Padé
+   * approximation.  This is the starting guess for the Remez iteration.
+   *
+   * Returns false if the system is rank deficient or the denominator
+   * is not positive at the points.
+   */
+  template<typename Tp>
+    bool
+    minimax_initial(const std::vector<Tp>& tp, const std::vector<Tp>& fp,
+		    unsigned int m, unsigned int n,
+		    ChebyshevPolynomial<Tp>& p, ChebyshevPolynomial<Tp>& q)
+    {
+      const auto rows = tp.size();
+      const std::size_t cols = m + 1 + n;
+      std::vector<Tp> wt(rows, Tp{1}), sol, row(std::max(m, n) + 1);
+      for (int iter = 0; iter < (n == 0 ? 1 : 6); ++iter)
+	{
+	  std::vector<Tp> mat(rows * cols), rhs(rows);
+	  for (std::size_t j = 0; j < rows; ++j)
+	    {
+	      chebyshev_row(tp[j], std::max(m, n), row.data());
+	      auto r = mat.begin() + j * cols;
+	      for (std::size_t k = 0; k <= m; ++k)
+		r[k] = wt[j] * row[k];
+	      for (std::size_t k = 1; k <= n; ++k)
+		r[m + k] = -wt[j] * fp[j] * row[k];
+	      rhs[j] = wt[j] * fp[j];
+	    }
+	  if (!qr_least_squares(mat, rhs, sol))
+	    return false;
+
+	  p = ChebyshevPolynomial<Tp>(sol.begin(), sol.begin() + m + 1);
+	  q = ChebyshevPolynomial<Tp>(Tp{0}, n);
+	  q[0] = Tp{1};
+	  for (std::size_t k = 1; k <= n; ++k)
+	    q[k] = sol[m + k];
+	  for (std::size_t j = 0; j < rows; ++j)
+	    {
+	      const auto qj = q(tp[j]);
+	      if (!(qj > Tp{0}))
+		return false;
+	      wt[j] = Tp{1} / qj;
+	    }
+	}
+      return true;
+    }
+
+  /**
+   * Exchange one point of a reference for a new extremum of the error
+   * keeping the signs of the error alternating on the reference.
+   * The reference is sorted and rerr holds the errors on it.
+   */
+  template<typename Tp>
+    void
+    minimax_exchange(std::vector<Tp>& ref, std::vector<Tp>& rerr,
+		     Tp tnew, Tp enew)
+    {
+      const auto same = [enew](Tp e)
+			{ return std::signbit(e) == std::signbit(enew); };
+      const auto j = std::size_t(std::upper_bound(ref.begin(), ref.end(),
+						  tnew) - ref.begin());
+      const auto last = ref.size() - 1;
+      if (j == 0)
+	{
+	  if (!same(rerr[0]))
+	    {
+	      std::rotate(ref.rbegin(), ref.rbegin() + 1, ref.rend());
+	      std::rotate(rerr.rbegin(), rerr.rbegin() + 1, rerr.rend());
+	    }
+	  ref[0] = tnew;
+	  rerr[0] = enew;
+	}
+      else if (j > last)
+	{
+	  if (!same(rerr[last]))
+	    {
+	      std::rotate(ref.begin(), ref.begin() + 1, ref.end());
+	      std::rotate(rerr.begin(), rerr.begin() + 1, rerr.end());
+	    }
+	  ref[last] = tnew;
+	  rerr[last] = enew;
+	}
+      else
+	{
+	  const auto k = same(rerr[j - 1]) ? j - 1 : j;
+	  ref[k] = tnew;
+	  rerr[k] = enew;
+	}
+    }
+
+  /**
+   * Return the [m/n] minimax rational approximation to a function
+   * on an interval by the Remez exchange algorithm.
+   */
+  template<typename Tp, typename Func>
+    MinimaxApproximant<Tp>
+    minimax(Func func, Tp a, Tp b, unsigned int m, unsigned int n,
+	    Tp tol, int max_iter)
+    {
+      if (!(a < b))
+	throw std::domain_error("minimax: Empty interval");
+
+      const auto s_pi = Tp(3.1415926535897932384626433832795029L);
+      const auto s_eps = std::numeric_limits<Tp>::epsilon();
+      const auto s_gold = (std::sqrt(Tp{5}) - Tp{1}) / Tp{2};
+      const auto mid = (a + b) / Tp{2};
+      const auto half = (b - a) / Tp{2};
+      const auto f = [&func, mid, half](Tp t) -> Tp
+		     { return func(mid + half * t); };
+
+      const std::size_t num_ref = m + n + 2;
+      const std::size_t num_grid = 64 * num_ref + 1;
+
+      // The error is sampled on a fixed Chebyshev grid.
+      std::vector<Tp> tg(num_grid), fg(num_grid), eg(num_grid);
+      auto fscale = std::numeric_limits<Tp>::min();
+      for (std::size_t g = 0; g < num_grid; ++g)
+	{
+	  tg[g] = -std::cos(s_pi * Tp(g) / Tp(num_grid - 1));
+	  fg[g] = f(tg[g]);
+	  fscale = std::max(fscale, std::abs(fg[g]));
+	}
+      // Below this the error is rounding noise and cannot be leveled.
+      const auto noise = Tp{64} * s_eps * fscale;
+
+      ChebyshevPolynomial<Tp> p, q;
+      const auto err = [&f, &p, &q](Tp t) { return f(t) - p(t) / q(t); };
+
+      // Sample the error and return false if the denominator
+      // is not positive.  Also estimate the rounding error in p/q
+      // which bounds how well the error can be leveled.
+      auto pq_noise = noise;
+      const auto sample = [&]()
+      {
+	auto qmin = std::numeric_limits<Tp>::max();
+	for (std::size_t g = 0; g < num_grid; ++g)
+	  {
+	    const auto qg = q(tg[g]);
+	    if (!(qg > Tp{0}))
+	      return false;
+	    qmin = std::min(qmin, qg);
+	    eg[g] = fg[g] - p(tg[g]) / qg;
+	  }
+	auto psum = Tp{0}, qsum = Tp{0};
+	for (const auto& c : p)
+	  psum += std::abs(c);
+	for (const auto& c : q)
+	  qsum += std::abs(c);
+	pq_noise = std::max(noise, s_eps * (psum + fscale * qsum) / qmin);
+	return true;
+      };
+
+      // Return the extremum of each run of one sign of the error
+      // refined by golden section search.
+      std::vector<Tp> text, eext;
+      const auto extrema = [&]()
+      {
+	std::vector<std::size_t> ext;
+	for (std::size_t g = 0; g < num_grid; ++g)
+	  {
+	    if (!ext.empty()
+	     && std::signbit(eg[g]) == std::signbit(eg[ext.back()]))
+	      {
+		if (std::abs(eg[g]) > std::abs(eg[ext.back()]))
+		  ext.back() = g;
+	      }
+	    else
+	      ext.push_back(g);
+	  }
+
+	text.resize(ext.size());
+	eext.resize(ext.size());
+	for (std::size_t k = 0; k < ext.size(); ++k)
+	  {
+	    const auto g = ext[k];
+	    text[k] = tg[g];
+	    eext[k] = eg[g];
+	    if (g == 0 || g == num_grid - 1)
+	      continue;
+	    const auto sgn = eg[g] < Tp{0} ? Tp{-1} : Tp{1};
+	    auto lo = tg[g - 1], hi = tg[g + 1];
+	    auto t1 = hi - s_gold * (hi - lo), t2 = lo + s_gold * (hi - lo);
+	    auto e1 = sgn * err(t1), e2 = sgn * err(t2);
+	    for (int it = 0; it < 40 && hi - lo > s_eps; ++it)
+	      {
+		if (e1 > e2)
+		  {
+		    hi = t2;
+		    t2 = t1;
+		    e2 = e1;
+		    t1 = hi - s_gold * (hi - lo);
+		    e1 = sgn * err(t1);
+		  }
+		else
+		  {
+		    lo = t1;
+		    t1 = t2;
+		    e1 = e2;
+		    t2 = lo + s_gold * (hi - lo);
+		    e2 = sgn * err(t2);
+		  }
+	      }
+	    const auto tm = (lo + hi) / Tp{2};
+	    const auto em = err(tm);
+	    if (std::abs(em) > std::abs(eext[k]))
+	      {
+		text[k] = tm;
+		eext[k] = em;
+	      }
+	  }
+
+	auto emax = Tp{0};
+	for (const auto& e : eext)
+	  emax = std::max(emax, std::abs(e));
+	return emax;
+      };
+
+      // Start from the linearized least squares fit at the Chebyshev
+      // points.  If it has spurious poles or the denominator degree is
+      // too high to be determined, lower the denominator degree.
+      {
+	const std::size_t num_fit = 8 * num_ref;
+	std::vector<Tp> tp(num_fit), fp(num_fit);
+	for (std::size_t j = 0; j < num_fit; ++j)
+	  {
+	    tp[j] = -std::cos(s_pi * (Tp(j) + Tp{0.5}) / Tp(num_fit));
+	    fp[j] = f(tp[j]);
+	  }
+	bool ok = false;
+	for (auto k = n; !ok; --k)
+	  {
+	    ok = minimax_initial(tp, fp, m, k, p, q) && sample();
+	    if (k == 0)
+	      break;
+	  }
+	if (!ok)
+	  throw std::runtime_error("minimax: No starting approximation");
+      }
+
+      MinimaxApproximant<Tp> res;
+      res.max_error = extrema();
+      auto best_p = p, best_q = q;
+
+      // The initial reference is the alternating extrema of the starting
+      // error.  If there are too few the largest gaps are split,
+      // taking the ends of the interval first.
+      std::vector<Tp> ref(num_ref), rerr(num_ref);
+      const auto choose = [&]()
+      {
+	// Drop the smaller end extrema until there are enough.
+	std::size_t first = 0, last = text.size();
+	while (last - first > num_ref)
+	  {
+	    if (std::abs(eext[first]) < std::abs(eext[last - 1]))
+	      ++first;
+	    else
+	      --last;
+	  }
+	std::copy(text.begin() + first, text.begin() + last, ref.begin());
+	std::copy(eext.begin() + first, eext.begin() + last, rerr.begin());
+      };
+      if (text.size() >= num_ref)
+	choose();
+      else
+	{
+	  std::vector<Tp> pts(text);
+	  while (pts.size() < num_ref)
+	    {
+	      if (pts.empty() || pts.front() > Tp{-1})
+		pts.insert(pts.begin(), Tp{-1});
+	      else if (pts.back() < Tp{1})
+		pts.push_back(Tp{1});
+	      else
+		{
+		  std::size_t k = 1;
+		  for (std::size_t j = 2; j < pts.size(); ++j)
+		    if (pts[j] - pts[j - 1] > pts[k] - pts[k - 1])
+		      k = j;
+		  pts.insert(pts.begin() + k, (pts[k - 1] + pts[k]) / Tp{2});
+		}
+	    }
+	  ref = pts;
+	}
+
+      res.converged = res.max_error <= noise;
+
+      const auto dim = std::max(m, n) + 1;
+      std::vector<Tp> row(dim), sol;
+      auto lev_err = Tp{0};
+      for (std::size_t i = 0; i < num_ref; ++i)
+	lev_err += (i % 2 == 0 ? Tp{1} : Tp{-1}) * err(ref[i]);
+      lev_err /= Tp(num_ref);
+
+      for (res.num_iters = 0; !res.converged && res.num_iters < max_iter;)
+	{
+	  ++res.num_iters;
+
+	  // Solve p(t_i) - (f_i - (-1)^i E) q(t_i) = 0 for p, q and E.
+	  // For a given E in the non-constant terms of q the system is linear;
+	  // the E returned must match it, which is solved by the secant method.
+	  std::vector<Tp> fref(num_ref);
+	  for (std::size_t i = 0; i < num_ref; ++i)
+	    fref[i] = f(ref[i]);
+	  const auto solve = [&](Tp lev, Tp& gap)
+	  {
+	    std::vector<Tp> mat(num_ref * num_ref), rhs(fref);
+	    for (std::size_t i = 0; i < num_ref; ++i)
+	      {
+		const auto sgn = i % 2 == 0 ? Tp{1} : Tp{-1};
+		chebyshev_row(ref[i], dim - 1, row.data());
+		auto r = mat.begin() + i * num_ref;
+		for (std::size_t k = 0; k <= m; ++k)
+		  r[k] = row[k];
+		const auto fe = fref[i] - sgn * lev;
+		for (std::size_t k = 1; k <= n; ++k)
+		  r[m + k] = -fe * row[k];
+		r[m + n + 1] = sgn;
+	      }
+	    if (!lu_solve(mat, rhs, sol))
+	      return false;
+	    gap = sol.back() - lev;
+	    return true;
+	  };
+	  auto lev0 = lev_err, gap0 = Tp{0}, gap = Tp{0};
+	  if (!solve(lev0, gap0))
+	    break;
+	  lev_err = sol.back();
+	  bool solved = true;
+	  for (int inner = 0; n > 0 && inner < 20; ++inner)
+	    {
+	      if (!solve(lev_err, gap))
+		{
+		  solved = false;
+		  break;
+		}
+	      if (std::abs(gap) <= Tp{16} * s_eps * std::abs(lev_err)
+	       || gap == gap0)
+		break;
+	      const auto lev = lev_err - gap * (lev_err - lev0) / (gap - gap0);
+	      lev0 = lev_err;
+	      gap0 = gap;
+	      lev_err = lev;
+	    }
+	  if (!solved)
+	    break;
+	  lev_err = sol.back();
+	  p = ChebyshevPolynomial<Tp>(sol.begin(), sol.begin() + m + 1);
+	  q = ChebyshevPolynomial<Tp>(Tp{0}, n);
+	  q[0] = Tp{1};
+	  for (std::size_t k = 1; k <= n; ++k)
+	    q[k] = sol[m + k];
+	  if (!sample())
+	    break;
+
+	  const auto max_error = extrema();
+	  if (max_error < res.max_error)
+	    {
+	      res.max_error = max_error;
+	      best_p = p;
+	      best_q = q;
+	    }
+	  if (max_error <= noise)
+	    {
+	      res.converged = true;
+	      break;
+	    }
+
+	  // Exchange all the points if there are enough alternating
+	  // extrema.  Otherwise keep the reference and exchange
+	  // the point of largest error alone.
+	  if (text.size() >= num_ref)
+	    choose();
+	  else
+	    {
+	      for (std::size_t i = 0; i < num_ref; ++i)
+		rerr[i] = err(ref[i]);
+	      std::size_t kmax = 0;
+	      for (std::size_t k = 1; k < eext.size(); ++k)
+		if (std::abs(eext[k]) > std::abs(eext[kmax]))
+		  kmax = k;
+	      minimax_exchange(ref, rerr, text[kmax], eext[kmax]);
+	    }
+
+	  auto min_err = std::abs(rerr[0]);
+	  for (const auto& e : rerr)
+	    min_err = std::min(min_err, std::abs(e));
+	  if (max_error - min_err <= std::max(tol * max_error, pq_noise))
+	    {
+	      res.converged = true;
+	      break;
+	    }
+	}
+
+      // Transform from t = (x - mid) / half back to x.
+      const Polynomial<Tp> tx({-mid / half, Tp{1} / half});
+      const auto to_x = [&tx](const Polynomial<Tp>& c)
+      {
+	Polynomial<Tp> poly(c[c.degree()]);
+	for (std::size_t k = c.degree(); k-- > 0;)
+	  poly = poly * tx + Polynomial<Tp>(c[k]);
+	return poly;
+      };
+      res.approx = RationalPolynomial<Tp>(to_x(best_p.polynomial()),
+					  to_x(best_q.polynomial()));
+
+      // The conversion to the monomial basis in x loses some accuracy
+      // at high degree; report the error of what is returned.
+      for (std::size_t g = 0; g < num_grid; ++g)
+	res.max_error = std::max(res.max_error,
+			       std::abs(fg[g] - res.approx(mid + half * tg[g])));
+
+      return res;
+    }
+
+  /**
+   * Return the numerator and denominator of a rational polynomial
+   * as static polynomials.
+   */
+  template<std::size_t SizeN, std::size_t SizeD, typename Tp>
+    std::pair<StaticPolynomial<Tp, SizeN>, StaticPolynomial<Tp, SizeD>>
+    to_static(const RationalPolynomial<Tp>& rat)
+    {
+      if (rat.numer().degree() >= SizeN || rat.denom().degree() >= SizeD)
+	throw std::domain_error("to_static: Static polynomial too small");
+      return {StaticPolynomial<Tp, SizeN>(rat.numer().begin(),
+					  rat.numer().end()),
+	      StaticPolynomial<Tp, SizeD>(rat.denom().begin(),
+					  rat.denom().end())};
+    }
+
+  /**
+   * Write C++ source defining constexpr static polynomials for the
+   * numerator and denominator of a rational polynomial.
+   */
+  template<typename CharT, typename Traits, typename Tp>
+    std::basic_ostream<CharT, Traits>&
+    write_static(std::basic_ostream<CharT, Traits>& os,
+		 const RationalPolynomial<Tp>& rat, const std::string& name)
+    {
+      static_assert(std::is_floating_point_v<Tp>,
+		    "write_static: Coefficients must be floating point");
+      const char* type = std::is_same_v<Tp, float> ? "float"
+			: std::is_same_v<Tp, double> ? "double"
+			: "long double";
+      const char* suffix = std::is_same_v<Tp, float> ? "F"
+			  : std::is_same_v<Tp, double> ? ""
+			  : "L";
+
+      const auto sflags = os.flags();
+      const auto sprec = os.precision(std::numeric_limits<Tp>::max_digits10);
+      os.setf(std::ios_base::scientific, std::ios_base::floatfield);
+      const auto write = [&](const Polynomial<Tp>& poly, const char* part)
+      {
+	os << "constexpr emsr::StaticPolynomial<" << type << ", "
+	   << poly.degree() + 1 << ">\n" << name << part << "\n{\n";
+	for (std::size_t i = 0; i <= poly.degree(); ++i)
+	  os << "  " << poly[i] << suffix
+	     << (i < poly.degree() ? ",\n" : "\n");
+	os << "};\n";
+      };
+      write(rat.numer(), "_num");
+      write(rat.denom(), "_den");
+      os.precision(sprec);
+      os.flags(sflags);
+
+      return os;
+    }
+
+} // namespace emsr
+
+#endif // RATIONAL_APPROXIMATION_TCC
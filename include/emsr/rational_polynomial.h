@@ -68,6 +68,7 @@ namespace emsr
 */
       using size_type = typename polynomial_type::size_type;
       using difference_type = typename polynomial_type::difference_type;
+      using real_type = typename polynomial_type::real_type;
 
       /**
        * Create a zero degree polynomial with value zero.
@@ -96,11 +97,36 @@ namespace emsr
       { }
 
       /**
-       * Evaluate the polynomial at the input point.
+       * The number of points evaluated together by the range evaluator.
+       */
+      static constexpr size_type s_lanes = 8;
+
+      /**
+       * Evaluate the rational polynomial at the input point.
+       * The numerator and denominator Horner recurrences are run together.
+       * For |x| > 1 the recurrences are run in 1/x and the ratio is rescaled
+       * by x^(n - m) so that the numerator and denominator do not overflow.
        */
       value_type
       operator()(value_type x) const
-      { return this->m_num(x) / this->m_den(x); }
+      {
+	value_type r;
+	this->template m_eval_lanes<1>(&x, &r);
+	return r;
+      }
+
+      /**
+       * Evaluate the rational polynomial at a range of input points.
+       * The points are processed in blocks of s_lanes and within a block
+       * the recurrences for all points are run together.
+       * The output is written to the output iterator which
+       * must be large enough to contain the results.
+       * The next available output iterator is returned.
+       */
+      template<typename InIter, typename OutIter,
+	       typename = std::_RequireInputIter<InIter>>
+	OutIter
+	operator()(InIter xbegin, InIter xend, OutIter rbegin) const;
 
       /**
        * Unary plus.
@@ -114,7 +140,11 @@ namespace emsr
        */
       RationalPolynomial
       operator-() const
-      { return RationalPolynomial(*this) *= value_type(-1); }
+      {
+	auto neg = *this;
+	neg.m_num = -neg.m_num;
+	return neg;
+      }
 
       /**
        * Copy assignment.
@@ -134,6 +164,8 @@ namespace emsr
       RationalPolynomial&
       operator+=(const RationalPolynomial& x)
       {
+	if (this->m_auto_normalize)
+	  return this->m_add_reduced(x, value_type{1});
         this->numer() = this->numer() * x.denom() + this->denom() * x.numer();
         this->denom() *= x.denom();
 	return *this;
@@ -145,6 +177,8 @@ namespace emsr
       RationalPolynomial&
       operator-=(const RationalPolynomial& x)
       {
+	if (this->m_auto_normalize)
+	  return this->m_add_reduced(x, value_type{-1});
         this->numer() = this->numer() * x.denom() - this->denom() * x.numer();
         this->denom() *= x.denom();
 	return *this;
@@ -156,6 +190,8 @@ namespace emsr
       RationalPolynomial&
       operator*=(const RationalPolynomial& x)
       {
+	if (this->m_auto_normalize)
+	  return this->m_mul_reduced(x.numer(), x.denom());
 	this->numer() *= x.numer();
 	this->denom() *= x.denom();
 	return *this;
@@ -167,6 +203,8 @@ namespace emsr
       RationalPolynomial&
       operator/=(const RationalPolynomial& x)
       {
+	if (this->m_auto_normalize)
+	  return this->m_mul_reduced(x.denom(), x.numer());
 	this->numer() *= x.denom();
 	this->denom() *= x.numer();
 	return *this;
@@ -196,10 +234,71 @@ namespace emsr
       denom(value_type x) const
       { return this->m_den(x); }
 
+      /**
+       * Remove the common factors of the numerator and denominator
+       * and make the denominator monic.
+       * Common factors are found with an approximate polynomial gcd
+       * using the tolerance of this rational polynomial.
+       * A candidate factor is only cancelled if it divides both
+       * numerator and denominator to within that tolerance.
+       */
+      RationalPolynomial&
+      normalize();
+
+      /**
+       * Return true if the arithmetic operators normalize their results.
+       */
+      bool
+      auto_normalize() const
+      { return this->m_auto_normalize; }
+
+      /**
+       * Turn normalization of the results of arithmetic on or off.
+       * When on, common factors are cancelled before multiplying
+       * and sums are formed over the least common denominator
+       * so that the degrees do not grow needlessly.
+       * This is off by default.
+       */
+      void
+      auto_normalize(bool on)
+      { this->m_auto_normalize = on; }
+
+      /**
+       * Return the relative tolerance used to detect common factors.
+       */
+      real_type
+      tolerance() const
+      { return this->m_tol; }
+
+      /**
+       * Set the relative tolerance used to detect common factors.
+       */
+      void
+      tolerance(real_type tol)
+      { this->m_tol = tol; }
+
     private:
 
+      template<size_type Lanes>
+	void
+	m_eval_lanes(const value_type* x, value_type* r) const;
+
+      bool
+      m_divide_exact(const Polynomial<value_type>& poly,
+		     const Polynomial<value_type>& fac,
+		     Polynomial<value_type>& quo) const;
+
+      RationalPolynomial&
+      m_add_reduced(const RationalPolynomial& x, value_type sign);
+
+      RationalPolynomial&
+      m_mul_reduced(const Polynomial<value_type>& num,
+		    const Polynomial<value_type>& den);
+
       Polynomial<value_type> m_num;
       Polynomial<value_type> m_den;
+      real_type m_tol = sqrt_epsilon<real_type>();
+      bool m_auto_normalize = false;
     };
 
   /**
@@ -246,4 +345,6 @@ namespace emsr
 
 } // namespace emsr
 
+#include <emsr/rational_polynomial.tcc>
+
 #endif // RATIONAL_POLYNOMIAL_H
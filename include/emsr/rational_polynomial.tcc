@@ -0,0 +1,308 @@
+
+// Copyright (C) 2016-2019 Free Software Foundation, Inc.
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file rational_polynomial.tcc Out-of-line definitions of members for
+ * a ratio of two polynomials.
+ *
+ * This file contains the out-of-line implementations of the rational
+ * polynomial class.
+ *
+ * @see rational_polynomial.h
+ */
+
+/**
+ * @def  RATIONAL_POLYNOMIAL_TCC
+ *
+ * @brief  A guard for the rational_polynomial class implementation header.
+ */
+#ifndef RATIONAL_POLYNOMIAL_TCC
+#define RATIONAL_POLYNOMIAL_TCC 1
+
+#include <algorithm>
+
+namespace emsr
+{
+
+  /**
+   * Evaluate the rational polynomial at Lanes points.
+   * If all the points are inside the unit circle the numerator and
+   * denominator Horner recurrences are run in x.  If all the points are
+   * outside they are run in 1/x and the ratio is rescaled by x^(n - m).
+   * A block with points on both sides is done one point at a time.
+   */
+  template<typename Tp>
+    template<typename RationalPolynomial<Tp>::size_type Lanes>
+      void
+      RationalPolynomial<Tp>::m_eval_lanes(const value_type* x,
+					   value_type* r) const
+      {
+	using std::abs;
+	const auto& a = this->m_num;
+	const auto& b = this->m_den;
+	const int n = a.degree();
+	const int m = b.degree();
+
+	bool inside = true;
+	bool outside = true;
+	for (size_type k = 0; k < Lanes; ++k)
+	  {
+	    const bool in = abs(x[k]) <= real_type{1};
+	    inside = inside && in;
+	    outside = outside && !in;
+	  }
+	if (!inside && !outside)
+	  {
+	    for (size_type k = 0; k < Lanes; ++k)
+	      this->template m_eval_lanes<1>(x + k, r + k);
+	    return;
+	  }
+
+	value_type p[Lanes], q[Lanes];
+	if (inside)
+	  {
+	    for (size_type k = 0; k < Lanes; ++k)
+	      {
+		p[k] = a[n];
+		q[k] = b[m];
+	      }
+	    for (int i = n - 1; i >= m; --i)
+	      for (size_type k = 0; k < Lanes; ++k)
+		p[k] = p[k] * x[k] + a[i];
+	    for (int i = m - 1; i >= n; --i)
+	      for (size_type k = 0; k < Lanes; ++k)
+		q[k] = q[k] * x[k] + b[i];
+	    for (int i = std::min(n, m) - 1; i >= 0; --i)
+	      for (size_type k = 0; k < Lanes; ++k)
+		{
+		  p[k] = p[k] * x[k] + a[i];
+		  q[k] = q[k] * x[k] + b[i];
+		}
+	    for (size_type k = 0; k < Lanes; ++k)
+	      r[k] = p[k] / q[k];
+	  }
+	else
+	  {
+	    value_type rx[Lanes];
+	    for (size_type k = 0; k < Lanes; ++k)
+	      {
+		rx[k] = real_type{1} / x[k];
+		p[k] = a[0];
+		q[k] = b[0];
+	      }
+	    const int nm = std::min(n, m);
+	    for (int i = 1; i <= nm; ++i)
+	      for (size_type k = 0; k < Lanes; ++k)
+		{
+		  p[k] = p[k] * rx[k] + a[i];
+		  q[k] = q[k] * rx[k] + b[i];
+		}
+	    for (int i = nm + 1; i <= n; ++i)
+	      for (size_type k = 0; k < Lanes; ++k)
+		p[k] = p[k] * rx[k] + a[i];
+	    for (int i = nm + 1; i <= m; ++i)
+	      for (size_type k = 0; k < Lanes; ++k)
+		q[k] = q[k] * rx[k] + b[i];
+	    for (size_type k = 0; k < Lanes; ++k)
+	      r[k] = p[k] / q[k];
+	    for (int i = m; i < n; ++i)
+	      for (size_type k = 0; k < Lanes; ++k)
+		r[k] *= x[k];
+	    for (int i = n; i < m; ++i)
+	      for (size_type k = 0; k < Lanes; ++k)
+		r[k] *= rx[k];
+	  }
+      }
+
+  /**
+   * Evaluate the rational polynomial at a range of input points.
+   */
+  template<typename Tp>
+    template<typename InIter, typename OutIter, typename>
+      OutIter
+      RationalPolynomial<Tp>::operator()(InIter xbegin, InIter xend,
+					 OutIter rbegin) const
+      {
+	value_type x[s_lanes], r[s_lanes];
+	size_type k = 0;
+	for (; xbegin != xend; ++xbegin)
+	  {
+	    x[k++] = *xbegin;
+	    if (k == s_lanes)
+	      {
+		this->template m_eval_lanes<s_lanes>(x, r);
+		for (size_type j = 0; j < s_lanes; ++j)
+		  *rbegin++ = r[j];
+		k = 0;
+	      }
+	  }
+	for (size_type j = 0; j < k; ++j)
+	  {
+	    this->template m_eval_lanes<1>(x + j, r + j);
+	    *rbegin++ = r[j];
+	  }
+	return rbegin;
+      }
+
+  /**
+   * Divide a polynomial by a factor and return true if the remainder
+   * is at the level of the rounding committed in forming the quotient.
+   * An approximate gcd can be inexact or a false positive so a factor
+   * is only cancelled if this holds.
+   */
+  template<typename Tp>
+    bool
+    RationalPolynomial<Tp>::m_divide_exact(const Polynomial<value_type>& poly,
+					   const Polynomial<value_type>& fac,
+					   Polynomial<value_type>& quo) const
+    {
+      using std::abs;
+      const auto norm = [](const Polynomial<value_type>& p)
+      {
+	auto nrm = real_type{0};
+	for (const auto& c : p)
+	  nrm = std::max(nrm, real_type(abs(c)));
+	return nrm;
+      };
+
+      Polynomial<value_type> rem;
+      divmod(poly, fac, quo, rem);
+      return norm(rem) <= this->m_tol
+			  * std::max(norm(poly), norm(quo) * norm(fac));
+    }
+
+  /**
+   * Remove the common factors of the numerator and denominator
+   * and make the denominator monic.
+   */
+  template<typename Tp>
+    RationalPolynomial<Tp>&
+    RationalPolynomial<Tp>::normalize()
+    {
+      using std::abs;
+      const auto norm = [](const Polynomial<value_type>& poly)
+      {
+	auto nrm = real_type{0};
+	for (const auto& c : poly)
+	  nrm = std::max(nrm, real_type(abs(c)));
+	return nrm;
+      };
+
+      const auto nn = norm(this->m_num);
+      const auto nd = norm(this->m_den);
+      if (nd == real_type{0})
+	return *this;
+
+      this->m_num.deflate(this->m_tol * nn);
+      this->m_den.deflate(this->m_tol * nd);
+
+      if (nn == real_type{0})
+	{
+	  this->m_num = Polynomial<value_type>(value_type{0});
+	  this->m_den = Polynomial<value_type>(value_type{1});
+	  return *this;
+	}
+
+      const auto fac = gcd(this->m_num, this->m_den, this->m_tol);
+      if (fac.degree() > 0)
+	{
+	  Polynomial<value_type> qnum, qden;
+	  if (this->m_divide_exact(this->m_num, fac, qnum)
+	   && this->m_divide_exact(this->m_den, fac, qden))
+	    {
+	      this->m_num = std::move(qnum);
+	      this->m_den = std::move(qden);
+	    }
+	}
+
+      const auto lead = this->m_den[this->m_den.degree()];
+      this->m_num /= lead;
+      this->m_den /= lead;
+
+      return *this;
+    }
+
+  /**
+   * Add or subtract a rational polynomial over the least common denominator
+   * and normalize the result.
+   */
+  template<typename Tp>
+    RationalPolynomial<Tp>&
+    RationalPolynomial<Tp>::m_add_reduced(const RationalPolynomial& x,
+					  value_type sign)
+    {
+      const auto fac = gcd(this->m_den, x.m_den, this->m_tol);
+      Polynomial<value_type> den1, den2;
+      if (fac.degree() > 0
+       && this->m_divide_exact(this->m_den, fac, den1)
+       && this->m_divide_exact(x.m_den, fac, den2))
+	{
+	  this->m_num = this->m_num * den2 + sign * (den1 * x.m_num);
+	  this->m_den = den1 * x.m_den;
+	}
+      else
+	{
+	  this->m_num = this->m_num * x.m_den + sign * (this->m_den * x.m_num);
+	  this->m_den *= x.m_den;
+	}
+      return this->normalize();
+    }
+
+  /**
+   * Multiply by the ratio num/den cancelling common factors across
+   * the fractions first and normalize the result.
+   */
+  template<typename Tp>
+    RationalPolynomial<Tp>&
+    RationalPolynomial<Tp>::m_mul_reduced(const Polynomial<value_type>& num,
+					  const Polynomial<value_type>& den)
+    {
+      const auto fac1 = gcd(this->m_num, den, this->m_tol);
+      const auto fac2 = gcd(num, this->m_den, this->m_tol);
+      // Form all the quotients before assigning: num and den
+      // may refer to this.
+      Polynomial<value_type> num1, den1, num2, den2;
+      if (!(fac1.degree() > 0
+	    && this->m_divide_exact(this->m_num, fac1, num1)
+	    && this->m_divide_exact(den, fac1, den2)))
+	{
+	  num1 = this->m_num;
+	  den2 = den;
+	}
+      if (!(fac2.degree() > 0
+	    && this->m_divide_exact(num, fac2, num2)
+	    && this->m_divide_exact(this->m_den, fac2, den1)))
+	{
+	  num2 = num;
+	  den1 = this->m_den;
+	}
+      this->m_num = std::move(num1);
+      this->m_den = std::move(den1);
+      this->m_num *= num2;
+      this->m_den *= den2;
+      return this->normalize();
+    }
+
+} // namespace emsr
+
+#endif // RATIONAL_POLYNOMIAL_TCC
@@ -0,0 +1,140 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file real_root_isolation.h
+ *
+ * This file contains the isolation and refinement of the real zeros
+ * of a real polynomial by Descartes' rule of signs.
+ */
+
+/**
+ * @def  REAL_ROOT_ISOLATION_H
+ *
+ * @brief  A guard for the real root isolation header.
+ */
+#ifndef REAL_ROOT_ISOLATION_H
+#define REAL_ROOT_ISOLATION_H 1
+
+#include <vector>
+#include <limits>
+
+#include <emsr/polynomial.h>
+
+namespace emsr
+{
+
+  /**
+   * An interval containing real zeros of a polynomial.
+   * An isolating interval contains exactly one simple zero in its
+   * interior or, if the bounds are equal, is an exact zero.
+   * An interval that could not be resolved to working precision
+   * holds a cluster of zeros or a multiple zero and num_roots is
+   * the number of sign variations that remained.
+   */
+  template<typename Real>
+    struct RootInterval
+    {
+      Real lower;
+      Real upper;
+      int num_roots;
+
+      /// Return true if the interval holds exactly one zero.
+      bool
+      isolated() const
+      { return this->num_roots == 1; }
+    };
+
+  /**
+   * Return the number of sign variations in a sequence of coefficients.
+   * Zero coefficients are skipped.  By Descartes' rule of signs this
+   * exceeds the number of positive zeros by an even number.
+   */
+  template<typename Real>
+    int
+    sign_variations(const Polynomial<Real>& poly);
+
+  /**
+   * Return an upper bound on the positive zeros of a polynomial
+   * @f[
+   *    2 \max_{a_i a_n < 0} \left|\frac{a_i}{a_n}\right|^{1/(n-i)}
+   * @f]
+   * or zero if there are no sign variations.
+   */
+  template<typename Real>
+    Real
+    positive_root_bound(const Polynomial<Real>& poly);
+
+  /**
+   * Return disjoint intervals isolating the real zeros of a polynomial
+   * in increasing order.
+   *
+   * The continued fraction form of the Vincent-Collins-Akritas method is
+   * used.  A Möbius transformation M(x) = (ax + b)/(cx + d) maps the
+   * positive half line onto the current interval.  When the transformed
+   * polynomial has one sign variation the interval is isolating.
+   * Otherwise it is shifted past a lower bound on its positive zeros
+   * with Polynomial::shift and split at one into the shift by one and
+   * the reversal followed by the shift by one.
+   *
+   * The arithmetic is floating point so sign variations near the
+   * rounding level are not reliable.  The transformations are done in
+   * long double when it is wider than Real, and an interval is only
+   * reported when the parity of its sign variations agrees with the
+   * signs of P at its ends; otherwise it is split further.
+   * A multiple zero never reduces to
+   * one variation; it is returned as an unresolved interval once the
+   * interval width reaches the working precision or after max_depth
+   * transformations.  Pass the square-free part P / gcd(P, P') to
+   * separate multiple zeros.
+   */
+  template<typename Real>
+    std::vector<RootInterval<Real>>
+    isolate_real_roots(const Polynomial<Real>& poly, int max_depth = 1000);
+
+  /**
+   * Refine the zero of a polynomial in an interval where it
+   * changes sign by Newton's method safeguarded by bisection.
+   * The interval is open so a zero at an endpoint is not returned.
+   * If there is no sign change the midpoint is returned.
+   * The iteration stops when the bracket is within @c tol relative.
+   */
+  template<typename Real>
+    Real
+    refine_real_root(const Polynomial<Real>& poly, Real lower, Real upper,
+		     Real tol = Real{2} * std::numeric_limits<Real>::epsilon(),
+		     int max_iter = 200);
+
+  /**
+   * Return the real zeros of a polynomial in increasing order.
+   * Isolated zeros are refined.  An unresolved interval contributes
+   * its midpoint num_roots times.
+   */
+  template<typename Real>
+    std::vector<Real>
+    real_roots(const Polynomial<Real>& poly);
+
+} // namespace emsr
+
+#include <emsr/real_root_isolation.tcc>
+
+#endif // REAL_ROOT_ISOLATION_H
@@ -0,0 +1,432 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file real_root_isolation.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * real root isolation functions.
+ *
+ * @see real_root_isolation.h
+ */
+
+/**
+ * @def  REAL_ROOT_ISOLATION_TCC
+ *
+ * @brief  A guard for the real root isolation implementation header.
+ */
+#ifndef REAL_ROOT_ISOLATION_TCC
+#define REAL_ROOT_ISOLATION_TCC 1
+
+#include <cmath>
+#include <algorithm>
+#include <utility> // For swap, move.
+#include <tuple> // For tie.
+#include <type_traits>
+
+namespace emsr
+{
+
+  /**
+   * Return the number of sign variations in the coefficients.
+   */
+  template<typename Real>
+    int
+    sign_variations(const Polynomial<Real>& poly)
+    {
+      int num = 0;
+      int last = 0;
+      for (std::size_t i = 0; i <= poly.degree(); ++i)
+	{
+	  if (poly[i] == Real{0})
+	    continue;
+	  const int sign = poly[i] < Real{0} ? -1 : 1;
+	  if (last != 0 && sign != last)
+	    ++num;
+	  last = sign;
+	}
+      return num;
+    }
+
+  /**
+   * Return an upper bound on the positive zeros of a polynomial.
+   */
+  template<typename Real>
+    Real
+    positive_root_bound(const Polynomial<Real>& poly)
+    {
+      using std::abs;
+      using std::pow;
+      auto n = poly.degree();
+      while (n > 0 && poly[n] == Real{0})
+	--n;
+      const auto an = poly[n];
+      auto bound = Real{0};
+      for (std::size_t i = 0; i < n; ++i)
+	if (poly[i] != Real{0} && (poly[i] < Real{0}) != (an < Real{0}))
+	  bound = std::max(bound, pow(abs(poly[i] / an),
+				      Real{1} / Real(n - i)));
+      return Real{2} * bound;
+    }
+
+  /**
+   * A node of the continued fraction isolation: the polynomial
+   * (cx + d)^n P((ax + b)/(cx + d)) and its transformation.
+   */
+  template<typename Real>
+    struct VcaNode
+    {
+      Polynomial<Real> poly;
+      Real a, b, c, d;
+      int depth;
+    };
+
+  /**
+   * Scale the coefficients by a power of the radix so the largest
+   * has magnitude near one.  This is exact and does not change
+   * the sign variations.
+   */
+  template<typename Real>
+    void
+    vca_normalize(Polynomial<Real>& poly)
+    {
+      using std::abs;
+      using std::ilogb;
+      using std::ldexp;
+      auto big = Real{0};
+      for (std::size_t i = 0; i <= poly.degree(); ++i)
+	big = std::max(big, abs(poly[i]));
+      if (big == Real{0})
+	return;
+      const auto scale = -ilogb(big);
+      if (scale != 0)
+	for (std::size_t i = 0; i <= poly.degree(); ++i)
+	  poly[i] = ldexp(poly[i], scale);
+    }
+
+  /**
+   * Divide out all zeros at the origin and return their number.
+   */
+  template<typename Real>
+    int
+    vca_strip_zero(Polynomial<Real>& poly)
+    {
+      std::size_t m = 0;
+      while (m < poly.degree() && poly[m] == Real{0})
+	++m;
+      if (m > 0)
+	poly = Polynomial<Real>(poly.begin() + m, poly.end());
+      return m;
+    }
+
+  /**
+   * The type in which the isolation is done:
+   * long double if it is wider than Real.
+   */
+  template<typename Real>
+    using vca_wide_t
+      = std::conditional_t<(std::numeric_limits<Real>::digits
+			    < std::numeric_limits<long double>::digits),
+			   long double, Real>;
+
+  /**
+   * Return the sign of a polynomial at a point.
+   */
+  template<typename Real>
+    int
+    vca_sign(const Polynomial<Real>& poly, Real x)
+    {
+      auto p = poly[poly.degree()];
+      for (std::size_t i = poly.degree(); i-- > 0;)
+	p = p * x + poly[i];
+      return (p > Real{0}) - (p < Real{0});
+    }
+
+  /**
+   * Isolate the positive zeros of a polynomial with no zero at the origin.
+   * If @c negate is true the intervals are reflected to the negative axis.
+   */
+  template<typename Real>
+    void
+    isolate_positive_roots(Polynomial<Real> poly, bool negate, int max_depth,
+			   std::vector<RootInterval<Real>>& intervals)
+    {
+      using std::abs;
+      const auto eps = std::numeric_limits<Real>::epsilon();
+      const auto upper_bound = positive_root_bound(poly);
+      if (upper_bound == Real{0})
+	return;
+
+      const auto emit = [negate, &intervals](Real lo, Real hi, int num)
+	{
+	  if (negate)
+	    intervals.push_back({-hi, Real{0} - lo, num});
+	  else
+	    intervals.push_back({lo, hi, num});
+	};
+
+      // The image of the positive half line, clipped to the root bound.
+      const auto image = [upper_bound](const VcaNode<Real>& node)
+	{
+	  auto lo = node.b / node.d;
+	  auto hi = node.c == Real{0}
+		  ? upper_bound
+		  : std::min(node.a / node.c, upper_bound);
+	  if (hi < lo)
+	    std::swap(lo, hi);
+	  return std::make_pair(lo, hi);
+	};
+
+      // By Descartes' rule the sign variations and the number of zeros
+      // in the image of a node have the same parity, which the signs of P
+      // at the ends of the image give.  If they differ the shifts have
+      // lost the signs of the coefficients and the node is split
+      // rather than reported.
+      const auto orig = poly;
+      const auto variations = [&orig, &image](const VcaNode<Real>& node)
+	{
+	  const auto var = sign_variations(node.poly);
+	  const auto [lo, hi] = image(node);
+	  const auto slo = vca_sign(orig, lo);
+	  const auto shi = vca_sign(orig, hi);
+	  if (slo == 0 || shi == 0 || (slo != shi) == (var % 2 == 1))
+	    return var;
+	  return std::max(var, 2);
+	};
+
+      vca_normalize(poly);
+      std::vector<VcaNode<Real>> stack;
+      stack.push_back({std::move(poly), Real{1}, Real{0}, Real{0}, Real{1}, 0});
+      while (!stack.empty())
+	{
+	  auto node = std::move(stack.back());
+	  stack.pop_back();
+	  auto& q = node.poly;
+
+	  auto var = variations(node);
+	  if (var == 0)
+	    continue;
+	  auto [lo, hi] = image(node);
+	  if (var == 1)
+	    {
+	      emit(lo, hi, 1);
+	      continue;
+	    }
+	  if (node.depth >= max_depth
+	      || hi - lo <= Real{4} * eps * std::max(abs(lo), abs(hi)))
+	    {
+	      emit(lo, hi, var);
+	      continue;
+	    }
+
+	  // Shift past a lower bound on the positive zeros.
+	  const Polynomial<Real> rev(q.crbegin(), q.crend());
+	  const auto rev_bound = positive_root_bound(rev);
+	  if (rev_bound > Real{0} && Real{1} / rev_bound >= Real{1})
+	    {
+	      const auto lb = Real{1} / rev_bound;
+	      q.shift(lb);
+	      vca_normalize(q);
+	      node.b += node.a * lb;
+	      node.d += node.c * lb;
+	      if (const auto num_zero = vca_strip_zero(q); num_zero > 0)
+		emit(node.b / node.d, node.b / node.d, num_zero);
+	      var = variations(node);
+	      if (var == 0)
+		continue;
+	      if (var == 1)
+		{
+		  std::tie(lo, hi) = image(node);
+		  emit(lo, hi, 1);
+		  continue;
+		}
+	    }
+
+	  // Split at one: x -> x + 1 and x -> 1/(x + 1).
+	  VcaNode<Real> right{q, node.a, node.a + node.b,
+			      node.c, node.c + node.d, node.depth + 1};
+	  right.poly.shift(Real{1});
+	  vca_normalize(right.poly);
+	  if (const auto num_zero = vca_strip_zero(right.poly); num_zero > 0)
+	    emit(right.b / right.d, right.b / right.d, num_zero);
+
+	  VcaNode<Real> left{Polynomial<Real>(q.crbegin(), q.crend()),
+			     node.b, node.a + node.b,
+			     node.d, node.c + node.d, node.depth + 1};
+	  left.poly.shift(Real{1});
+	  vca_normalize(left.poly);
+	  vca_strip_zero(left.poly);
+
+	  stack.push_back(std::move(right));
+	  stack.push_back(std::move(left));
+	}
+    }
+
+  /**
+   * Return disjoint intervals isolating the real zeros of a polynomial.
+   */
+  template<typename Real>
+    std::vector<RootInterval<Real>>
+    isolate_real_roots(const Polynomial<Real>& poly, int max_depth)
+    {
+      std::vector<RootInterval<Real>> intervals;
+
+      auto n = poly.degree();
+      while (n > 0 && poly[n] == Real{0})
+	--n;
+      if (n == 0)
+	return intervals;
+
+      Polynomial<Real> p(poly.begin(), poly.begin() + n + 1);
+      const auto num_zero = vca_strip_zero(p);
+      if (num_zero > 0)
+	intervals.push_back({Real{0}, Real{0}, num_zero});
+      if (p.degree() == 0)
+	return intervals;
+
+      // The negative zeros are the positive zeros of P(-x).
+      auto pneg = p;
+      for (std::size_t i = 1; i <= pneg.degree(); i += 2)
+	pneg[i] = -pneg[i];
+
+      // The shifts lose the signs of small coefficients so the isolation
+      // is done in a wider type where there is one.
+      using Wide = vca_wide_t<Real>;
+      std::vector<RootInterval<Wide>> wide;
+      isolate_positive_roots(Polynomial<Wide>(p.begin(), p.end()),
+			     false, max_depth, wide);
+      isolate_positive_roots(Polynomial<Wide>(pneg.begin(), pneg.end()),
+			     true, max_depth, wide);
+      for (const auto& iv : wide)
+	intervals.push_back({Real(iv.lower), Real(iv.upper), iv.num_roots});
+
+      std::sort(intervals.begin(), intervals.end(),
+		[](const RootInterval<Real>& x, const RootInterval<Real>& y)
+		{
+		  return x.lower < y.lower
+		      || (x.lower == y.lower && x.upper < y.upper);
+		});
+
+      return intervals;
+    }
+
+  /**
+   * Refine a zero bracketed by a sign change.
+   */
+  template<typename Real>
+    Real
+    refine_real_root(const Polynomial<Real>& poly, Real lower, Real upper,
+		     Real tol, int max_iter)
+    {
+      using std::abs;
+      const auto n = poly.degree();
+      const auto eval = [&poly, n](Real x, Real& dp)
+	{
+	  auto p = poly[n];
+	  dp = Real{0};
+	  for (std::size_t i = n; i-- > 0;)
+	    {
+	      dp = dp * x + p;
+	      p = p * x + poly[i];
+	    }
+	  return p;
+	};
+
+      if (lower == upper)
+	return lower;
+      if (upper < lower)
+	std::swap(lower, upper);
+
+      // The interval is open: at a zero endpoint the sign just inside
+      // is that of the derivative.
+      Real dp;
+      auto plo = eval(lower, dp);
+      if (plo == Real{0})
+	plo = dp;
+      auto phi = eval(upper, dp);
+      if (phi == Real{0})
+	phi = -dp;
+      if (plo == Real{0} || phi == Real{0}
+	  || (plo < Real{0}) == (phi < Real{0}))
+	return (lower + upper) / Real{2};
+
+      // Orient the bracket so that P(xlo) < 0.
+      auto xlo = plo < Real{0} ? lower : upper;
+      auto xhi = plo < Real{0} ? upper : lower;
+      auto x = (lower + upper) / Real{2};
+      auto dx_old = abs(upper - lower);
+      auto dx = dx_old;
+      auto p = eval(x, dp);
+      for (int iter = 0; iter < max_iter; ++iter)
+	{
+	  if (((x - xhi) * dp - p) * ((x - xlo) * dp - p) > Real{0}
+	      || abs(Real{2} * p) > abs(dx_old * dp))
+	    {
+	      // Bisect if Newton leaves the bracket or is too slow.
+	      dx_old = dx;
+	      dx = (xhi - xlo) / Real{2};
+	      x = xlo + dx;
+	    }
+	  else
+	    {
+	      dx_old = dx;
+	      dx = p / dp;
+	      x -= dx;
+	    }
+
+	  const auto scale = std::max(abs(x), std::numeric_limits<Real>::min());
+	  if (abs(dx) <= tol * scale)
+	    break;
+	  p = eval(x, dp);
+	  if (p == Real{0})
+	    break;
+	  if (p < Real{0})
+	    xlo = x;
+	  else
+	    xhi = x;
+	}
+
+      return x;
+    }
+
+  /**
+   * Return the real zeros of a polynomial in increasing order.
+   */
+  template<typename Real>
+    std::vector<Real>
+    real_roots(const Polynomial<Real>& poly)
+    {
+      std::vector<Real> roots;
+      for (const auto& iv : isolate_real_roots(poly))
+	{
+	  if (iv.isolated())
+	    roots.push_back(refine_real_root(poly, iv.lower, iv.upper));
+	  else
+	    roots.insert(roots.end(), iv.num_roots,
+			 (iv.lower + iv.upper) / Real{2});
+	}
+      return roots;
+    }
+
+} // namespace emsr
+
+#endif // REAL_ROOT_ISOLATION_TCC
@@ -0,0 +1,101 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file root_certification.h
+ *
+ * This file contains a posteriori inclusion radii for computed zeros
+ * of a polynomial.
+ */
+
+/**
+ * @def  ROOT_CERTIFICATION_H
+ *
+ * @brief  A guard for the root certification header.
+ */
+#ifndef ROOT_CERTIFICATION_H
+#define ROOT_CERTIFICATION_H 1
+
+#include <vector>
+#include <complex>
+
+#include <emsr/polynomial.h>
+#include <emsr/solution.h>
+#include <emsr/solver_diagnostics.h>
+
+namespace emsr
+{
+
+  /**
+   * A computed zero with a disc that contains a true zero.
+   * A certified zero has a disc that is disjoint from all the others
+   * and so contains exactly one true zero.
+   */
+  template<typename Real>
+    struct RootCertificate
+    {
+      std::complex<Real> root;
+      Real radius;
+      bool certified;
+    };
+
+  /**
+   * Return inclusion discs for a complete set of approximate zeros.
+   *
+   * The radii are the Gerschgorin-type radii
+   * @f[
+   *    r_i = n |W_i|, \quad W_i = \frac{P(z_i)}{a_n \prod_{j \ne i}(z_i - z_j)}
+   * @f]
+   * whose union contains all the zeros with each connected component
+   * of m discs holding exactly m zeros.  The rounding errors in the
+   * evaluation of P and of the products are bounded a priori and
+   * folded into the radii so the discs hold in exact arithmetic,
+   * assuming round to nearest.
+   *
+   * The polynomial is evaluated at s_certify_lanes zeros together.
+   * The cost is about that of one multipoint evaluation.
+   *
+   * Each zero that is not certified is reported to the sink as an
+   * uncertified event with the index of the zero and its radius.
+   * If the number of zeros differs from the degree nothing is certified.
+   */
+  template<typename Tp>
+    std::vector<RootCertificate<real_type_t<Tp>>>
+    certify_roots(const Polynomial<Tp>& poly,
+		  const std::vector<std::complex<real_type_t<Tp>>>& zeros,
+		  DiagnosticSink* sink = nullptr);
+
+  /**
+   * Return inclusion discs for the solutions from one of the solvers.
+   * Invalid solutions are skipped.
+   */
+  template<typename Real>
+    std::vector<RootCertificate<Real>>
+    certify_roots(const Polynomial<Real>& poly,
+		  const std::vector<Solution<Real>>& zeros,
+		  DiagnosticSink* sink = nullptr);
+
+} // namespace emsr
+
+#include <emsr/root_certification.tcc>
+
+#endif // ROOT_CERTIFICATION_H
@@ -0,0 +1,203 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file root_certification.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * root certification functions.
+ *
+ * @see root_certification.h
+ */
+
+/**
+ * @def  ROOT_CERTIFICATION_TCC
+ *
+ * @brief  A guard for the root certification implementation header.
+ */
+#ifndef ROOT_CERTIFICATION_TCC
+#define ROOT_CERTIFICATION_TCC 1
+
+#include <cmath>
+#include <limits>
+
+#include <emsr/notsospecfun.h>
+
+namespace emsr
+{
+
+  /**
+   * The number of zeros evaluated together by certify_roots.
+   */
+  inline constexpr std::size_t s_certify_lanes = 8;
+
+  /**
+   * Return the rounding error factor k u / (1 - k u)
+   * with u the unit roundoff.
+   */
+  template<typename Real>
+    Real
+    certify_gamma(int k)
+    {
+      const auto ku = Real(k) * std::numeric_limits<Real>::epsilon() / Real{2};
+      return ku / (Real{1} - ku);
+    }
+
+  /**
+   * Return inclusion discs for a complete set of approximate zeros.
+   */
+  template<typename Tp>
+    std::vector<RootCertificate<real_type_t<Tp>>>
+    certify_roots(const Polynomial<Tp>& poly,
+		  const std::vector<std::complex<real_type_t<Tp>>>& zeros,
+		  DiagnosticSink* sink)
+    {
+      using std::abs;
+      using std::hypot;
+      using std::ilogb;
+      using std::ldexp;
+      using std::real;
+      using std::imag;
+      using Real = real_type_t<Tp>;
+      constexpr auto Lanes = s_certify_lanes;
+
+      DiagnosticReporter diag("certify_roots");
+      diag.sink(sink);
+
+      const auto inf = std::numeric_limits<Real>::infinity();
+      const auto num = zeros.size();
+      std::vector<RootCertificate<Real>> cert(num);
+      for (std::size_t i = 0; i < num; ++i)
+	cert[i] = {zeros[i], inf, false};
+
+      auto n = poly.degree();
+      while (n > 0 && poly[n] == Tp{})
+	--n;
+      if (num != n || n == 0)
+	{
+	  for (std::size_t i = 0; i < num; ++i)
+	    diag.zero(SolverEvent::uncertified, i, inf);
+	  return cert;
+	}
+
+      std::vector<Real> ar(n + 1), ai(n + 1), am(n + 1);
+      for (std::size_t k = 0; k <= n; ++k)
+	{
+	  ar[k] = real(poly[k]);
+	  ai[k] = imag(poly[k]);
+	  am[k] = abs(poly[k]);
+	}
+
+      const auto err_eval = certify_gamma<Real>(10 * int(n) + 10);
+      const auto err_prod = certify_gamma<Real>(5 * int(n) + 5);
+      const auto err_op = certify_gamma<Real>(4);
+
+      // Evaluate P and the bound sum |a_k||z|^k at a block of zeros.
+      Real zr[Lanes], zi[Lanes], za[Lanes], pr[Lanes], pi[Lanes], s[Lanes];
+      for (std::size_t b = 0; b < num; b += Lanes)
+	{
+	  for (std::size_t k = 0; k < Lanes; ++k)
+	    {
+	      const auto z = b + k < num ? zeros[b + k] : std::complex<Real>{};
+	      zr[k] = real(z);
+	      zi[k] = imag(z);
+	      za[k] = abs(z);
+	      pr[k] = ar[n];
+	      pi[k] = ai[n];
+	      s[k] = am[n];
+	    }
+	  for (std::size_t j = n; j-- > 0;)
+	    for (std::size_t k = 0; k < Lanes; ++k)
+	      {
+		const auto t = pr[k] * zr[k] - pi[k] * zi[k] + ar[j];
+		pi[k] = pr[k] * zi[k] + pi[k] * zr[k] + ai[j];
+		pr[k] = t;
+		s[k] = s[k] * za[k] + am[j];
+	      }
+
+	  for (std::size_t k = 0; k < Lanes && b + k < num; ++k)
+	    {
+	      const auto i = b + k;
+	      const auto p = hypot(pr[k], pi[k]);
+	      const auto num_bound = (p + err_eval * s[k]) * (Real{1} + err_op);
+
+	      // The product is kept as a scaled mantissa and exponent
+	      // so that it cannot overflow; the scaling is exact.
+	      auto den = am[n];
+	      int scale = 0;
+	      for (std::size_t j = 0; j < num; ++j)
+		if (j != i)
+		  {
+		    den *= abs(zeros[i] - zeros[j]);
+		    if (den == Real{0})
+		      break;
+		    const auto e = ilogb(den);
+		    den = ldexp(den, -e);
+		    scale += e;
+		  }
+	      den *= Real{1} - err_prod;
+	      if (den > Real{0})
+		{
+		  const auto r = Real(n) * num_bound / den;
+		  cert[i].radius = ldexp(r, -scale) * (Real{1} + err_op);
+		}
+	    }
+	}
+
+      // A disc disjoint from all the others holds exactly one zero.
+      for (std::size_t i = 0; i < num; ++i)
+	{
+	  bool isolated = cert[i].radius < inf;
+	  for (std::size_t j = 0; j < num && isolated; ++j)
+	    if (j != i)
+	      isolated = abs(zeros[i] - zeros[j]) * (Real{1} - err_op)
+			 > cert[i].radius + cert[j].radius;
+	  cert[i].certified = isolated;
+	  if (!isolated)
+	    diag.zero(SolverEvent::uncertified, i, cert[i].radius);
+	}
+
+      return cert;
+    }
+
+  /**
+   * Return inclusion discs for the solutions from one of the solvers.
+   */
+  template<typename Real>
+    std::vector<RootCertificate<Real>>
+    certify_roots(const Polynomial<Real>& poly,
+		  const std::vector<Solution<Real>>& zeros,
+		  DiagnosticSink* sink)
+    {
+      using std::real;
+      using std::imag;
+      std::vector<std::complex<Real>> cz;
+      cz.reserve(zeros.size());
+      for (const auto& z : zeros)
+	if (is_valid(z))
+	  cz.emplace_back(real(z), imag(z));
+      return certify_roots(poly, cz, sink);
+    }
+
+} // namespace emsr
+
+#endif // ROOT_CERTIFICATION_TCC
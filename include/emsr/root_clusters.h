@@ -0,0 +1,133 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file root_clusters.h
+ *
+ * This file contains the detection of clusters of polynomial zeros
+ * and the estimation and refinement of multiple zeros.
+ */
+
+/**
+ * @def  ROOT_CLUSTERS_H
+ *
+ * @brief  A guard for the root clusters header.
+ */
+#ifndef ROOT_CLUSTERS_H
+#define ROOT_CLUSTERS_H 1
+
+#include <vector>
+#include <complex>
+
+#include <emsr/polynomial.h>
+
+namespace emsr
+{
+
+  /**
+   * A disc containing a number of zeros of a polynomial counted
+   * with multiplicity.
+   */
+  template<typename Real>
+    struct RootCluster
+    {
+      std::complex<Real> center;
+      Real radius;
+      int multiplicity;
+    };
+
+  /**
+   * Estimate the multiplicity of the zero of a polynomial nearest a point.
+   * With G = P'/P and H = G^2 - P''/P the ratio G^2/H is exactly m
+   * near an isolated zero of multiplicity m.  The result is rounded
+   * and clamped to [1, n].
+   */
+  template<typename Tp>
+    int
+    estimate_multiplicity(const Polynomial<Tp>& poly,
+			  const std::complex<real_type_t<Tp>>& z);
+
+  /**
+   * Return the radii of the Gerschgorin-type inclusion discs
+   * centered at a complete set of approximate zeros:
+   * @f[
+   *    r_i = n |W_i|, \quad W_i = \frac{P(z_i)}{a_n \prod_{j \ne i}(z_i - z_j)}
+   * @f]
+   * The union of the discs contains all the zeros and a connected
+   * component of m discs contains exactly m zeros.
+   * The radius is infinite if two approximations coincide.
+   */
+  template<typename Tp>
+    std::vector<real_type_t<Tp>>
+    inclusion_radii(const Polynomial<Tp>& poly,
+		    const std::vector<std::complex<real_type_t<Tp>>>& zeros);
+
+  /**
+   * Return the number of zeros in a disc by Pellet's test on the
+   * Taylor coefficients b_k of the polynomial at the center, or -1 if
+   * no single term dominates:
+   * @f[
+   *    |b_k| r^k > \sum_{j \ne k} |b_j| r^j
+   * @f]
+   * The rounding errors of the shift to the center are bounded and
+   * the test is made with each |b_j| at the unfavorable end of its
+   * bound so coefficients at the rounding level do not dominate.
+   */
+  template<typename Tp>
+    int
+    pellet_count(const Polynomial<Tp>& poly,
+		 const std::complex<real_type_t<Tp>>& center,
+		 real_type_t<Tp> radius);
+
+  /**
+   * Refine a zero of known multiplicity m.  A zero of multiplicity m
+   * is a simple zero of the (m-1)th derivative so Newton's method on
+   * the derivative converges quadratically.
+   */
+  template<typename Tp>
+    std::complex<real_type_t<Tp>>
+    refine_multiple_root(const Polynomial<Tp>& poly,
+			 std::complex<real_type_t<Tp>> z,
+			 int multiplicity, int max_steps = 20);
+
+  /**
+   * Group a complete set of approximate zeros into clusters.
+   *
+   * The inclusion discs are useless near a multiple zero because the
+   * approximations nearly coincide.  Instead a disc about each
+   * unassigned approximation is doubled from the rounding level until
+   * Pellet's test counts as many zeros as it holds approximations.
+   * The center of a cluster of more than one zero is the centroid
+   * refined as a multiple zero if the refinement stays in the disc.
+   * An approximation for which no disc is found is returned alone
+   * with its inclusion radius.
+   */
+  template<typename Tp>
+    std::vector<RootCluster<real_type_t<Tp>>>
+    find_root_clusters(const Polynomial<Tp>& poly,
+		       const std::vector<std::complex<real_type_t<Tp>>>& zeros);
+
+} // namespace emsr
+
+#include <emsr/root_clusters.tcc>
+
+#endif // ROOT_CLUSTERS_H
@@ -0,0 +1,315 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file root_clusters.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * root cluster functions.
+ *
+ * @see root_clusters.h
+ */
+
+/**
+ * @def  ROOT_CLUSTERS_TCC
+ *
+ * @brief  A guard for the root clusters implementation header.
+ */
+#ifndef ROOT_CLUSTERS_TCC
+#define ROOT_CLUSTERS_TCC 1
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <numeric> // For iota.
+
+namespace emsr
+{
+
+  /**
+   * Round a multiplicity estimate to the nearest integer in [1, n].
+   * This does not need a conversion from Real to int.
+   */
+  template<typename Real>
+    int
+    round_multiplicity(Real est, int n)
+    {
+      int m = 1;
+      while (m < n && Real(m) + Real{0.5} <= est)
+	++m;
+      return m;
+    }
+
+  /**
+   * Estimate the multiplicity of the zero nearest a point.
+   */
+  template<typename Tp>
+    int
+    estimate_multiplicity(const Polynomial<Tp>& poly,
+			  const std::complex<real_type_t<Tp>>& z)
+    {
+      using std::real;
+      using Real = real_type_t<Tp>;
+      using Cmplx = std::complex<Real>;
+
+      const int n = poly.degree();
+      if (n <= 1)
+	return 1;
+
+      // P, P' and P''/2 by Horner's rule.
+      Cmplx p = poly[n], dp{}, ddp{};
+      for (int j = n - 1; j >= 0; --j)
+	{
+	  ddp = z * ddp + dp;
+	  dp = z * dp + p;
+	  p = z * p + poly[j];
+	}
+      if (p == Cmplx{})
+	return 1;
+      const auto g = dp / p;
+      const auto g2 = g * g;
+      const auto h = g2 - Real{2} * ddp / p;
+      if (h == Cmplx{})
+	return 1;
+      return round_multiplicity(real(g2 / h), n);
+    }
+
+  /**
+   * Return the radii of the inclusion discs about approximate zeros.
+   */
+  template<typename Tp>
+    std::vector<real_type_t<Tp>>
+    inclusion_radii(const Polynomial<Tp>& poly,
+		    const std::vector<std::complex<real_type_t<Tp>>>& zeros)
+    {
+      using std::abs;
+      using Real = real_type_t<Tp>;
+
+      const auto n = zeros.size();
+      const auto an = abs(poly[poly.degree()]);
+      std::vector<Real> radii(n);
+      for (std::size_t i = 0; i < n; ++i)
+	{
+	  const auto p = abs(poly(zeros[i]));
+	  auto den = an;
+	  for (std::size_t j = 0; j < n; ++j)
+	    if (j != i)
+	      den *= abs(zeros[i] - zeros[j]);
+	  radii[i] = den == Real{0}
+		   ? std::numeric_limits<Real>::infinity()
+		   : Real(n) * p / den;
+	}
+      return radii;
+    }
+
+  /**
+   * Return the moduli of the Taylor coefficients of a polynomial
+   * about a point and bounds on their rounding errors.
+   * The shift by repeated synthetic division commits errors in b_k
+   * of at most 2n eps times the same sum with |a_j| and |c|,
+   * which is the shift of the moduli and has no cancellation.
+   */
+  template<typename Tp>
+    std::vector<real_type_t<Tp>>
+    taylor_moduli(const Polynomial<Tp>& poly,
+		  const std::complex<real_type_t<Tp>>& center,
+		  std::vector<real_type_t<Tp>>& error)
+    {
+      using std::abs;
+      using Real = real_type_t<Tp>;
+      using Cmplx = std::complex<Real>;
+
+      Polynomial<Cmplx> taylor(poly.begin(), poly.end());
+      taylor.shift(center);
+      Polynomial<Real> bound(Real{0}, poly.degree());
+      for (std::size_t k = 0; k <= poly.degree(); ++k)
+	bound[k] = abs(poly[k]);
+      bound.shift(abs(center));
+
+      const auto gamma = Real(2 * poly.degree() + 2)
+		       * std::numeric_limits<Real>::epsilon();
+      std::vector<Real> moduli(taylor.degree() + 1);
+      error.resize(moduli.size());
+      for (std::size_t k = 0; k < moduli.size(); ++k)
+	{
+	  moduli[k] = abs(taylor[k]);
+	  error[k] = gamma * bound[k];
+	}
+      return moduli;
+    }
+
+  /**
+   * Return the index of the dominant term of Pellet's test
+   * for the given Taylor moduli or -1 if there is none.
+   * The dominant term is taken at the low end of its error bound
+   * and the others at the high end.
+   */
+  template<typename Real>
+    int
+    pellet_index(const std::vector<Real>& moduli,
+		 const std::vector<Real>& error, Real radius)
+    {
+      auto big = Real{0};
+      auto big_err = Real{0};
+      auto sum = Real{0};
+      auto rk = Real{1};
+      int kbig = -1;
+      for (std::size_t k = 0; k < moduli.size(); ++k)
+	{
+	  const auto b = moduli[k] * rk;
+	  const auto e = error[k] * rk;
+	  sum += b + e;
+	  if (b > big)
+	    {
+	      big = b;
+	      big_err = e;
+	      kbig = k;
+	    }
+	  rk *= radius;
+	}
+      return big - big_err > sum - big ? kbig : -1;
+    }
+
+  /**
+   * Return the number of zeros in a disc by Pellet's test.
+   */
+  template<typename Tp>
+    int
+    pellet_count(const Polynomial<Tp>& poly,
+		 const std::complex<real_type_t<Tp>>& center,
+		 real_type_t<Tp> radius)
+    {
+      std::vector<real_type_t<Tp>> error;
+      const auto moduli = taylor_moduli(poly, center, error);
+      return pellet_index(moduli, error, radius);
+    }
+
+  /**
+   * Refine a zero of known multiplicity by Newton's method
+   * on the (m-1)th derivative.
+   */
+  template<typename Tp>
+    std::complex<real_type_t<Tp>>
+    refine_multiple_root(const Polynomial<Tp>& poly,
+			 std::complex<real_type_t<Tp>> z,
+			 int multiplicity, int max_steps)
+    {
+      using std::abs;
+      using Real = real_type_t<Tp>;
+      using Cmplx = std::complex<Real>;
+
+      auto q = poly;
+      for (int k = 1; k < multiplicity && q.degree() > 0; ++k)
+	q = q.derivative();
+      const auto dq = q.derivative();
+
+      const auto eps = std::numeric_limits<Real>::epsilon();
+      for (int step = 0; step < max_steps; ++step)
+	{
+	  const auto d = dq(z);
+	  if (d == Cmplx{})
+	    break;
+	  const auto dz = q(z) / d;
+	  z -= dz;
+	  if (abs(dz) <= Real{2} * eps * abs(z))
+	    break;
+	}
+      return z;
+    }
+
+  /**
+   * Group a complete set of approximate zeros into clusters.
+   */
+  template<typename Tp>
+    std::vector<RootCluster<real_type_t<Tp>>>
+    find_root_clusters(const Polynomial<Tp>& poly,
+		       const std::vector<std::complex<real_type_t<Tp>>>& zeros)
+    {
+      using std::abs;
+      using Real = real_type_t<Tp>;
+      using Cmplx = std::complex<Real>;
+
+      const auto eps = std::numeric_limits<Real>::epsilon();
+      const int max_grow = 2 * std::numeric_limits<Real>::digits;
+      const auto n = zeros.size();
+      const auto radii = inclusion_radii(poly, zeros);
+
+      std::vector<RootCluster<Real>> clusters;
+      std::vector<bool> assigned(n, false);
+      std::vector<std::size_t> members;
+      for (std::size_t i = 0; i < n; ++i)
+	{
+	  if (assigned[i])
+	    continue;
+
+	  // Grow a disc about the approximation until Pellet's test counts
+	  // as many zeros as there are unassigned approximations inside.
+	  std::vector<Real> error;
+	  const auto moduli = taylor_moduli(poly, zeros[i], error);
+	  auto r = eps * std::max(Real{1}, abs(zeros[i]));
+	  bool found = false;
+	  for (int step = 0; step < max_grow && !found; ++step, r *= Real{2})
+	    {
+	      members.clear();
+	      bool clash = false;
+	      for (std::size_t j = 0; j < n; ++j)
+		if (abs(zeros[j] - zeros[i]) <= r)
+		  {
+		    clash = clash || assigned[j];
+		    members.push_back(j);
+		  }
+	      if (clash)
+		break;
+	      found = pellet_index(moduli, error, r) == int(members.size());
+	    }
+
+	  if (!found)
+	    {
+	      assigned[i] = true;
+	      clusters.push_back({zeros[i], radii[i], 1});
+	      continue;
+	    }
+	  r /= Real{2};
+
+	  auto center = Cmplx{};
+	  for (auto j : members)
+	    {
+	      assigned[j] = true;
+	      center += zeros[j];
+	    }
+	  const int mult = members.size();
+	  center /= Real(mult);
+	  if (mult > 1)
+	    {
+	      const auto z = refine_multiple_root(poly, center, mult);
+	      if (abs(z - zeros[i]) < r)
+		center = z;
+	    }
+	  clusters.push_back({center, r + abs(center - zeros[i]), mult});
+	}
+
+      return clusters;
+    }
+
+} // namespace emsr
+
+#endif // ROOT_CLUSTERS_TCC
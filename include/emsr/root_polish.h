@@ -0,0 +1,121 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file root_polish.h
+ *
+ * This file contains the refinement of polynomial zeros
+ * in a wider floating point type.
+ */
+
+/**
+ * @def  ROOT_POLISH_H
+ *
+ * @brief  A guard for the root polishing header.
+ */
+#ifndef ROOT_POLISH_H
+#define ROOT_POLISH_H 1
+
+#include <vector>
+#include <complex>
+
+#include <emsr/polynomial.h>
+#include <emsr/solution.h>
+
+namespace emsr
+{
+
+  /**
+   * The type in which zeros of a polynomial with coefficients of type Real
+   * are polished.  This is __float128 where the compiler has it
+   * and long double otherwise.
+   */
+  template<typename Real>
+    struct polish_type
+    {
+#ifdef __SIZEOF_FLOAT128__
+      using type = __float128;
+#else
+      using type = long double;
+#endif
+    };
+
+  template<>
+    struct polish_type<float>
+    { using type = double; };
+
+  template<typename Real>
+    using polish_type_t = typename polish_type<Real>::type;
+
+  /**
+   * Return the relative condition number of a zero z of a polynomial
+   * @f[
+   *    \kappa(z) = \frac{\sum_i |a_i| |z|^i}{\max(1, |z|) |P'(z)|}
+   * @f]
+   * The relative error in a zero found in working precision is
+   * about epsilon times this.  A multiple zero has infinite condition.
+   */
+  template<typename Real>
+    Real
+    root_condition(const Polynomial<Real>& poly, const std::complex<Real>& z);
+
+  /**
+   * Polish the zeros of a polynomial whose condition number
+   * exceeds @c max_cond by simultaneous Newton (Aberth) steps
+   * in the wider type Wide.
+   *
+   * Well-conditioned zeros are left untouched so the common case costs
+   * one evaluation of the polynomial and its derivative per zero
+   * in working precision.  The polished zeros are corrected against
+   * all the other zeros so nearby zeros in a cluster repel each other
+   * rather than converging to the same place.
+   *
+   * The polished zeros are the zeros of the polynomial with the
+   * coefficients as given; the coefficients are exact in the wider type.
+   *
+   * @param poly  The polynomial.
+   * @param zeros  The approximate zeros, one per degree.
+   * @param max_cond  The condition number above which a zero is polished.
+   * @param max_steps  The maximum number of steps per zero.
+   * @return The number of zeros that were polished.
+   */
+  template<typename Real, typename Wide = polish_type_t<Real>>
+    std::size_t
+    polish_roots(const Polynomial<Real>& poly,
+		 std::vector<std::complex<Real>>& zeros,
+		 Real max_cond = Real{100}, int max_steps = 5);
+
+  /**
+   * Polish the solutions from one of the solvers.
+   * Invalid solutions are skipped and real solutions stay real.
+   */
+  template<typename Real, typename Wide = polish_type_t<Real>>
+    std::size_t
+    polish_roots(const Polynomial<Real>& poly,
+		 std::vector<Solution<Real>>& zeros,
+		 Real max_cond = Real{100}, int max_steps = 5);
+
+} // namespace emsr
+
+#include <emsr/root_polish.tcc>
+
+#endif // ROOT_POLISH_H
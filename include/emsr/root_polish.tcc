@@ -0,0 +1,245 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file root_polish.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * root polishing functions.
+ *
+ * @see root_polish.h
+ */
+
+/**
+ * @def  ROOT_POLISH_TCC
+ *
+ * @brief  A guard for the root polishing implementation header.
+ */
+#ifndef ROOT_POLISH_TCC
+#define ROOT_POLISH_TCC 1
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace emsr
+{
+
+  /**
+   * A minimal complex number for the polishing arithmetic.
+   * std::complex is only specified for the standard floating point types
+   * so it cannot be relied on for __float128.
+   */
+  template<typename Wide>
+    struct PolishComplex
+    {
+      Wide re;
+      Wide im;
+
+      friend PolishComplex
+      operator+(const PolishComplex& a, const PolishComplex& b)
+      { return {a.re + b.re, a.im + b.im}; }
+
+      friend PolishComplex
+      operator-(const PolishComplex& a, const PolishComplex& b)
+      { return {a.re - b.re, a.im - b.im}; }
+
+      friend PolishComplex
+      operator*(const PolishComplex& a, const PolishComplex& b)
+      { return {a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re}; }
+
+      friend PolishComplex
+      operator/(const PolishComplex& a, const PolishComplex& b)
+      {
+	const auto den = norm(b);
+	return {(a.re * b.re + a.im * b.im) / den,
+		(a.im * b.re - a.re * b.im) / den};
+      }
+
+      friend Wide
+      norm(const PolishComplex& a)
+      { return a.re * a.re + a.im * a.im; }
+    };
+
+  /**
+   * Return the machine epsilon of a floating point type.
+   * This does not need numeric_limits which is not specialized
+   * for __float128 in strict modes.
+   */
+  template<typename Wide>
+    Wide
+    polish_epsilon()
+    {
+      auto eps = Wide{1};
+      while (Wide{1} + eps / Wide{2} != Wide{1})
+	eps /= Wide{2};
+      return eps;
+    }
+
+  /**
+   * Return the relative condition number of a zero of a polynomial.
+   */
+  template<typename Real>
+    Real
+    root_condition(const Polynomial<Real>& poly, const std::complex<Real>& z)
+    {
+      using std::abs;
+      using Cmplx = std::complex<Real>;
+      const auto n = poly.degree();
+      const auto az = abs(z);
+      auto sum = abs(poly[n]);
+      auto p = Cmplx(poly[n]);
+      auto dp = Cmplx{};
+      for (std::size_t i = n; i-- > 0;)
+	{
+	  dp = dp * z + p;
+	  p = p * z + poly[i];
+	  sum = sum * az + abs(poly[i]);
+	}
+      const auto den = std::max(Real{1}, az) * abs(dp);
+      if (den == Real{0})
+	return std::numeric_limits<Real>::infinity();
+      return sum / den;
+    }
+
+  /**
+   * Polish the ill-conditioned zeros of a polynomial in a wider type.
+   */
+  template<typename Real, typename Wide>
+    std::size_t
+    polish_roots(const Polynomial<Real>& poly,
+		 std::vector<std::complex<Real>>& zeros,
+		 Real max_cond, int max_steps)
+    {
+      using WCmplx = PolishComplex<Wide>;
+
+      const auto num_zeros = zeros.size();
+      std::vector<bool> polish(num_zeros);
+      std::size_t num_polish = 0;
+      for (std::size_t k = 0; k < num_zeros; ++k)
+	{
+	  // Written so that a NaN condition number is polished too.
+	  polish[k] = !(root_condition(poly, zeros[k]) <= max_cond);
+	  if (polish[k])
+	    ++num_polish;
+	}
+      if (num_polish == 0)
+	return 0;
+
+      const auto n = poly.degree();
+      std::vector<Wide> a(n + 1);
+      for (std::size_t i = 0; i <= n; ++i)
+	a[i] = Wide(poly[i]);
+      std::vector<WCmplx> w(num_zeros);
+      for (std::size_t k = 0; k < num_zeros; ++k)
+	w[k] = {Wide(std::real(zeros[k])), Wide(std::imag(zeros[k]))};
+
+      const auto tol = Wide{4} * polish_epsilon<Wide>();
+      auto active = polish;
+      for (int step = 0; step < max_steps; ++step)
+	{
+	  bool any = false;
+	  for (std::size_t k = 0; k < num_zeros; ++k)
+	    {
+	      if (!active[k])
+		continue;
+
+	      auto p = WCmplx{a[n], Wide{0}};
+	      auto dp = WCmplx{Wide{0}, Wide{0}};
+	      for (std::size_t i = n; i-- > 0;)
+		{
+		  dp = dp * w[k] + p;
+		  p = p * w[k] + WCmplx{a[i], Wide{0}};
+		}
+
+	      // The Aberth correction for the other zeros.
+	      auto s = WCmplx{Wide{0}, Wide{0}};
+	      for (std::size_t j = 0; j < num_zeros; ++j)
+		if (j != k)
+		  {
+		    const auto d = w[k] - w[j];
+		    if (norm(d) != Wide{0})
+		      s = s + WCmplx{Wide{1}, Wide{0}} / d;
+		  }
+
+	      const auto den = dp - p * s;
+	      if (norm(den) == Wide{0})
+		{
+		  active[k] = false;
+		  continue;
+		}
+	      const auto dz = p / den;
+	      w[k] = w[k] - dz;
+	      if (norm(dz) <= tol * tol * norm(w[k]))
+		active[k] = false;
+	      else
+		any = true;
+	    }
+	  if (!any)
+	    break;
+	}
+
+      for (std::size_t k = 0; k < num_zeros; ++k)
+	if (polish[k])
+	  zeros[k] = std::complex<Real>(static_cast<Real>(w[k].re),
+					static_cast<Real>(w[k].im));
+
+      return num_polish;
+    }
+
+  /**
+   * Polish the ill-conditioned solutions from a solver.
+   */
+  template<typename Real, typename Wide>
+    std::size_t
+    polish_roots(const Polynomial<Real>& poly,
+		 std::vector<Solution<Real>>& zeros,
+		 Real max_cond, int max_steps)
+    {
+      using std::real;
+      using std::imag;
+      std::vector<std::complex<Real>> cz;
+      cz.reserve(zeros.size());
+      for (const auto& z : zeros)
+	if (is_valid(z))
+	  cz.emplace_back(real(z), imag(z));
+
+      const auto num_polish
+	= polish_roots<Real, Wide>(poly, cz, max_cond, max_steps);
+
+      std::size_t i = 0;
+      for (auto& z : zeros)
+	if (is_valid(z))
+	  {
+	    if (z.index() == 1)
+	      z = Solution<Real>(std::real(cz[i]));
+	    else
+	      z = Solution<Real>(cz[i]);
+	    ++i;
+	  }
+
+      return num_polish;
+    }
+
+} // namespace emsr
+
+#endif // ROOT_POLISH_TCC
@@ -96,12 +96,13 @@ namespace emsr
     constexpr Real
     abs(const Solution<Real>& x)
     {
+      using std::abs;
       if (x.index() == 0)
 	return std::numeric_limits<Real>::quiet_NaN();
       else if (x.index() == 1)
-	return std::abs(std::get<1>(x));
+	return abs(std::get<1>(x));
       else
-	return std::abs(std::get<2>(x));
+	return abs(std::get<2>(x));
     }
 
   /**
@@ -33,7 +33,13 @@
 #ifndef SOLVER_BAIRSTOW_H
 #define SOLVER_BAIRSTOW_H 1
 
+#include <vector>
+#include <cstdint>
+
 #include <emsr/solver_low_degree.h>
+#include <emsr/solver_diagnostics.h>
+#include <emsr/counter_engine.h>
+#include <emsr/polynomial_view.h>
 
 namespace emsr
 {
@@ -47,12 +53,48 @@ template<typename Real>
   {
   public:
 
+    /**
+     * Construct a solver.
+     * Restart guesses are drawn from a counter-based random stream
+     * keyed by a batch seed and the index of the polynomial in the batch
+     * so results are reproducible whatever order a batch is solved in.
+     */
     BairstowSolver(const std::vector<Real>& coeff,
-		    unsigned int seed = std::random_device()())
+		    std::uint64_t seed = 0, std::uint64_t index = 0)
     : m_coeff{coeff.rbegin(), coeff.rend()},
       m_b(coeff.size()), m_c(coeff.size()),
       m_order(coeff.size() - 1),
-      m_urng(seed), m_pdf(Real{0}, Real{2})
+      m_urng(seed, index)
+    { this->m_init(); }
+
+    /**
+     * Construct a solver from a view of coefficients in either order.
+     * The coefficients are copied once into the work array.
+     */
+    explicit
+    BairstowSolver(const PolynomialView<Real>& P,
+		    std::uint64_t seed = 0, std::uint64_t index = 0)
+    : m_coeff(P.to_vector(CoefficientOrder::descending)),
+      m_b(P.size()), m_c(P.size()),
+      m_order(P.size() - 1),
+      m_urng(seed, index)
+    { this->m_init(); }
+
+    std::vector<Solution<Real>> solve();
+    std::vector<Real> equations() const;
+
+    /**
+     * Send precision loss and restart events to a diagnostic sink.
+     * Pass nullptr to discard them, which is the default.
+     */
+    void
+    diagnostics(DiagnosticSink* sink)
+    { this->m_diag.sink(sink); }
+
+  private:
+
+    void
+    m_init()
     {
       if (this->m_coeff.size() == 0)
 	throw std::domain_error("BairstowSolver: Coefficient size must be nonzero.");
@@ -67,11 +109,6 @@ template<typename Real>
       this->m_zero.reserve(this->m_coeff.size());
     }
 
-    std::vector<Solution<Real>> solve();
-    std::vector<Real> equations() const;
-
-  private:
-
     void m_iterate();
 
     template<int Index>
@@ -89,8 +126,12 @@ template<typename Real>
     static constexpr Real s_ratio
 	= Real{std::numeric_limits<Real>::digits}
 	/ std::numeric_limits<double>::digits;
-    static constexpr int s_max_rand_iter = 200 * s_ratio;
-    static constexpr int s_max_error_iter = 500 * s_ratio;
+    static constexpr int s_max_rand_iter
+	= 200 * std::numeric_limits<Real>::digits
+	/ std::numeric_limits<double>::digits;
+    static constexpr int s_max_error_iter
+	= 500 * std::numeric_limits<Real>::digits
+	/ std::numeric_limits<double>::digits;
     static constexpr auto s_eps_factor = Real{10} * s_ratio;
     static constexpr auto s_eps
       = s_eps_factor * std::numeric_limits<Real>::epsilon();
@@ -102,8 +143,8 @@ template<typename Real>
     Real m_eps = s_eps;
     int m_order;
     bool m_precision_error = false;
-    std::mt19937 m_urng;
-    std::uniform_real_distribution<Real> m_pdf;
+    CounterEngine m_urng;
+    DiagnosticReporter m_diag{"BairstowSolver"};
   };
 
 } // namespace emsr
@@ -34,6 +34,7 @@
 #define SOLVER_BAIRSTOW_TCC 1
 
 #include <emsr/solver_low_degree.h>
+#include <emsr/synthetic_division.h>
 
 namespace emsr
 {
@@ -45,6 +46,7 @@ template<typename Real>
   void
   BairstowSolver<Real>::m_iterate()
   {
+    using std::abs;
     auto r = Real{0};
     auto s = Real{0};
     auto dr = Real{1};
@@ -53,32 +55,30 @@ template<typename Real>
     int iter = 1;
     this->m_precision_error = false;
 
-    while (std::abs(dr) + std::abs(ds) > this->m_eps)
+    while (abs(dr) + abs(ds) > this->m_eps)
       {
 	if (iter % s_max_rand_iter == 0)
-	  r = this->m_pdf(this->m_urng);
+	  {
+	    r = Real{2} * this->m_urng.template canonical<Real>();
+	    this->m_diag(SolverEvent::restart, iter, r);
+	  }
 	if (iter % s_max_error_iter == 0)
 	  {
 	    this->m_eps *= s_eps_factor;
 	    this->m_precision_error = true;
-	    std::cout << "Loss of precision: " << this->m_eps << '\n';
+	    this->m_diag(SolverEvent::precision_loss, iter, this->m_eps);
 	  }
 
-	this->m_b[1] = this->m_coeff[1] - r;
-	this->m_c[1] = this->m_b[1] - r;
-	for (int i = 2; i <= this->m_order; ++i)
-	  {
-	    this->m_b[i] = this->m_coeff[i]
-			- r * this->m_b[i - 1] - s * this->m_b[i - 2];
-	    this->m_c[i] = this->m_b[i]
-			- r * this->m_c[i - 1] - s * this->m_c[i - 2];
-	  }
+	// The leading coefficient is one so b[0] = c[0] = 1 are rewritten.
+	synthetic_divide_quadratic2(this->m_coeff.begin(),
+				    this->m_coeff.begin() + this->m_order + 1,
+				    r, s, this->m_b.begin(), this->m_c.begin());
 
 	auto dn = this->m_c[this->m_order - 1]
 		  * this->m_c[this->m_order - 3]
 		  - this->m_c[this->m_order - 2]
 		  * this->m_c[this->m_order - 2];
-	if (std::abs(dn) < std::numeric_limits<Real>::epsilon())
+	if (abs(dn) < std::numeric_limits<Real>::epsilon())
 	  {
 	    dr = Real{1};
 	    ds = Real{1};
@@ -100,7 +100,7 @@ template<typename Real>
 	r += dr;
 	s += ds;
 	++iter;
-	if (std::abs(dr) + std::abs(ds) <= this->m_eps)
+	if (abs(dr) + abs(ds) <= this->m_eps)
 	  {
 	    // Before exiting, solve the quadratic, refine the roots,
 	    // multiply out the resulting polynomial, extract
@@ -162,15 +162,16 @@ template<typename Real>
 					Real& ds, Real& s,
 					std::array<Solution<Real>, 2>& w)
     {
+      using std::real;
       const auto p = std::array<Real, 3>{s, r, Real{1}};
       w[0] = refine_solution_newton<3>(std::get<Index>(w[0]), p);
       w[1] = refine_solution_newton<3>(std::get<Index>(w[1]), p);
       const auto sp = std::get<Index>(w[0]) * std::get<Index>(w[1]);
       const auto rp = -(std::get<Index>(w[0]) + std::get<Index>(w[1]));
-      dr = std::real(rp - r);
-      r = std::real(rp);
-      ds = std::real(sp - s);
-      s = std::real(sp);
+      dr = real(rp - r);
+      r = real(rp);
+      ds = real(sp - s);
+      s = real(sp);
     }
 
 } // namespace emsr
@@ -0,0 +1,305 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file solver_diagnostics.h
+ *
+ * This file contains the diagnostic events reported by the solvers
+ * and the sinks that receive them.
+ */
+
+/**
+ * @def  SOLVER_DIAGNOSTICS_H
+ *
+ * @brief  A guard for the solver diagnostics header.
+ */
+#ifndef SOLVER_DIAGNOSTICS_H
+#define SOLVER_DIAGNOSTICS_H 1
+
+#include <cstddef>
+#include <atomic>
+#include <array>
+#include <ostream>
+
+namespace emsr
+{
+
+  /**
+   * The kinds of unusual event a solver can report.
+   */
+  enum class SolverEvent
+  {
+    /// The convergence tolerance was loosened.
+    precision_loss,
+    /// The iteration was restarted from a new starting point or shift.
+    restart,
+    /// The iteration limit was reached.
+    max_iterations,
+    /// The polynomial coefficients were rescaled.
+    rescale,
+    /// A computed zero could not be certified.
+    uncertified
+  };
+
+  /// The number of kinds of solver event.
+  inline constexpr std::size_t num_solver_events = 5;
+
+  /**
+   * Return the name of a solver event.
+   */
+  constexpr const char*
+  to_string(SolverEvent event) noexcept
+  {
+    switch (event)
+      {
+      case SolverEvent::precision_loss:
+	return "precision_loss";
+      case SolverEvent::restart:
+	return "restart";
+      case SolverEvent::max_iterations:
+	return "max_iterations";
+      case SolverEvent::rescale:
+	return "rescale";
+      case SolverEvent::uncertified:
+	return "uncertified";
+      }
+    return "unknown";
+  }
+
+  /**
+   * A record of an event in a solver.
+   * The meaning of the value depends on the event: the new tolerance
+   * for precision_loss, the scale factor for rescale, the inclusion
+   * radius for uncertified, and so on.
+   * Events that concern one zero, like uncertified, carry its index
+   * and no iteration.
+   */
+  struct SolverDiagnostic
+  {
+    SolverEvent event;
+    const char* solver;
+    /// The iteration at which the event happened, or -1 if none.
+    int iteration;
+    double value;
+    /// The index of the zero the event concerns, or -1 if none.
+    int index = -1;
+  };
+
+  /**
+   * Write a solver diagnostic to a stream.
+   */
+  template<typename CharT, typename Traits>
+    std::basic_ostream<CharT, Traits>&
+    operator<<(std::basic_ostream<CharT, Traits>& os,
+	       const SolverDiagnostic& diag)
+    {
+      os << diag.solver << ": " << to_string(diag.event);
+      if (diag.index >= 0)
+	os << " for zero " << diag.index;
+      if (diag.iteration >= 0)
+	os << " at iteration " << diag.iteration;
+      os << " (" << diag.value << ')';
+      return os;
+    }
+
+  /**
+   * The interface for receivers of solver diagnostics.
+   * Records arrive on the thread running the solver.
+   */
+  class DiagnosticSink
+  {
+  public:
+    virtual ~DiagnosticSink() = default;
+
+    virtual void
+    record(const SolverDiagnostic& diag) noexcept = 0;
+  };
+
+  /**
+   * A sink that discards all diagnostics.
+   */
+  class NullDiagnosticSink
+  : public DiagnosticSink
+  {
+  public:
+    void
+    record(const SolverDiagnostic&) noexcept override
+    { }
+  };
+
+  /**
+   * A bounded lock-free ring buffer of diagnostics.
+   *
+   * One thread, normally the one running the solvers, records and one
+   * thread drains.  Give each worker thread its own buffer.
+   * When the buffer is full new records are dropped and counted.
+   * Counts of each kind of event are kept whether or not the record
+   * itself fits.
+   */
+  template<std::size_t Capacity = 1024>
+    class RingBufferSink
+    : public DiagnosticSink
+    {
+      static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+		    "RingBufferSink: Capacity must be a power of two");
+
+    public:
+
+      void
+      record(const SolverDiagnostic& diag) noexcept override
+      {
+	this->m_count[static_cast<std::size_t>(diag.event)]
+	  .fetch_add(1, std::memory_order_relaxed);
+	const auto head = this->m_head.load(std::memory_order_relaxed);
+	const auto tail = this->m_tail.load(std::memory_order_acquire);
+	if (head - tail == Capacity)
+	  {
+	    this->m_dropped.fetch_add(1, std::memory_order_relaxed);
+	    return;
+	  }
+	this->m_buffer[head & (Capacity - 1)] = diag;
+	this->m_head.store(head + 1, std::memory_order_release);
+      }
+
+      /**
+       * Remove the oldest diagnostic from the buffer.
+       * Returns false if the buffer is empty.
+       */
+      bool
+      pop(SolverDiagnostic& diag) noexcept
+      {
+	const auto tail = this->m_tail.load(std::memory_order_relaxed);
+	const auto head = this->m_head.load(std::memory_order_acquire);
+	if (tail == head)
+	  return false;
+	diag = this->m_buffer[tail & (Capacity - 1)];
+	this->m_tail.store(tail + 1, std::memory_order_release);
+	return true;
+      }
+
+      /**
+       * Remove all the diagnostics in the buffer writing them
+       * to the output iterator.  The next output iterator is returned.
+       */
+      template<typename OutIter>
+	OutIter
+	drain(OutIter out)
+	{
+	  SolverDiagnostic diag;
+	  while (this->pop(diag))
+	    *out++ = diag;
+	  return out;
+	}
+
+      /**
+       * Return the number of diagnostics waiting in the buffer.
+       */
+      std::size_t
+      size() const noexcept
+      {
+	return this->m_head.load(std::memory_order_acquire)
+	     - this->m_tail.load(std::memory_order_acquire);
+      }
+
+      static constexpr std::size_t
+      capacity() noexcept
+      { return Capacity; }
+
+      /**
+       * Return the number of events of a kind recorded so far.
+       */
+      std::size_t
+      count(SolverEvent event) const noexcept
+      {
+	return this->m_count[static_cast<std::size_t>(event)]
+		.load(std::memory_order_relaxed);
+      }
+
+      /**
+       * Return the number of records dropped because the buffer was full.
+       */
+      std::size_t
+      dropped() const noexcept
+      { return this->m_dropped.load(std::memory_order_relaxed); }
+
+    private:
+
+      std::array<SolverDiagnostic, Capacity> m_buffer{};
+      std::atomic<std::size_t> m_head{0};
+      std::atomic<std::size_t> m_tail{0};
+      std::array<std::atomic<std::size_t>, num_solver_events> m_count{};
+      std::atomic<std::size_t> m_dropped{0};
+    };
+
+  /**
+   * The solver side of the diagnostics.
+   * A solver holds one of these and reports through it.
+   * With no sink attached reporting costs a test and a branch.
+   */
+  class DiagnosticReporter
+  {
+  public:
+
+    explicit constexpr
+    DiagnosticReporter(const char* solver) noexcept
+    : m_solver(solver)
+    { }
+
+    DiagnosticSink*
+    sink() const noexcept
+    { return this->m_sink; }
+
+    void
+    sink(DiagnosticSink* sink) noexcept
+    { this->m_sink = sink; }
+
+    template<typename Real>
+      void
+      operator()(SolverEvent event, int iteration, Real value) const noexcept
+      {
+	if (this->m_sink != nullptr)
+	  this->m_sink->record({event, this->m_solver, iteration,
+				static_cast<double>(value)});
+      }
+
+    /**
+     * Report an event concerning the zero with the given index.
+     */
+    template<typename Real>
+      void
+      zero(SolverEvent event, std::size_t index, Real value) const noexcept
+      {
+	if (this->m_sink != nullptr)
+	  this->m_sink->record({event, this->m_solver, -1,
+				static_cast<double>(value),
+				static_cast<int>(index)});
+      }
+
+  private:
+
+    const char* m_solver;
+    DiagnosticSink* m_sink = nullptr;
+  };
+
+} // namespace emsr
+
+#endif // SOLVER_DIAGNOSTICS_H
@@ -33,7 +33,10 @@
 #ifndef SOLVER_JENKINS_TRAUB_H
 #define SOLVER_JENKINS_TRAUB_H 1
 
+#include <emsr/notsospecfun.h>
 #include <emsr/solution.h> // For Solution
+#include <emsr/solver_diagnostics.h>
+#include <emsr/polynomial_view.h>
 
 namespace emsr
 {
@@ -49,10 +52,29 @@ template<typename Real>
     JenkinsTraubSolver(const std::vector<Real>& op);
     JenkinsTraubSolver(std::vector<Real>&& op);
 
+    /**
+     * Construct a solver from a view of coefficients in either order.
+     * The coefficients are copied once into the deflation array.
+     */
+    explicit
+    JenkinsTraubSolver(const PolynomialView<Real>& P)
+    : JenkinsTraubSolver(P.to_vector(CoefficientOrder::descending))
+    { }
+
     std::vector<Solution<Real>> solve();
 
+    /**
+     * Send rescale, restart and iteration limit events to a diagnostic sink.
+     * Pass nullptr to discard them, which is the default.
+     */
+    void
+    diagnostics(DiagnosticSink* sink)
+    { this->m_diag.sink(sink); }
+
   private:
 
+    void m_init();
+
     enum NormalizationType
     {
       none,
@@ -112,6 +134,7 @@ template<typename Real>
     int m_order;
     bool m_zerok;
     int m_num_iters = 0;
+    DiagnosticReporter m_diag{"JenkinsTraubSolver"};
   };
 
 } // namespace emsr
@@ -34,7 +34,11 @@
 #ifndef SOLVER_JENKINS_TRAUB_TCC
 #define SOLVER_JENKINS_TRAUB_TCC 1
 
+#include <tuple> // For tie.
+
 #include <emsr/solver_low_degree.h>
+#include <emsr/synthetic_division.h>
+#include <emsr/newton_polygon.h>
 
 namespace emsr
 {
@@ -46,6 +50,23 @@ template<typename Real>
   JenkinsTraubSolver<Real>::
   JenkinsTraubSolver(const std::vector<Real>& op)
   : m_P(op)
+  { this->m_init(); }
+
+/**
+ * Constructor from input polynomial taking over the coefficient array.
+ */
+template<typename Real>
+  JenkinsTraubSolver<Real>::
+  JenkinsTraubSolver(std::vector<Real>&& op)
+  : m_P(std::move(op))
+  { this->m_init(); }
+
+/**
+ * Check the polynomial and size the work arrays.
+ */
+template<typename Real>
+  void
+  JenkinsTraubSolver<Real>::m_init()
   {
     if (this->m_P.size() == 0)
       throw std::domain_error("Polynomial degree must be at least 1.");
@@ -70,11 +91,16 @@ template<typename Real>
   std::vector<Solution<Real>>
   JenkinsTraubSolver<Real>::solve()
   {
+    using std::abs;
+    using std::pow;
+    using std::sin;
+    using std::cos;
+    using std::ilogb;
     // Initialization of constants for shift rotation.
     auto xx = 1 / Real{1.4142'13562'37309'50488'01688'72420'96980'78569e+0L};
     auto yy = -xx;
-    const auto cosr = std::cos(s_rotation);
-    const auto sinr = std::sin(s_rotation);
+    const auto cosr = cos(s_rotation);
+    const auto sinr = sin(s_rotation);
 
     std::vector<Solution<Real>> zero;
     zero.reserve(this->m_P.size());
@@ -125,7 +151,7 @@ template<typename Real>
 	auto a_min = s_huge;
 	for (int i = 0; i <= this->m_order; ++i)
 	  {
-	    const auto x = std::abs(this->m_P[i]);
+	    const auto x = abs(this->m_P[i]);
 	    if (x > a_max)
 	      a_max = x;
 	    if (x != Real{0} && x < a_min)
@@ -149,55 +175,22 @@ template<typename Real>
 	    // Scale polynomial.
 	    if (scale == Real{0})
 	      scale = s_tiny;
-	    const auto l = std::ilogb(scale);
-	    const auto factor = std::pow(s_base, l);
+	    const auto l = ilogb(scale);
+	    const auto factor = pow(s_base, l);
 	    if (factor != Real{1})
-	      for (int i = 0; i <= this->m_order; ++i)
-		this->m_P[i] *= factor;
+	      {
+		for (int i = 0; i <= this->m_order; ++i)
+		  this->m_P[i] *= factor;
+		this->m_diag(SolverEvent::rescale, this->m_num_iters, factor);
+	      }
 	  }
 
 	// Compute lower bound on moduli of roots.
+	pt.resize(this->m_order + 1);
 	for (int i = 0; i <= this->m_order; ++i)
-	  pt[i] = std::abs(this->m_P[i]);
-	pt[this->m_order] = -pt[this->m_order];
-	// Compute upper estimate of bound.
-	auto x = std::exp((std::log(-pt[this->m_order])
-			    - std::log(pt[0])) / Real(this->m_order));
-	// If Newton step at the origin is better, use it.	
-	if (pt[this->m_order - 1] != Real{0})
-	  {
-	    const auto xm = -pt[this->m_order] / pt[this->m_order - 1];
-	    if (xm < x)
-	      x = xm;
-	  }
-	// Chop the interval (0,x) until ff <= 0.
-	while (true)
-	  {
-	    auto xm = x * Real{0.1L};
-	    auto ff = pt[0];
-	    for (int i = 1; i <= this->m_order; ++i)
-	      ff = ff * xm + pt[i];
-	    if (ff <= Real{0})
-	      break;
-	    x = xm;
-	  }
-	// Do Newton interation until x converges to two decimal places.
-	auto dx = x;
-	while (std::abs(dx / x) > this->m_min_log_deriv)
-	  {
-	    auto ff = pt[0];
-	    auto df = ff;
-	    for (int i = 1; i < this->m_order; ++i)
-	      {
-		ff = ff * x + pt[i];
-		df = df * x + ff;
-	      }
-	    ff = ff * x + pt[this->m_order];
-	    dx = ff / df;
-	    x -= dx;
-	    ++this->m_num_iters;
-	  }
-	const auto bound = x;
+	  pt[i] = abs(this->m_P[i]);
+	const auto bound = cauchy_lower_bound(pt, this->m_min_log_deriv,
+					      this->m_num_iters);
 	// Compute the derivative as the initial _H polynomial
 	// and do 5 steps with no shift.
 	const auto nm1 = this->m_order - 1;
@@ -223,8 +216,8 @@ template<typename Real>
 		    this->m_H[j] = t * this->m_H[j - 1] + this->m_P[j];
 		  }
 		this->m_H[0] = this->m_P[0];
-		this->m_zerok = (std::abs(this->m_H[this->m_order - 1])
-			    <= Real{10} * s_eps * std::abs(bb));
+		this->m_zerok = (abs(this->m_H[this->m_order - 1])
+			    <= Real{10} * s_eps * abs(bb));
 	    }
 	    else
 	      {
@@ -278,6 +271,10 @@ template<typename Real>
 
 	    // If the iteration is unsuccessful another quadratic
 	    // is chosen after restoring H.
+	    this->m_diag(count + 1 < 20
+			 ? SolverEvent::restart
+			 : SolverEvent::max_iterations,
+			 this->m_num_iters, bound);
 	    this->m_H = _H_temp;
 	 }
       }
@@ -294,6 +291,7 @@ template<typename Real>
   int
   JenkinsTraubSolver<Real>::fxshfr(int l2)
   {
+    using std::abs;
     Real ts_old{}, tv_old{};
     int iflag;
 
@@ -332,9 +330,9 @@ template<typename Real>
 
 	// Compute relative measures of convergence of s and v sequences.
 	if (vv != Real{0})
-	  tv = std::abs((vv - vv_old) / vv);
+	  tv = abs((vv - vv_old) / vv);
 	if (ss != Real{0})
-	  ts = std::abs((ss - ss_old) / ss);
+	  ts = abs((ss - ss_old) / ss);
 
 	// If decreasing, multiply two most recent convergence measures.
 	const auto tvv = tv < tv_old ? tv * tv_old : Real{1};
@@ -428,7 +426,11 @@ template<typename Real>
   int
   JenkinsTraubSolver<Real>::iter_quadratic(Real uu, Real vv)
   {
-    Real mp, mp_old{}, ee, relstp = std::sqrt(s_eps), t, zm;
+    using std::abs;
+    using std::sqrt;
+    using std::real;
+    using std::imag;
+    Real mp, mp_old{}, ee, relstp = sqrt(s_eps), t, zm;
     NormalizationType type;
 
     int num_zeros = 0;
@@ -444,26 +446,26 @@ template<typename Real>
 			this->m_z_small, this->m_z_large);
 	// Return if roots of the quadratic are real and not
 	// close to multiple or nearly equal and of opposite sign.
-	if (std::abs(std::abs(real(this->m_z_small))
-		   - std::abs(real(this->m_z_large)))
-	       > Real{0.01L} * std::abs(real(this->m_z_large)))
+	if (abs(abs(real(this->m_z_small))
+		   - abs(real(this->m_z_large)))
+	       > Real{0.01L} * abs(real(this->m_z_large)))
 	  return num_zeros;
 	// Evaluate polynomial by quadratic synthetic division.
 	this->remquo_quadratic(this->m_order, this->m_u, this->m_v,
 			       this->m_P, this->m_P_quot, this->m_a, this->m_b);
-	mp = std::abs(this->m_a - real(this->m_z_small) * this->m_b)
-	   + std::abs(imag(this->m_z_small) * this->m_b);
+	mp = abs(this->m_a - real(this->m_z_small) * this->m_b)
+	   + abs(imag(this->m_z_small) * this->m_b);
 	// Compute a rigorous bound on the rounding error in evaluating _P.
-	zm = std::sqrt(std::abs(this->m_v));
-	ee = Real{2} * std::abs(this->m_P_quot[0]);
+	zm = sqrt(abs(this->m_v));
+	ee = Real{2} * abs(this->m_P_quot[0]);
 	t = -real(this->m_z_small) * this->m_b;
 	for (int i = 1; i < this->m_order; ++i)
-	  ee = ee * zm + std::abs(this->m_P_quot[i]);
-	ee = ee * zm + std::abs(this->m_a + t);
+	  ee = ee * zm + abs(this->m_P_quot[i]);
+	ee = ee * zm + abs(this->m_a + t);
 	ee *= (Real{5} * this->m_mre + Real{4} * this->m_are);
 	ee -= (Real{5} * this->m_mre + Real{2} * this->m_are)
-	    * (std::abs(this->m_a + t) + std::abs(this->m_b) * zm);
-	ee += Real{2} * this->m_are * std::abs(t);
+	    * (abs(this->m_a + t) + abs(this->m_b) * zm);
+	ee += Real{2} * this->m_are * abs(t);
 	// Iteration has converged sufficiently if the
 	// polynomial value is less than 20 times this bound.
 	if (mp <= Real{20} * ee)
@@ -486,7 +488,7 @@ template<typename Real>
 	    // If vi is zero the iteration is not converging.
 	    if (vi == Real{0})
 	      return num_zeros;
-	    relstp = std::abs((vi - this->m_v) / vi);
+	    relstp = abs((vi - this->m_v) / vi);
 	    this->m_u = ui;
 	    this->m_v = vi;
 	    continue;
@@ -495,7 +497,7 @@ template<typename Real>
 	// Five fixed shift steps are taken with a u, v close to the cluster.
 	if (relstp < s_eps)
 	  relstp = s_eps;
-	relstp = std::sqrt(relstp);
+	relstp = sqrt(relstp);
 	this->m_u -= this->m_u * relstp;
 	this->m_v += this->m_v * relstp;
 	this->remquo_quadratic(this->m_order, this->m_u, this->m_v,
@@ -522,8 +524,9 @@ template<typename Real>
   int
   JenkinsTraubSolver<Real>::iter_real(Real sss, int& iflag)
   {
+    using std::abs;
     auto t = Real{0};
-    decltype(std::abs(this->m_P[0])) mp_old{};
+    decltype(abs(this->m_P[0])) mp_old{};
 
     int num_zeros = 0;
     auto s = sss;
@@ -533,21 +536,18 @@ template<typename Real>
     while (true)
       {
 	++this->m_num_iters;
-	auto pval = this->m_P[0];
 	// Evaluate P at s.
-	this->m_P_quot[0] = pval;
-	for (int i = 1; i <= this->m_order; ++i)
-	  {
-	    pval = pval * s + this->m_P[i];
-	    this->m_P_quot[i] = pval;
-	  }
-	auto mp = std::abs(pval);
+	const auto pval
+	  = synthetic_divide_linear(this->m_P.begin(),
+				    this->m_P.begin() + this->m_order + 1,
+				    s, this->m_P_quot.begin());
+	auto mp = abs(pval);
 	// Compute a rigorous bound on the error in evaluating P.
-	const auto ms = std::abs(s);
+	const auto ms = abs(s);
 	auto ee = (this->m_mre / (this->m_are + this->m_mre))
-		  * std::abs(this->m_P_quot[0]);
+		  * abs(this->m_P_quot[0]);
 	for (int i = 1; i <= this->m_order; ++i)
-	  ee = ee * ms + std::abs(this->m_P_quot[i]);
+	  ee = ee * ms + abs(this->m_P_quot[i]);
 	// Iteration has converged sufficiently if the polynomial
 	// value is less than 20 times this bound.
 	if (mp <= Real{20}
@@ -562,7 +562,7 @@ template<typename Real>
 	if (i_real > this->m_max_iter_real)
 	  return num_zeros;
 	else if (i_real < 2
-	  || std::abs(t) > Real{0.001L} * std::abs(s - t)
+	  || abs(t) > Real{0.001L} * abs(s - t)
 	  || mp < mp_old)
 	  {
 	    // Return if the polynomial value has increased significantly.
@@ -577,8 +577,8 @@ template<typename Real>
 		this->m_H_quot[i] = hval;
 	      }
 
-	    if (std::abs(hval)
-		 <= std::abs(this->m_H[this->m_order - 1]) * Real{10} * s_eps)
+	    if (abs(hval)
+		 <= abs(this->m_H[this->m_order - 1]) * Real{10} * s_eps)
 	      {
 		// Use unscaled form.
 		this->m_H[0] = Real{0};
@@ -600,8 +600,8 @@ template<typename Real>
 	    for (int i = 1; i < this->m_order; ++i)
 	      hval = hval * s + this->m_H[i];
 	    auto t = Real{0};
-	    if (std::abs(hval)
-		 > std::abs(this->m_H[this->m_order - 1] * Real{10} * s_eps))
+	    if (abs(hval)
+		 > abs(this->m_H[this->m_order - 1] * Real{10} * s_eps))
 	      t = -pval / hval;
 	    s += t;
 	  }
@@ -627,15 +627,16 @@ template<typename Real>
   typename JenkinsTraubSolver<Real>::NormalizationType
   JenkinsTraubSolver<Real>::init_next_h_poly()
   {
+    using std::abs;
     const auto eps = Real{100} * s_eps;
     // Synthetic division of H by the quadratic 1, u, v
     NormalizationType type = none;
     this->remquo_quadratic(this->m_order - 1, this->m_u, this->m_v,
 			   this->m_H, this->m_H_quot, this->m_c, this->m_d);
-    if (std::abs(this->m_c) > eps * std::abs(this->m_H[this->m_order - 1])
-     || std::abs(this->m_d) > eps * std::abs(this->m_H[this->m_order - 2]))
+    if (abs(this->m_c) > eps * abs(this->m_H[this->m_order - 1])
+     || abs(this->m_d) > eps * abs(this->m_H[this->m_order - 2]))
       {
-	if (std::abs(this->m_d) < std::abs(this->m_c))
+	if (abs(this->m_d) < abs(this->m_c))
 	  {
 	    type = divide_by_c;
 	    this->m_e = this->m_a / this->m_c;
@@ -679,6 +680,7 @@ template<typename Real>
   void
   JenkinsTraubSolver<Real>::next_h_poly(NormalizationType type)
   {
+    using std::abs;
     if (type == near_h_root)
       {
 	// Use unscaled form of the recurrence if type is 3.
@@ -691,7 +693,7 @@ template<typename Real>
     auto ab_temp = this->m_a;
     if (type == divide_by_c)
       ab_temp = this->m_b;
-    if (std::abs(this->m_a1) <= std::abs(ab_temp) * s_eps * Real{10})
+    if (abs(this->m_a1) <= abs(ab_temp) * s_eps * Real{10})
       {
 	// If a1 is nearly zero then use a special form of the recurrence.
 	this->m_H[0] = Real{0};
@@ -767,17 +769,9 @@ template<typename Real>
 					       std::vector<Real>& quot,
 					       Real& a, Real& b)
   {
-    b = poly[0];
-    quot[0] = b;
-    a = poly[1] - b * u;
-    quot[1] = a;
-    for (int i = 2; i <= nn; ++i)
-      {
-	auto c = poly[i] - a * u - b * v;
-	quot[i] = c;
-	b = a;
-	a = c;
-      }	
+    std::tie(a, b) = synthetic_divide_quadratic(poly.begin(),
+						poly.begin() + nn + 1,
+						u, v, quot.begin());
   }
 
 
@@ -794,6 +788,9 @@ template<typename Real>
 					Solution<Real>& z_small,
 					Solution<Real>& z_large)
   {
+    using std::abs;
+    using std::sqrt;
+    using std::copysign;
     z_small = {};
     z_large = {};
     if (a == Real{0})
@@ -814,22 +811,22 @@ template<typename Real>
     auto b2 = b / Real{2};
 
     Real d, e;
-    if (std::abs(b2) < std::abs(c))
+    if (abs(b2) < abs(c))
       {
-	e = std::copysign(a, c);
-	e = b2 * (b2 / std::abs(c)) - e;
-	d = std::sqrt(std::abs(e)) * std::sqrt(std::abs(c));
+	e = copysign(a, c);
+	e = b2 * (b2 / abs(c)) - e;
+	d = sqrt(abs(e)) * sqrt(abs(c));
       }
     else
       {
 	e = Real{1} - (a / b2) * (c / b2);
-	d = std::sqrt(std::abs(e)) * std::abs(b2);
+	d = sqrt(abs(e)) * abs(b2);
       }
 
     if (e < Real{0})
       { // complex conjugate zeros.
-	z_small = std::complex<Real>(-b2 / a, +std::abs(d / a));
-	z_large = std::complex<Real>(-b2 / a, -std::abs(d / a));
+	z_small = std::complex<Real>(-b2 / a, +abs(d / a));
+	z_large = std::complex<Real>(-b2 / a, -abs(d / a));
       }
     else
       {
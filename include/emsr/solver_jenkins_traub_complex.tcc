@@ -10,6 +10,9 @@
 #include <complex>
 #include <limits>
 
+#include <emsr/synthetic_division.h>
+#include <emsr/newton_polygon.h>
+
 namespace emsr
 {
 
@@ -21,8 +24,8 @@ public:
 
     using Cmplx = std::complex<Real>;
 
-    JenkinsTraubSolver(const std::vector<Cmplx>& op)
-    : m_p(op)
+    JenkinsTraubSolver(std::vector<Cmplx> op)
+    : m_p(std::move(op))
     {
         if (this->m_p.size() == 0)
             throw std::domain_error("Polynomial degree must be at least 1.");
@@ -39,6 +42,15 @@ public:
         this->m_sh.resize(this->m_degree + 1);
     }
 
+    /**
+     * Construct a solver from a view of coefficients in either order.
+     * The coefficients are copied once into the deflation array.
+     */
+    explicit
+    JenkinsTraubSolver(const PolynomialView<Cmplx>& P)
+    : JenkinsTraubSolver(P.to_vector(CoefficientOrder::descending))
+    { }
+
     std::vector<Cmplx>
     solve()
     {
@@ -47,6 +59,14 @@ public:
         return zero;
     }
 
+    /**
+     * Send rescale, restart and iteration limit events to a diagnostic sink.
+     * Pass nullptr to discard them, which is the default.
+     */
+    void
+    diagnostics(DiagnosticSink* sink)
+    { this->m_diag.sink(sink); }
+
 private:
 
     Cmplx m_s;
@@ -63,6 +83,8 @@ private:
     std::vector<Cmplx> m_qh;
     std::vector<Cmplx> m_sh;
 
+    DiagnosticReporter m_diag{"JenkinsTraubSolver<complex>"};
+
     inline static constexpr Cmplx ZERO{0.0, 0.0};
 
     static constexpr auto s_sqrt2 = Real{1.4142'13562'37309'50488'01688'72420'96980'78569e+0L};
@@ -81,6 +103,9 @@ private:
     int
     solve(std::vector<Cmplx>& zero)
     {
+      using std::abs;
+      using std::sin;
+      using std::cos;
         int cnt1, cnt2, i;
         bool converged;
         Cmplx z;
@@ -91,8 +116,8 @@ private:
         mul_rel_err = 2 * s_sqrt2 * epsilon;
         Real xx = 1 / s_sqrt2;
         Real yy = -xx;
-        Real cosr = std::cos(s_rotation);
-        Real sinr = std::sin(s_rotation);
+        Real cosr = cos(s_rotation);
+        Real sinr = sin(s_rotation);
 
         zero.reserve(this->m_degree + 1);
 
@@ -107,14 +132,17 @@ private:
         for (i = 0; i <= this->m_degree; ++i)
         {
             //p[i] = op[i];
-            this->m_sh[i] = std::abs(this->m_p[i]);
+            this->m_sh[i] = abs(this->m_p[i]);
         }
 
         // Scale the polynomial
         auto bound = this->m_scale(this->m_degree, this->m_sh, epsilon, infin, smalno, base);
         if (bound != Real{1})
+        {
             for (i = 0; i <= this->m_degree; ++i)
                 this->m_p[i] *= bound;
+            this->m_diag(SolverEvent::rescale, 0, bound);
+        }
 
     search: 
         if (this->m_degree <= 1)
@@ -124,10 +152,12 @@ private:
         }
 
         // Calculate bound, a lower bound on the modulus of the zeros
-        for (i = 0; i <= this->m_degree; ++i)
-            this->m_sh[i] = std::abs(this->m_p[i]);
-
-        bound = this->m_cauchy(this->m_degree, this->m_sh);
+        {
+            std::vector<Real> moduli(this->m_degree + 1);
+            for (i = 0; i <= this->m_degree; ++i)
+                moduli[i] = abs(this->m_p[i]);
+            bound = cauchy_lower_bound(moduli);
+        }
 
         // Outer loop to control 2 Major passes with different sequences of shifts
         for (cnt1 = 1; cnt1 <= 2; ++cnt1)
@@ -159,12 +189,14 @@ private:
                     goto search;
                 }
                 // If the iteration is unsuccessful another shift is chosen
+                this->m_diag(SolverEvent::restart, 10 * cnt2, bound);
             }
             // If 9 shifts fail, the outer loop is repeated with another sequence of shifts
         }
 
         // The zerofinder has failed on two major passes
         // return empty handed with the number of roots found (less than the original degree)
+        this->m_diag(SolverEvent::max_iterations, this->m_degree, bound);
 
         return this->m_degree;       
     }
@@ -176,6 +208,7 @@ private:
     void
     m_no_shift(int num_no_shift_iters)
     {
+      using std::abs;
         auto n = this->m_degree;
         auto nm1 = n - 1;
         for (int i = 0; i < n; ++i)
@@ -185,7 +218,7 @@ private:
         }
         for (int jj = 1; jj <= num_no_shift_iters; ++jj)
         {
-            if (std::abs(this->m_h[n - 1]) > epsilon * 10 * std::abs(this->m_p[n - 1]))
+            if (abs(this->m_h[n - 1]) > epsilon * 10 * abs(this->m_p[n - 1]))
             {
                 this->m_t = -this->m_p[this->m_degree] / this->m_h[n - 1];
                 for (int i = 0; i < nm1; ++i)
@@ -219,6 +252,7 @@ private:
     void
     m_fixed_shift(int num_fixed_shift_iters, Cmplx& z, bool& converged)
     {
+      using std::abs;
         auto n = this->m_degree;
         this->m_poly_eval(this->m_degree, this->m_s, this->m_p, this->m_qp, this->m_pv);
         bool test = true;
@@ -242,7 +276,7 @@ private:
             // is the last H Polynomial
             if (!(h_is_tiny || !test || j == 12))
             {
-                if (std::abs(this->m_t - ot) < 0.5 * std::abs(z))
+                if (abs(this->m_t - ot) < 0.5 * abs(z))
                 {
                     if (pasd)
                     {
@@ -290,6 +324,8 @@ private:
     void
     m_variable_shift(int num_variable_shift_iters, Cmplx &z, bool &converged)
     {
+      using std::abs;
+      using std::sqrt;
         bool h_is_tiny;
         Real omp, relstp;
 
@@ -302,8 +338,8 @@ private:
         {
             // Evaluate P at S and test for convergence
             this->m_poly_eval(this->m_degree, this->m_s, this->m_p, this->m_qp, this->m_pv);
-            auto mp = std::abs(this->m_pv);
-            auto ms = std::abs(this->m_s);
+            auto mp = abs(this->m_pv);
+            auto ms = abs(this->m_s);
             if (mp <= 20 * this->m_error_eval(this->m_degree, this->m_qp, ms, mp, add_rel_err, mul_rel_err))
             {
                 // Polynomial value is smaller in value than a bound onthe error
@@ -322,7 +358,7 @@ private:
                     b = 1;
                     if (relstp < epsilon)
                         tp = epsilon;
-                    Real r1 = std::sqrt(tp);
+                    Real r1 = sqrt(tp);
                     Real r2 = this->m_s.real() * (1 + r1) - this->m_s.imag() * r1;
                     this->m_s.imag(this->m_s.real() * r1 + this->m_s.imag() * (1 + r1));
                     this->m_s.real(r2);
@@ -349,7 +385,7 @@ private:
             this->m_calc_t(h_is_tiny);
             if (!h_is_tiny)
             {
-                relstp = std::abs(this->m_t) / std::abs(this->m_s);
+                relstp = abs(this->m_t) / abs(this->m_s);
                 this->m_s += this->m_t;
             }
         }
@@ -362,12 +398,13 @@ private:
     void
     m_calc_t(bool& h_is_tiny)
     {
+      using std::abs;
         auto n = this->m_degree;
 
         // evaluate h(s)
         Cmplx hv;
         this->m_poly_eval(n - 1, this->m_s, this->m_h, this->m_qh, hv);
-        h_is_tiny = std::abs(hv) <= add_rel_err * 10 * std::abs(this->m_h[n - 1]) ? true : false;
+        h_is_tiny = abs(hv) <= add_rel_err * 10 * abs(this->m_h[n - 1]) ? true : false;
         if (!h_is_tiny)
         {
             this->m_t = -this->m_pv / hv;
@@ -413,14 +450,8 @@ private:
     m_poly_eval(int nn, const Cmplx& s, const std::vector<Cmplx>& p,
            std::vector<Cmplx>& q, Cmplx &pv)  
     {
-        q[0] = p[0];
-        pv = q[0];
-
-        for (int i = 1; i <= nn; ++i)
-        {
-            pv = pv * s + p[i];
-            q[i] = pv;
-        }
+        pv = emsr::synthetic_divide_linear(p.begin(), p.begin() + nn + 1,
+                                           s, q.begin());
     }
 
     /**
@@ -436,63 +467,14 @@ private:
     m_error_eval(int nn, const std::vector<Cmplx>& q,
           Real ms, Real mp, Real add_rel_err, Real mul_rel_err)
     {
-        auto e = std::abs(q[0]) * mul_rel_err / (add_rel_err + mul_rel_err);
+      using std::abs;
+        auto e = abs(q[0]) * mul_rel_err / (add_rel_err + mul_rel_err);
         for(int i = 0; i <= nn; ++i)
-            e = e * ms + std::abs(q[i]);
+            e = e * ms + abs(q[i]);
 
         return e * (add_rel_err + mul_rel_err) - mp * mul_rel_err;
     }
 
-    /**
-     * Cauchy computes a lower bound on the moduli of the zeros of a polynomial.
-     * @param[in]  pt  The modulus of the coefficients.
-     */
-    Real
-    m_cauchy(int nn, std::vector<Cmplx>& pt)
-    {
-        pt[nn].real(-pt[nn].real());
-
-        // Compute upper estimate bound
-        auto n = nn;
-        auto x = std::exp(std::log(-pt[nn].real()) - std::log(pt[0].real())) / n;
-        if (pt[n - 1].real() != 0)
-        {
-            // Newton step at the origin is better, use it
-            auto xm = -pt[nn].real() / pt[n - 1].real();
-            if (xm < x)
-                x = xm;
-        }
-
-        // Chop the interval (0,x) until f < 0
-        while (true)
-        {
-            auto xm = x * 0.1;
-            auto f = pt[0].real();
-            for (int i = 1; i <= nn; ++i)
-                f = f * xm + pt[i].real();
-            if (f <= 0)
-                break;
-            x = xm;
-        }
-        auto dx = x;
-
-        // Do Newton iteration until x converges to two decimal places
-        while (std::fabs(dx / x) > 0.005)
-        {
-            pt[0].imag(pt[0].real());
-            for (int i = 1; i <= nn; ++i)
-                pt[i].imag(pt[i - 1].imag() * x + pt[i].real());
-            auto f = pt[nn].imag();
-            auto df = pt[0].imag();
-            for (int i = 1; i < n; ++i)
-                df = df * x + pt[i].imag();
-            dx = f / df;
-            x -= dx;
-        }
-
-        return x;
-    }
-
     // Returns a scale factor to multiply the coefficients of the polynomial.
     // The scaling is done to avoid overflow and to avoid undetected underflow
     // interfering with the convergence criterion.  The factor is a power of the base.
@@ -502,12 +484,15 @@ private:
     m_scale(int nn, const std::vector<Cmplx>& pt,
           Real epsilon, Real infin, Real smalno, Real base)
     {
+      using std::sqrt;
+      using std::log;
+      using std::pow;
         int i, l;
         Real hi, lo, max, min, x, sc;
         Real fn_val;
 
         // Find largest and smallest moduli of coefficients
-        hi = std::sqrt(infin);
+        hi = sqrt(infin);
         lo = smalno / epsilon;
         max = 0;
         min = infin;
@@ -534,8 +519,11 @@ private:
             if (infin / sc > max)
                 sc = 1;
         }
-        l = int(std::log(sc) / std::log(base) + 0.5);
-        fn_val = std::pow(base, l);
+        // The exponent is small; go through long double so types with
+        // only explicit conversions work.
+        l = static_cast<int>(static_cast<long double>(log(sc) / log(base))
+                             + 0.5L);
+        fn_val = pow(base, l);
         return fn_val;
     }
 };
@@ -36,6 +36,10 @@
 #include <complex>
 
 #include <emsr/polynomial.h>
+#include <emsr/polynomial_view.h>
+#include <emsr/solver_diagnostics.h>
+#include <emsr/root_clusters.h>
+#include <emsr/newton_polygon.h>
 
 namespace emsr
 {
@@ -52,8 +56,24 @@ namespace emsr
       : m_poly(P), m_num_iters{0}
       { }
 
+      /**
+       * Construct a solver from a view of coefficients in either order.
+       */
+      explicit
+      LaguerreSolver(const PolynomialView<std::complex<Real>>& P)
+      : m_poly(P.polynomial()), m_num_iters{0}
+      { }
+
       std::vector<std::complex<Real>> solve();
 
+      /**
+       * Find all the zeros and group them into clusters of zeros
+       * with multiplicities and inclusion radii.
+       * This does not throw when a zero fails to converge;
+       * the last iterate is used and the cluster radius reflects it.
+       */
+      std::vector<RootCluster<Real>> solve_clusters();
+
       std::complex<Real>
       step()
       {
@@ -90,6 +110,29 @@ namespace emsr
 	return *this;
       }
 
+      /**
+       * Start each zero on the innermost circle of the Newton polygon
+       * of the deflated polynomial rather than at the origin.
+       */
+      LaguerreSolver&
+      newton_polygon_start(bool start)
+      {
+	this->m_polygon_start = start;
+	return *this;
+      }
+
+      /**
+       * Send limit cycle restart and iteration limit events
+       * to a diagnostic sink.
+       * Pass nullptr to discard them, which is the default.
+       */
+      LaguerreSolver&
+      diagnostics(DiagnosticSink* sink)
+      {
+	this->m_diag.sink(sink);
+	return *this;
+      }
+
     private:
 
       // Estimated fractional roundoff error.
@@ -102,18 +145,30 @@ namespace emsr
       s_frac[s_num_fracs + 1]
       {0.0, 0.5, 0.25, 0.75, 0.125, 0.375, 0.625, 0.875, 1.0};
 
+      // Step ratio above which convergence is taken to be linear.
+      static constexpr Real s_linear = Real{0.5};
+
       // Number of steps taken before trying a new fraction.
       int m_steps_per_frac = 10;
 
+      // Start from the Newton polygon instead of the origin.
+      bool m_polygon_start = false;
+
       int
       m_max_iter()
       { return this->m_steps_per_frac * s_num_fracs; }
 
       std::complex<Real> m_root_laguerre();
 
+      std::complex<Real> m_iterate_laguerre(bool& converged);
+
+      std::complex<Real> m_start_point() const;
+
       Polynomial<std::complex<Real>> m_poly;
 
       int m_num_iters = 0;
+
+      DiagnosticReporter m_diag{"LaguerreSolver"};
     };
 
 } // namespace emsr
@@ -46,8 +46,31 @@ namespace emsr
     std::complex<Real>
     LaguerreSolver<Real>::m_root_laguerre()
     {
+      bool converged = false;
+      const auto x = this->m_iterate_laguerre(converged);
+      if (!converged)
+	throw std::runtime_error("m_root_laguerre: Maximum number of iterations exceeded");
+      return x;
+    }
+
+  /**
+   * Run Laguerre's iteration for one zero.  When the steps stop
+   * shrinking faster than linearly the multiplicity of the nearby zero
+   * is estimated and the multiplicity-corrected formula is used.
+   * On reaching the iteration limit converged is false and the last
+   * iterate is returned.
+   */
+  template<typename Real>
+    std::complex<Real>
+    LaguerreSolver<Real>::m_iterate_laguerre(bool& converged)
+    {
+      using std::abs;
+      using std::sqrt;
+      using std::real;
       using cmplx = std::complex<Real>;
 
+      converged = true;
+
       const auto m = this->m_poly.degree();
       const int max_iter = this->m_max_iter();
 
@@ -56,7 +79,9 @@ namespace emsr
       //if (m == 1)
 	//return -this->m_poly.cefficient(0) / this->m_poly.cefficient(1);
 
-      cmplx x{};
+      auto x = this->m_start_point();
+      auto abdx_prev = std::numeric_limits<Real>::infinity();
+      int mult = 1;
       for (int iter = 1; iter <= max_iter; ++iter)
 	{
 	  ++this->m_num_iters;
@@ -64,31 +89,33 @@ namespace emsr
 	  // Efficient computation of the polynomial
 	  // and its first two derivatives. F stores P''(x)/2.
 	  auto b = this->m_poly[m];
-	  auto err = std::abs(b);
-	  const auto abx = std::abs(x);
+	  auto err = abs(b);
+	  const auto abx = abs(x);
 	  cmplx d{}, f{};
 	  for (int j = m - 1; j >= 0; --j)
 	    {
 	      f = x * f + d;
 	      d = x * d + b;
 	      b = x * b + this->m_poly[j];
-	      err = abx * err + std::abs(b);
+	      err = abx * err + abs(b);
 	    }
 	  err *= s_eps;
 	  // Estimate of roundoff error in evaluating polynomial.
-	  if (std::abs(b) <= err) // We have the root.
+	  if (abs(b) <= err) // We have the root.
 	    return x;
 
-	  // Use Laguerre's formula.
+	  // Use Laguerre's formula for a zero of multiplicity mult.
 	  const auto g = d / b;
 	  const auto g2 = g * g;
 	  const auto h = g2 - Real{2} * f / b;
-	  const auto sq = std::sqrt(Real(m - 1)
+	  if (mult > 1 && h != cmplx{})
+	    mult = round_multiplicity(real(g2 / h), m);
+	  const auto sq = sqrt(Real(m - mult) / Real(mult)
 				   * (Real(m) * h - g2));
 	  auto gp = g + sq;
 	  const auto gm = g - sq;
-	  const auto abp = std::abs(gp);
-	  const auto abm = std::abs(gm);
+	  const auto abp = abs(gp);
+	  const auto abm = abs(gm);
 	  if (abp < abm)
 	    gp = gm;
 	  const auto dx = std::max(abp, abm) > Real{0}
@@ -97,13 +124,46 @@ namespace emsr
 	  const auto x1 = x - dx;
 	  if (x == x1)
 	    return x;
+
+	  // Linear convergence signals a multiple zero.
+	  const auto abdx = abs(dx);
+	  if (mult == 1 && abdx > s_linear * abdx_prev && abdx < abdx_prev
+	      && h != cmplx{})
+	    {
+	      // Take the estimate only if it holds at both ends of the step.
+	      const auto est = estimate_multiplicity(this->m_poly, x1);
+	      if (est == round_multiplicity(real(g2 / h), m))
+		mult = est;
+	    }
+	  abdx_prev = abdx;
+
 	  if (iter % this->m_steps_per_frac != 0)
 	    x = x1;
 	  else
-	    x -= s_frac[iter / this->m_steps_per_frac] * dx;
+	    {
+	      const auto frac = s_frac[iter / this->m_steps_per_frac];
+	      x -= frac * dx;
+	      this->m_diag(SolverEvent::restart, iter, frac);
+	    }
 	}
 
-      throw std::runtime_error("m_root_laguerre: Maximum number of iterations exceeded");
+      this->m_diag(SolverEvent::max_iterations, max_iter, abs(x));
+      converged = false;
+      return x;
+    }
+
+  /**
+   * Return the starting point for the next zero: the origin or
+   * the first point on the innermost circle of the Newton polygon.
+   */
+  template<typename Real>
+    std::complex<Real>
+    LaguerreSolver<Real>::m_start_point() const
+    {
+      if (!this->m_polygon_start || this->m_poly.degree() < 1)
+	return std::complex<Real>{};
+      const auto radii = newton_polygon_radii(this->m_poly);
+      return std::polar(radii.front().first, Real{0.7L});
     }
 
   /**
@@ -130,6 +190,32 @@ namespace emsr
       return roots;
     }
 
+  /**
+   * Find all the zeros of the polynomial and group them into clusters.
+   */
+  template<typename Real>
+    std::vector<RootCluster<Real>>
+    LaguerreSolver<Real>::solve_clusters()
+    {
+      using cmplx = std::complex<Real>;
+
+      const auto poly = this->m_poly;
+      std::vector<cmplx> roots;
+      const auto deg = this->m_poly.degree();
+      roots.reserve(deg);
+      for (unsigned i = 0; i < deg; ++i)
+	{
+	  bool converged = false;
+	  const auto z0 = this->m_iterate_laguerre(converged);
+
+	  Polynomial<cmplx> zpoly({-z0, cmplx{1}});
+	  this->m_poly /= zpoly;
+
+	  roots.push_back(z0);
+	}
+      return find_root_clusters(poly, roots);
+    }
+
 } // namespace emsr
 
 #endif // SOLVER_LAGUERRE_TCC
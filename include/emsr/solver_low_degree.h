@@ -40,6 +40,7 @@
 
 #include <array>
 
+#include <emsr/notsospecfun.h>
 #include <emsr/solution.h>
 
 namespace emsr
@@ -142,6 +142,9 @@ namespace emsr
     std::array<Solution<Real>, 2>
     quadratic(const _Iter& _CC)
     {
+      using std::abs;
+      using std::sqrt;
+      using std::copysign;
       std::array<Solution<Real>, 2> _ZZ;
 
       if (_CC[2] == Real{0})
@@ -175,7 +178,7 @@ namespace emsr
 	    {
 	      // The roots are complex conjugates.
 	      const auto _ReZZ = -_CC[1] / (Real{2} * _CC[2]);
-	      const auto _ImZZ = std::sqrt(std::abs(_QQ)) / (Real{2} * _CC[2]);
+	      const auto _ImZZ = sqrt(abs(_QQ)) / (Real{2} * _CC[2]);
 	      _ZZ[0] = std::complex<Real>(_ReZZ, -_ImZZ);
 	      _ZZ[1] = std::complex<Real>(_ReZZ, _ImZZ);
 	    }
@@ -183,7 +186,7 @@ namespace emsr
 	    {
 	      // The roots are real.
 	      Real temp = -(_CC[1]
-			+ std::copysign(std::sqrt(_QQ), _CC[1])) / Real{2};
+			+ copysign(sqrt(_QQ), _CC[1])) / Real{2};
 	      _ZZ[0] = temp / _CC[2];
 	      _ZZ[1] = _CC[0] / temp;
 	    }
@@ -215,6 +218,12 @@ namespace emsr
     std::array<Solution<Real>, 3>
     cubic(const Iter& CC)
     {
+      using std::abs;
+      using std::sqrt;
+      using std::cbrt;
+      using std::cos;
+      using std::acos;
+      using std::copysign;
       std::array<Solution<Real>, 3> ZZ;
 
       if (CC[3] == Real{0})
@@ -241,8 +250,8 @@ namespace emsr
 	  AA3[1] = CC[1] / CC[3];
 	  AA3[0] = CC[0] / CC[3];
 
-	  const auto S_2pi
-	    = 2 * Real{3.1415'92653'58979'32384'62643'38327'95028'84195e+0L};
+	  // A long double literal would limit wider types; compute pi in Real.
+	  const auto S_2pi = Real{2} * acos(-Real{1});
 	  const auto PP = AA3[2] / Real{3};
 	  const auto QQ = (AA3[2] * AA3[2] - Real{3} * AA3[1])
 			 / Real{9};
@@ -255,17 +264,17 @@ namespace emsr
 	  if (QQp3 - RRp2 > Real{0})
 	    {
 	      // Calculate the three real roots.
-	      const auto phi = std::acos(RR / std::sqrt(QQp3));
-	      const auto fact = -Real{2} * std::sqrt(QQ);
+	      const auto phi = acos(RR / sqrt(QQp3));
+	      const auto fact = -Real{2} * sqrt(QQ);
 	      for (int i = 0; i < 3; ++i)
-		ZZ[i] = fact * std::cos((phi + i * S_2pi) / Real{3}) - PP;
+		ZZ[i] = fact * cos((phi + i * S_2pi) / Real{3}) - PP;
 	    }
 	  else
 	    {
 	      // Calculate the single real root.
-	      const auto fact = std::cbrt(std::abs(RR)
-					  + std::sqrt(RRp2 - QQp3));
-	      const auto BB = -std::copysign(fact + QQ / fact, RR);
+	      const auto fact = cbrt(abs(RR)
+					  + sqrt(RRp2 - QQp3));
+	      const auto BB = -copysign(fact + QQ / fact, RR);
 	      ZZ[0] = BB - PP;
 
 	      // Find the other two roots which are complex conjugates.
@@ -306,6 +315,8 @@ namespace emsr
     std::array<Solution<Real>, 4>
     quartic(const Iter& CC)
     {
+      using std::abs;
+      using std::sqrt;
       std::array<Solution<Real>, 4> ZZ;
 
       if (CC[4] == Real{0})
@@ -327,7 +338,7 @@ namespace emsr
 	  // Solve the biquadratic equation.
 	  std::array<Real, 3> AA2{{CC[0], CC[2], CC[4]}};
 	  const auto ZZ2 = quadratic<Real>(AA2);
-	  auto sqrt = [](Solution<Real> z) -> Solution<Real>
+	  auto sqrt_soln = [](Solution<Real> z) -> Solution<Real>
 			{
 			  const auto idx = z.index();
 			  if (idx == 0)
@@ -336,14 +347,14 @@ namespace emsr
 			    {
 			      auto zz = std::get<1>(z);
 			      return zz < Real{0}
-				   ? Solution<Real>(std::sqrt(std::complex<Real>(zz)))
-				   : Solution<Real>(std::sqrt(zz));
+				   ? Solution<Real>(sqrt(std::complex<Real>(zz)))
+				   : Solution<Real>(sqrt(zz));
 			    }
 			  else
-			    return Solution<Real>(std::sqrt(std::get<2>(z)));
+			    return Solution<Real>(sqrt(std::get<2>(z)));
 			};
-	  ZZ[0] = sqrt(ZZ2[0]);
-	  ZZ[1] = sqrt(ZZ2[1]);
+	  ZZ[0] = sqrt_soln(ZZ2[0]);
+	  ZZ[1] = sqrt_soln(ZZ2[1]);
 	  ZZ[2] = -ZZ[0];
 	  ZZ[3] = -ZZ[1];
 	}
@@ -400,15 +411,15 @@ namespace emsr
 	  // Calculate the coefficients for the two quadratic equations
 	  const auto capa = Real{0.5L} * AA4[3];
 	  const auto capb = Real{0.5L} * Z3max;
-	  const auto capc = std::sqrt(capa * capa - AA4[2] + Z3max);
-	  const auto capd = std::sqrt(capb * capb - AA4[0]);
+	  const auto capc = sqrt(capa * capa - AA4[2] + Z3max);
+	  const auto capd = sqrt(capb * capb - AA4[0]);
 	  const auto cp = capa + capc;
 	  const auto cm = capa - capc;
 	  auto dp = capb + capd;
 	  auto dm = capb - capd;
 	  const auto t1 = cp * dm + cm * dp;
 	  const auto t2 = cp * dp + cm * dm;
-	  if (std::abs(t2 - AA4[1]) < std::abs(t1 - AA4[1]))
+	  if (abs(t2 - AA4[1]) < abs(t1 - AA4[1]))
 	    std::swap(dp, dm);
 
 	  // Coefficients for the first quadratic equation and find the roots.
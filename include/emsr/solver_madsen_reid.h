@@ -15,6 +15,10 @@
 #include <vector>
 #include <iostream>
 
+#include <emsr/solver_diagnostics.h>
+#include <emsr/synthetic_division.h>
+#include <emsr/polynomial_view.h>
+
 /**
  * Return the L1 sum of absolute values or Manhattan metric of a complex number.
  */
@@ -45,13 +49,23 @@ template<typename Real>
     /**
      * Constructor.
      *
-     * @param a_in Coefficient of the polynomial in "big-endian" - largest degree coefficient first - order.
+     * @param a_in Coefficient of the polynomial in "little-endian" - lowest degree coefficient first - order.
      */
     SolverMadsenReid(const std::vector<Cmplx>& a_in)
     : poly(a_in),
       poly_work(a_in.size())
     {}
 
+    /**
+     * Constructor from a view of coefficients in either order.
+     * The coefficients are copied once into the deflation array.
+     */
+    explicit
+    SolverMadsenReid(const emsr::PolynomialView<Cmplx>& P)
+    : poly(P.to_vector(emsr::CoefficientOrder::ascending)),
+      poly_work(P.size())
+    {}
+
     /**
      * Solve the polynomial.
      */
@@ -68,6 +82,14 @@ template<typename Real>
         return root;
     }
 
+    /**
+     * Send rescale and restart events to a diagnostic sink.
+     * Pass nullptr to discard them, which is the default.
+     */
+    void
+    diagnostics(emsr::DiagnosticSink* sink)
+    { m_diag.sink(sink); }
+
   private:
 
     static constexpr Real DIGITS = std::numeric_limits<Real>::max_digits10;
@@ -76,12 +98,14 @@ template<typename Real>
     static constexpr Real BASE = std::numeric_limits<Real>::radix;
     static constexpr Real EPS = std::numeric_limits<Real>::epsilon();
 
-    /// Big-endian polynomial.
+    /// Polynomial coefficients, lowest degree first.
     std::vector<Cmplx> poly;
 
-    /// Big-endian working polynomial.
+    /// Working polynomial coefficients, lowest degree first.
     std::vector<Cmplx> poly_work;
 
+    emsr::DiagnosticReporter m_diag{"SolverMadsenReid"};
+
     /**
      * Evaluate polynomial at z, set fz, return squared modulus.
      *
@@ -131,10 +155,7 @@ template<typename Real>
     void
     deflate(std::vector<Cmplx>& a, int n, Cmplx z)
     {
-        for (int k = 1; k < n; ++k)
-        {
-            a[k] = a[k - 1] * z + a[k];
-        }
+        emsr::synthetic_divide_linear(a.begin(), a.begin() + n, z, a.begin());
     }
 
     /**
@@ -82,6 +82,8 @@
             auto u = std::sqrt(u1) * std::sqrt(u2);
             int i = -std::log(u) / ALOGB; // ilogb?
             u = std::pow(BASE, Real(i));
+            if (u != Real{1})
+                m_diag(emsr::SolverEvent::rescale, n, u);
             for (int k = 0; k < n; ++k)
             {
                 a[k] = u * a[k];
@@ -237,6 +239,7 @@
 
             dz = -Real{0.5} * PHASE * dzk;
             stage1 = true;
+            m_diag(emsr::SolverEvent::restart, n, f);
             goto _160;
         }
 
@@ -36,6 +36,8 @@
 #include <complex>
 
 #include <emsr/polynomial.h>
+#include <emsr/polynomial_view.h>
+#include <emsr/solver_diagnostics.h>
 //#include <emsr/solution.h> // For Solution
 
 namespace emsr
@@ -53,14 +55,32 @@ namespace emsr
       : m_poly(P), m_num_iters{0}
       { }
 
+      /**
+       * Construct a solver from a view of coefficients in either order.
+       */
+      explicit
+      QuadraticSolver(const PolynomialView<std::complex<Real>>& P)
+      : m_poly(P.polynomial()), m_num_iters{0}
+      { }
+
       //std::vector<Solution<Real>> solve();
       std::vector<std::complex<Real>> solve();
 
+      /**
+       * Factor out a quadratic and deflate by it.
+       * This does not throw at the iteration limit; the event goes
+       * to the diagnostic sink, the last iterate is used and
+       * the remainder of the division is dropped.
+       */
       Polynomial<std::complex<Real>>
       step()
       {
-	const auto q = this->m_root_quadratic();
-	this->m_poly.deflate(q, Real{10} * s_eps);
+	bool converged = false;
+	const auto q = this->m_root_quadratic(converged);
+	if (converged)
+	  this->m_poly.deflate(q, Real{10} * s_eps);
+	else
+	  this->m_poly /= q;
 	return q;
       }
 
@@ -70,12 +90,24 @@ namespace emsr
 
       int
       max_num_iters() const
-      { return this->m_max_num_iters; }
+      { return this->m_max_iter; }
+
+      void
+      max_num_iters(int max_iter)
+      { this->m_max_iter = max_iter; }
 
       const Polynomial<std::complex<Real>>&
       polynomial() const
       { return this->m_poly; }
 
+      /**
+       * Send iteration limit events to a diagnostic sink.
+       * Pass nullptr to discard them, which is the default.
+       */
+      void
+      diagnostics(DiagnosticSink* sink)
+      { this->m_diag.sink(sink); }
+
     private:
 
       // Estimated fractional roundoff error.
@@ -87,11 +119,13 @@ namespace emsr
 
       int m_max_iter = 50;
 
-      Polynomial<std::complex<Real>> m_root_quadratic();
+      Polynomial<std::complex<Real>> m_root_quadratic(bool& converged);
 
       Polynomial<std::complex<Real>> m_poly;
 
       int m_num_iters = 0;
+
+      DiagnosticReporter m_diag{"QuadraticSolver"};
     };
 
 } // namespace emsr
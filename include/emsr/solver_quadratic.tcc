@@ -33,42 +33,54 @@
 #ifndef SOLVER_QUADRATIC_TCC
 #define SOLVER_QUADRATIC_TCC 1
 
+#include <vector>
+
+#include <emsr/synthetic_division.h>
+
 namespace emsr
 {
 
   /**
    * I think this is trying to factor out a quadratic
    * from a complex-coefficient polynomial.
+   * On reaching the iteration limit a max_iterations diagnostic is
+   * reported, converged is false and the last iterate is returned.
    */
   template<typename Tp>
     Polynomial<std::complex<Tp>>
-    QuadraticSolver<Tp>::m_root_quadratic()
+    QuadraticSolver<Tp>::m_root_quadratic(bool& converged)
     {
+      using std::abs;
       using Cmplx = std::complex<Tp>;
       using Poly = Polynomial<Cmplx>;
 
+      converged = true;
       if (this->m_poly.degree() <= 2)
 	return this->m_poly;
 
       this->m_num_iters = 0;
 
+      // The division kernels take coefficients high order first.
+      const std::vector<Cmplx> p(this->m_poly.crbegin(),
+				 this->m_poly.crend());
+      const auto n = p.size() - 1;
+      std::vector<Cmplx> q(n + 1), qq(n - 1);
+
       Cmplx c, b;
-      Poly q, qq, rem;
       for (int iter = 0; iter < this->m_max_iter; ++iter)
 	{
 	  ++this->m_num_iters;
 
-	  Poly d({c, b, Cmplx{1}});
-
-	  // First division: r, s.
-	  divmod(this->m_poly, d, q, rem);
-	  const auto s = rem[0];
-	  const auto r = rem[1];
+	  // First division by x^2 + bx + c: remainder rx + s.
+	  synthetic_divide_quadratic(p.begin(), p.end(), b, c, q.begin());
+	  const auto r = q[n - 1];
+	  const auto s = q[n] + q[n - 1] * b;
 
 	  // Second division: partial r, s with respect to c.
-	  divmod(q, d, qq, rem);
-	  const auto sc = -rem[0];
-	  const auto rc = -rem[1];
+	  synthetic_divide_quadratic(q.begin(), q.begin() + n - 1,
+				     b, c, qq.begin());
+	  const auto sc = -(qq[n - 2] + qq[n - 3] * b);
+	  const auto rc = -qq[n - 3];
 	  const auto sb = -c * rc;
 	  const auto rb = -b * rc + sc;
 
@@ -78,13 +90,15 @@ namespace emsr
 	  b += delb;
 	  const auto delc = (-r * sb + s * rb) * dv;
 	  c += delc;
-	  if ((std::abs(delb) <= this->m_eps * std::abs(b)
-	      || std::abs(b) < s_tiny)
-           && (std::abs(delc) <= this->m_eps * std::abs(c)
-	      || std::abs(c) < s_tiny))
+	  if ((abs(delb) <= this->m_eps * abs(b)
+	      || abs(b) < s_tiny)
+           && (abs(delc) <= this->m_eps * abs(c)
+	      || abs(c) < s_tiny))
 	    return Poly({c, b, Cmplx{1}});
 	}
-      throw std::runtime_error("m_root_quadratic: Maximum number of iterations exceeded");
+      this->m_diag(SolverEvent::max_iterations, this->m_max_iter, abs(c));
+      converged = false;
+      return Poly({c, b, Cmplx{1}});
     }
 
 } // namespace emsr
@@ -0,0 +1,374 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file sparse_polynomial.h
+ *
+ * This file contains a sparse univariate polynomial class.
+ */
+
+/**
+ * @def  SPARSE_POLYNOMIAL_H
+ *
+ * @brief  A guard for the sparse polynomial header.
+ */
+#ifndef SPARSE_POLYNOMIAL_H
+#define SPARSE_POLYNOMIAL_H 1
+
+#include <vector>
+#include <utility> // For pair.
+#include <initializer_list>
+#include <iosfwd>
+
+#include <emsr/polynomial.h>
+
+namespace emsr
+{
+
+  /**
+   * @brief A sparse polynomial class holding only the nonzero terms:
+   * @f[
+   *    P(x) = a_0 x^{e_0} + a_1 x^{e_1} + ... + a_{m-1} x^{e_{m-1}}
+   * @f]
+   * The exponents and coefficients are kept in separate arrays sorted
+   * by increasing exponent.  There are no zero coefficients and no
+   * repeated exponents; the zero polynomial has no terms.
+   *
+   * Storage and the cost of all operations depend on the number of terms
+   * rather than on the degree.
+   */
+  template<typename Tp>
+    class SparsePolynomial
+    {
+    public:
+      /**
+       * Typedefs.
+       */
+      using value_type = Tp;
+      using size_type = std::size_t;
+      using exponent_type = std::size_t;
+      using real_type = real_type_t<Tp>;
+      using term_type = std::pair<exponent_type, value_type>;
+
+      /**
+       * Create the zero polynomial.
+       */
+      SparsePolynomial() = default;
+
+      /**
+       * Create a monomial.
+       */
+      explicit
+      SparsePolynomial(value_type a, exponent_type expon = 0)
+      {
+	if (a != value_type{})
+	  {
+	    this->m_expon.push_back(expon);
+	    this->m_coeff.push_back(a);
+	  }
+      }
+
+      /**
+       * Create a polynomial from an initializer list of
+       * (exponent, coefficient) terms in any order.
+       * Terms with equal exponents are added.
+       */
+      SparsePolynomial(std::initializer_list<term_type> ila)
+      : SparsePolynomial(ila.begin(), ila.end())
+      { }
+
+      /**
+       * Create a polynomial from an input iterator range of
+       * (exponent, coefficient) terms in any order.
+       * Terms with equal exponents are added.
+       */
+      template<typename InIter,
+	       typename = std::_RequireInputIter<InIter>>
+	SparsePolynomial(InIter tbegin, InIter tend);
+
+      /**
+       * Create a sparse polynomial from the nonzero coefficients
+       * of a dense polynomial.
+       */
+      explicit
+      SparsePolynomial(const Polynomial<value_type>& poly);
+
+      /**
+       * Return the number of nonzero terms.
+       */
+      size_type
+      num_terms() const noexcept
+      { return this->m_coeff.size(); }
+
+      /**
+       * Return true if this is the zero polynomial.
+       */
+      bool
+      empty() const noexcept
+      { return this->m_coeff.empty(); }
+
+      /**
+       * Return the degree or zero for the zero polynomial.
+       */
+      exponent_type
+      degree() const noexcept
+      { return this->empty() ? exponent_type{0} : this->m_expon.back(); }
+
+      /**
+       * Return the exponent of term @c i.
+       */
+      exponent_type
+      exponent(size_type i) const noexcept
+      { return this->m_expon[i]; }
+
+      /**
+       * Return the coefficient of term @c i.
+       */
+      value_type
+      term_coefficient(size_type i) const noexcept
+      { return this->m_coeff[i]; }
+
+      /**
+       * Return the coefficient of x^expon, which may be zero.
+       * This is a binary search.
+       */
+      value_type
+      coefficient(exponent_type expon) const;
+
+      /**
+       * Return the array of exponents.
+       */
+      const std::vector<exponent_type>&
+      exponents() const noexcept
+      { return this->m_expon; }
+
+      /**
+       * Return the array of coefficients.
+       */
+      const std::vector<value_type>&
+      coefficients() const noexcept
+      { return this->m_coeff; }
+
+      /**
+       * Evaluate the polynomial at the input point.
+       * Horner's rule is run over the terms with the powers of x
+       * for the gaps between exponents formed by repeated squaring.
+       */
+      template<typename Up>
+	auto
+	operator()(Up x) const
+	-> decltype(value_type{} * Up{});
+
+      /**
+       * Return the derivative polynomial.
+       */
+      SparsePolynomial
+      derivative() const;
+
+      /**
+       * Return the integral polynomial with given integration constant.
+       */
+      SparsePolynomial
+      integral(value_type c = value_type{}) const;
+
+      /**
+       * Return the dense polynomial.
+       * This allocates degree + 1 coefficients.
+       */
+      Polynomial<value_type>
+      dense() const;
+
+      /**
+       * Unary plus.
+       */
+      SparsePolynomial
+      operator+() const
+      { return *this; }
+
+      /**
+       * Unary minus.
+       */
+      SparsePolynomial
+      operator-() const
+      {
+	auto poly = *this;
+	for (auto& a : poly.m_coeff)
+	  a = -a;
+	return poly;
+      }
+
+      /**
+       * Add a scalar to the polynomial.
+       */
+      SparsePolynomial&
+      operator+=(const value_type& x)
+      { return *this += SparsePolynomial(x); }
+
+      /**
+       * Subtract a scalar from the polynomial.
+       */
+      SparsePolynomial&
+      operator-=(const value_type& x)
+      { return *this -= SparsePolynomial(x); }
+
+      /**
+       * Multiply the polynomial by a scalar.
+       */
+      SparsePolynomial&
+      operator*=(const value_type& c)
+      {
+	if (c == value_type{})
+	  {
+	    this->m_expon.clear();
+	    this->m_coeff.clear();
+	  }
+	else
+	  for (auto& a : this->m_coeff)
+	    a *= c;
+	return *this;
+      }
+
+      /**
+       * Divide the polynomial by a scalar.
+       */
+      SparsePolynomial&
+      operator/=(const value_type& c)
+      {
+	for (auto& a : this->m_coeff)
+	  a /= c;
+	return *this;
+      }
+
+      /**
+       * Add another polynomial to the polynomial by merging the terms.
+       */
+      SparsePolynomial&
+      operator+=(const SparsePolynomial& poly)
+      {
+	*this = m_merge(*this, poly, value_type{1});
+	return *this;
+      }
+
+      /**
+       * Subtract another polynomial from the polynomial
+       * by merging the terms.
+       */
+      SparsePolynomial&
+      operator-=(const SparsePolynomial& poly)
+      {
+	*this = m_merge(*this, poly, value_type{-1});
+	return *this;
+      }
+
+      /**
+       * Multiply the polynomial by another polynomial.
+       *
+       * Johnson's heap method is used: the products of each term of the
+       * shorter factor with the terms of the longer one are streams of
+       * increasing exponent which are merged through a heap with one
+       * entry per stream.  The terms of the product come out in order so
+       * no sorting or dense accumulator is needed.  With m <= n terms
+       * this takes O(mn log m) time and O(m) extra space.
+       */
+      SparsePolynomial&
+      operator*=(const SparsePolynomial& poly);
+
+      /**
+       * Remove the terms with coefficients smaller in magnitude
+       * than max_abs_coef.
+       */
+      SparsePolynomial&
+      deflate(real_type max_abs_coef);
+
+      friend bool
+      operator==(const SparsePolynomial& pa, const SparsePolynomial& pb)
+      { return pa.m_expon == pb.m_expon && pa.m_coeff == pb.m_coeff; }
+
+      friend bool
+      operator!=(const SparsePolynomial& pa, const SparsePolynomial& pb)
+      { return !(pa == pb); }
+
+    private:
+
+      static SparsePolynomial
+      m_merge(const SparsePolynomial& pa, const SparsePolynomial& pb,
+	      value_type sign);
+
+      std::vector<exponent_type> m_expon;
+      std::vector<value_type> m_coeff;
+    };
+
+  /**
+   * Return the sum of two sparse polynomials.
+   */
+  template<typename Tp>
+    inline SparsePolynomial<Tp>
+    operator+(const SparsePolynomial<Tp>& pa, const SparsePolynomial<Tp>& pb)
+    { return SparsePolynomial<Tp>(pa) += pb; }
+
+  /**
+   * Return the difference of two sparse polynomials.
+   */
+  template<typename Tp>
+    inline SparsePolynomial<Tp>
+    operator-(const SparsePolynomial<Tp>& pa, const SparsePolynomial<Tp>& pb)
+    { return SparsePolynomial<Tp>(pa) -= pb; }
+
+  /**
+   * Return the product of two sparse polynomials.
+   */
+  template<typename Tp>
+    inline SparsePolynomial<Tp>
+    operator*(const SparsePolynomial<Tp>& pa, const SparsePolynomial<Tp>& pb)
+    { return SparsePolynomial<Tp>(pa) *= pb; }
+
+  /**
+   * Return the product of a sparse polynomial with a scalar.
+   */
+  template<typename Tp>
+    inline SparsePolynomial<Tp>
+    operator*(const SparsePolynomial<Tp>& poly, const Tp& x)
+    { return SparsePolynomial<Tp>(poly) *= x; }
+
+  /**
+   * Return the product of a scalar with a sparse polynomial.
+   */
+  template<typename Tp>
+    inline SparsePolynomial<Tp>
+    operator*(const Tp& x, const SparsePolynomial<Tp>& poly)
+    { return SparsePolynomial<Tp>(poly) *= x; }
+
+  /**
+   * Write a sparse polynomial to a stream.
+   * The format is a parenthesized comma-delimited list of
+   * (exponent,coefficient) terms.
+   */
+  template<typename CharT, typename Traits, typename Tp>
+    std::basic_ostream<CharT, Traits>&
+    operator<<(std::basic_ostream<CharT, Traits>& os,
+	       const SparsePolynomial<Tp>& poly);
+
+} // namespace emsr
+
+#include <emsr/sparse_polynomial.tcc>
+
+#endif // SPARSE_POLYNOMIAL_H
@@ -0,0 +1,355 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file sparse_polynomial.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * sparse polynomial class.
+ *
+ * @see sparse_polynomial.h
+ */
+
+/**
+ * @def  SPARSE_POLYNOMIAL_TCC
+ *
+ * @brief  A guard for the sparse polynomial implementation header.
+ */
+#ifndef SPARSE_POLYNOMIAL_TCC
+#define SPARSE_POLYNOMIAL_TCC 1
+
+#include <algorithm>
+#include <limits>
+#include <ostream>
+
+namespace emsr
+{
+
+  /**
+   * Create a polynomial from a range of terms in any order.
+   */
+  template<typename Tp>
+    template<typename InIter, typename>
+      SparsePolynomial<Tp>::SparsePolynomial(InIter tbegin, InIter tend)
+      {
+	std::vector<term_type> terms(tbegin, tend);
+	std::stable_sort(terms.begin(), terms.end(),
+			 [](const term_type& x, const term_type& y)
+			 { return x.first < y.first; });
+	this->m_expon.reserve(terms.size());
+	this->m_coeff.reserve(terms.size());
+	for (std::size_t k = 0; k < terms.size();)
+	  {
+	    const auto expon = terms[k].first;
+	    auto a = terms[k].second;
+	    for (++k; k < terms.size() && terms[k].first == expon; ++k)
+	      a += terms[k].second;
+	    if (a != value_type{})
+	      {
+		this->m_expon.push_back(expon);
+		this->m_coeff.push_back(a);
+	      }
+	  }
+      }
+
+  /**
+   * Create a sparse polynomial from a dense polynomial.
+   */
+  template<typename Tp>
+    SparsePolynomial<Tp>::SparsePolynomial(const Polynomial<value_type>& poly)
+    {
+      for (std::size_t i = 0; i <= poly.degree(); ++i)
+	if (poly[i] != value_type{})
+	  {
+	    this->m_expon.push_back(i);
+	    this->m_coeff.push_back(poly[i]);
+	  }
+    }
+
+  /**
+   * Return the coefficient of x^expon.
+   */
+  template<typename Tp>
+    typename SparsePolynomial<Tp>::value_type
+    SparsePolynomial<Tp>::coefficient(exponent_type expon) const
+    {
+      const auto it = std::lower_bound(this->m_expon.begin(),
+				       this->m_expon.end(), expon);
+      if (it == this->m_expon.end() || *it != expon)
+	return value_type{};
+      return this->m_coeff[it - this->m_expon.begin()];
+    }
+
+  /**
+   * Evaluate the polynomial at the input point.
+   */
+  template<typename Tp>
+    template<typename Up>
+      auto
+      SparsePolynomial<Tp>::operator()(Up x) const
+      -> decltype(value_type{} * Up{})
+      {
+	using ret_t = decltype(value_type{} * Up{});
+	const auto power = [](Up y, exponent_type n)
+	  {
+	    auto p = Up{1};
+	    while (n != 0)
+	      {
+		if (n & 1)
+		  p *= y;
+		n >>= 1;
+		if (n != 0)
+		  y *= y;
+	      }
+	    return p;
+	  };
+
+	const auto m = this->num_terms();
+	if (m == 0)
+	  return ret_t{};
+	auto poly = ret_t(Up{1} * this->m_coeff[m - 1]);
+	for (std::size_t k = m - 1; k > 0; --k)
+	  poly = poly * power(x, this->m_expon[k] - this->m_expon[k - 1])
+	       + this->m_coeff[k - 1];
+	return poly * power(x, this->m_expon[0]);
+      }
+
+  /**
+   * Return the derivative polynomial.
+   */
+  template<typename Tp>
+    SparsePolynomial<Tp>
+    SparsePolynomial<Tp>::derivative() const
+    {
+      SparsePolynomial res;
+      res.m_expon.reserve(this->num_terms());
+      res.m_coeff.reserve(this->num_terms());
+      for (std::size_t k = 0; k < this->num_terms(); ++k)
+	if (this->m_expon[k] > 0)
+	  {
+	    res.m_expon.push_back(this->m_expon[k] - 1);
+	    res.m_coeff.push_back(real_type(this->m_expon[k])
+				  * this->m_coeff[k]);
+	  }
+      return res;
+    }
+
+  /**
+   * Return the integral polynomial with given integration constant.
+   */
+  template<typename Tp>
+    SparsePolynomial<Tp>
+    SparsePolynomial<Tp>::integral(value_type c) const
+    {
+      SparsePolynomial res(c);
+      res.m_expon.reserve(this->num_terms() + 1);
+      res.m_coeff.reserve(this->num_terms() + 1);
+      for (std::size_t k = 0; k < this->num_terms(); ++k)
+	{
+	  res.m_expon.push_back(this->m_expon[k] + 1);
+	  res.m_coeff.push_back(this->m_coeff[k]
+				/ real_type(this->m_expon[k] + 1));
+	}
+      return res;
+    }
+
+  /**
+   * Return the dense polynomial.
+   */
+  template<typename Tp>
+    Polynomial<typename SparsePolynomial<Tp>::value_type>
+    SparsePolynomial<Tp>::dense() const
+    {
+      Polynomial<value_type> poly(value_type{}, this->degree());
+      for (std::size_t k = 0; k < this->num_terms(); ++k)
+	poly[this->m_expon[k]] = this->m_coeff[k];
+      return poly;
+    }
+
+  /**
+   * Return the sum pa + sign pb by a linear merge of the terms.
+   */
+  template<typename Tp>
+    SparsePolynomial<Tp>
+    SparsePolynomial<Tp>::m_merge(const SparsePolynomial& pa,
+				  const SparsePolynomial& pb,
+				  value_type sign)
+    {
+      SparsePolynomial res;
+      const auto na = pa.num_terms();
+      const auto nb = pb.num_terms();
+      res.m_expon.reserve(na + nb);
+      res.m_coeff.reserve(na + nb);
+      std::size_t i = 0, j = 0;
+      while (i < na || j < nb)
+	{
+	  exponent_type expon;
+	  value_type a;
+	  if (j == nb || (i < na && pa.m_expon[i] < pb.m_expon[j]))
+	    {
+	      expon = pa.m_expon[i];
+	      a = pa.m_coeff[i++];
+	    }
+	  else if (i == na || pb.m_expon[j] < pa.m_expon[i])
+	    {
+	      expon = pb.m_expon[j];
+	      a = sign * pb.m_coeff[j++];
+	    }
+	  else
+	    {
+	      expon = pa.m_expon[i];
+	      a = pa.m_coeff[i++] + sign * pb.m_coeff[j++];
+	    }
+	  if (a != value_type{})
+	    {
+	      res.m_expon.push_back(expon);
+	      res.m_coeff.push_back(a);
+	    }
+	}
+      return res;
+    }
+
+  /**
+   * Multiply the polynomial by another polynomial by Johnson's method.
+   */
+  template<typename Tp>
+    SparsePolynomial<Tp>&
+    SparsePolynomial<Tp>::operator*=(const SparsePolynomial& poly)
+    {
+      // The entry for the stream of products of term i of the shorter
+      // factor with the terms of the longer one; j is the next term.
+      struct HeapEntry
+      {
+	exponent_type expon;
+	std::size_t i;
+	std::size_t j;
+      };
+      const auto later = [](const HeapEntry& x, const HeapEntry& y)
+			 { return x.expon > y.expon; };
+
+      const bool swap = this->num_terms() > poly.num_terms();
+      const auto& pa = swap ? poly : *this;
+      const auto& pb = swap ? *this : poly;
+      const auto na = pa.num_terms();
+      const auto nb = pb.num_terms();
+
+      SparsePolynomial res;
+      if (na == 0)
+	{
+	  *this = res;
+	  return *this;
+	}
+
+      std::vector<HeapEntry> heap;
+      heap.reserve(na);
+      heap.push_back({pa.m_expon[0] + pb.m_expon[0], 0, 0});
+      auto expon = heap.front().expon;
+      auto sum = value_type{};
+      while (!heap.empty())
+	{
+	  std::pop_heap(heap.begin(), heap.end(), later);
+	  const auto top = heap.back();
+	  heap.pop_back();
+
+	  if (top.expon != expon)
+	    {
+	      if (sum != value_type{})
+		{
+		  res.m_expon.push_back(expon);
+		  res.m_coeff.push_back(sum);
+		}
+	      expon = top.expon;
+	      sum = value_type{};
+	    }
+	  sum += pa.m_coeff[top.i] * pb.m_coeff[top.j];
+
+	  // Advance this stream and start the next one when the first
+	  // product of this stream is consumed.
+	  if (top.j + 1 < nb)
+	    {
+	      heap.push_back({pa.m_expon[top.i] + pb.m_expon[top.j + 1],
+			      top.i, top.j + 1});
+	      std::push_heap(heap.begin(), heap.end(), later);
+	    }
+	  if (top.j == 0 && top.i + 1 < na)
+	    {
+	      heap.push_back({pa.m_expon[top.i + 1] + pb.m_expon[0],
+			      top.i + 1, 0});
+	      std::push_heap(heap.begin(), heap.end(), later);
+	    }
+	}
+      if (sum != value_type{})
+	{
+	  res.m_expon.push_back(expon);
+	  res.m_coeff.push_back(sum);
+	}
+
+      *this = std::move(res);
+      return *this;
+    }
+
+  /**
+   * Remove the small terms.
+   */
+  template<typename Tp>
+    SparsePolynomial<Tp>&
+    SparsePolynomial<Tp>::deflate(real_type max_abs_coef)
+    {
+      using std::abs;
+      std::size_t m = 0;
+      for (std::size_t k = 0; k < this->num_terms(); ++k)
+	if (!(abs(this->m_coeff[k]) < max_abs_coef))
+	  {
+	    this->m_expon[m] = this->m_expon[k];
+	    this->m_coeff[m] = this->m_coeff[k];
+	    ++m;
+	  }
+      this->m_expon.resize(m);
+      this->m_coeff.resize(m);
+      return *this;
+    }
+
+  /**
+   * Write a sparse polynomial to a stream.
+   */
+  template<typename CharT, typename Traits, typename Tp>
+    std::basic_ostream<CharT, Traits>&
+    operator<<(std::basic_ostream<CharT, Traits>& os,
+	       const SparsePolynomial<Tp>& poly)
+    {
+      int old_prec = os.precision(std::numeric_limits<Tp>::max_digits10);
+      os << "(";
+      for (std::size_t k = 0; k < poly.num_terms(); ++k)
+	{
+	  if (k > 0)
+	    os << ",";
+	  os << "(" << poly.exponent(k) << "," << poly.term_coefficient(k)
+	     << ")";
+	}
+      os << ")";
+      os.precision(old_prec);
+      return os;
+    }
+
+} // namespace emsr
+
+#endif // SPARSE_POLYNOMIAL_TCC
@@ -33,8 +33,12 @@
 #ifndef STATIC_POLYNOMIAL_H
 #define STATIC_POLYNOMIAL_H 1
 
+#include <initializer_list>
 #include <limits>
 #include <array>
+#include <algorithm> // For max.
+#include <iterator>
+#include <stdexcept>
 #include <complex>
 #include <iosfwd>
 
@@ -44,6 +48,10 @@ namespace emsr
   /**
    * This is a constant size polynomial.
    * It is really meant to just evaluate canned polynomial literals.
+   *
+   * All real-valued operations are usable in constant expressions
+   * so that approximations, their derivatives, integrals and compositions
+   * can be computed entirely at compile time.
    */
   template<typename Tp, std::size_t Size>
     class StaticPolynomial
@@ -84,7 +92,7 @@ namespace emsr
 	: m_coeff{}
 	{
           for (auto i = 0ULL; i < Size; ++i)
-	    this->m_coeff[i] = static_cast<value_type>(poly.m_coeff[i]);
+	    this->m_coeff[i] = static_cast<value_type>(poly[i]);
 	}
 
       /**
@@ -101,15 +109,15 @@ namespace emsr
 
       /**
        *  Constructor from initializer_list array.
+       *  Coefficients beyond the size of the polynomial are ignored.
        */
       constexpr
       StaticPolynomial(std::initializer_list<Tp> il)
       : m_coeff{}
       {
-	//static_assert(il.size() == Size, "");
 	std::size_t i = 0;
-	for (auto&& coeff : il)
-	  this->m_coeff[i++] = coeff;
+	for (auto it = il.begin(); it != il.end() && i < Size; ++it)
+	  this->m_coeff[i++] = *it;
       }
 
       /**
@@ -117,21 +125,27 @@ namespace emsr
        */
       constexpr explicit
       StaticPolynomial(value_type a, size_type degree = 0)
-      : m_coeff(degree + 1)
+      : m_coeff{}
       {
-        static_assert(degree < Size, "StaticPolynomial: degree out of range");
-        this->m_coeff[degree] = a;
+	if (degree >= Size)
+	  throw std::domain_error("StaticPolynomial: degree out of range");
+	this->m_coeff[degree] = a;
       }
 
       /**
        *  Create a polynomial from an input iterator range of coefficients.
+       *  Coefficients beyond the size of the polynomial are ignored.
        */
       template<typename InIter,
 	       typename = std::_RequireInputIter<InIter>>
 	constexpr
 	StaticPolynomial(const InIter& abegin, const InIter& aend)
-	: m_coeff(abegin, aend)
-	{ }
+	: m_coeff{}
+	{
+	  std::size_t i = 0;
+	  for (auto it = abegin; it != aend && i < Size; ++it)
+	    this->m_coeff[i++] = *it;
+	}
 
       /**
        *  Swap the polynomial with another polynomial.
@@ -146,15 +160,10 @@ namespace emsr
       constexpr value_type
       operator()(value_type x) const
       {
-	if (this->degree() > 0)
-	  {
-	    value_type poly(this->coefficient(this->degree()));
-	    for (int i = this->degree() - 1; i >= 0; --i)
-	      poly = poly * x + this->coefficient(i);
-	    return poly;
-	  }
-	else
-	  return value_type{};
+	value_type poly(this->m_coeff[this->degree()]);
+	for (int i = int(this->degree()) - 1; i >= 0; --i)
+	  poly = poly * x + this->m_coeff[i];
+	return poly;
       }
 
       /**
@@ -165,15 +174,10 @@ namespace emsr
 	operator()(Tp2 x) const
 	-> decltype(value_type{} * Tp2())
 	{
-	  if (this->degree() > 0)
-	    {
-	      auto poly(this->coefficient(this->degree()) * Tp2(1));
-	      for (int i = this->degree() - 1; i >= 0; --i)
-		poly = poly * x + this->coefficient(i);
-	      return poly;
-	    }
-	  else
-	    return value_type{};
+	  auto poly(this->m_coeff[this->degree()] * Tp2(1));
+	  for (int i = int(this->degree()) - 1; i >= 0; --i)
+	    poly = poly * x + this->m_coeff[i];
+	  return poly;
 	}
 
       /**
@@ -192,18 +196,22 @@ namespace emsr
 	operator()(std::complex<Tp2> z) const
 	-> decltype(value_type{} * std::complex<Tp2>{})
 	{
-	  const auto r = Tp{2} * std::real(z);
-	  const auto s = std::norm(z);
-	  auto aa = this->coefficient(this->degree());
-	  auto bb = this->coefficient(this->degree() - 1);
-	  for (int j = 1; j <= this->degree(); ++j)
+	  using cmplx_t = decltype(value_type{} * std::complex<Tp2>{});
+	  const auto n = this->degree();
+	  if (n == 0)
+	    return cmplx_t(this->m_coeff[0]);
+	  const auto r = Tp{2} * z.real();
+	  const auto s = z.real() * z.real() + z.imag() * z.imag();
+	  auto aa = this->m_coeff[n];
+	  auto bb = this->m_coeff[n - 1];
+	  for (size_type j = 2; j <= n; ++j)
 	    {
-	      auto cc  = s * aa;
+	      const auto cc = s * aa;
 	      aa = bb + r * aa;
-	      bb = this->coefficient(this->degree() - j) - cc;
+	      bb = this->m_coeff[n - j] - cc;
 	    }
-	  return aa * z + bb;
-	};
+	  return cmplx_t(aa) * z + cmplx_t(bb);
+	}
 
       /**
        *  Evaluate the polynomial at a range of input points.
@@ -222,26 +230,30 @@ namespace emsr
 	  return pbegin;
 	}
 
-      //  Could/should this be done by output iterator range?
+      /**
+       *  Evaluate the polynomial and its derivatives at the point x.
+       *  The values are placed in the output array starting with the
+       *  polynomial value and continuing through higher derivatives.
+       */
       template<size_type N>
 	constexpr void
-	eval(value_type x, std::array<value_type, N>& arr)
+	eval(value_type x, std::array<value_type, N>& arr) const
 	{
-	  if (arr.size() > 0)
+	  if (N > 0)
 	    {
-	      arr.fill(value_type{});
-	      const size_type sz = m_coeff.size();
-	      arr[0] = this->coefficient(sz - 1);
-              for (int i = sz - 2; i >= 0; --i)
+	      for (size_type j = 0; j < N; ++j)
+		arr[j] = value_type{};
+	      arr[0] = this->m_coeff[Size - 1];
+	      for (int i = int(Size) - 2; i >= 0; --i)
 		{
-		  int nn = std::min(arr.size() - 1, sz - 1 - i);
+		  const int nn = std::min(int(N) - 1, int(Size) - 1 - i);
 		  for (int j = nn; j >= 1; --j)
 		    arr[j] = arr[j] * x + arr[j - 1];
-		  arr[0] = arr[0] * x + this->coefficient(i);
+		  arr[0] = arr[0] * x + this->m_coeff[i];
 		}
 	      //  Now put in the factorials.
 	      value_type fact = value_type(1);
-	      for (size_t i = 2; i < arr.size(); ++i)
+	      for (size_type i = 2; i < N; ++i)
 		{
 		  fact *= value_type(i);
 		  arr[i] *= fact;
@@ -256,14 +268,14 @@ namespace emsr
        */
       template<typename OutIter>
 	constexpr void
-	eval(value_type x, OutIter b, OutIter e)
+	eval(value_type x, OutIter b, OutIter e) const
 	{
 	  if(b != e)
 	    {
-	      std::fill(b, e, value_type{});
-	      constexpr size_type sz = m_coeff.size();
-	      *b = m_coeff[sz - 1];
-              for (int i = sz - 2; i >= 0; --i)
+	      for (auto it = b; it != e; ++it)
+		*it = value_type{};
+	      *b = m_coeff[Size - 1];
+              for (int i = int(Size) - 2; i >= 0; --i)
 		{
 		  for (auto it = std::reverse_iterator<OutIter>(e);
 			   it != std::reverse_iterator<OutIter>(b) - 1; ++it)
@@ -290,14 +302,15 @@ namespace emsr
       {
 	if (this->degree() > 0)
 	  {
-	    auto odd = this->degree() % 2;
-	    value_type poly(this->coefficient(this->degree() - odd));
-	    for (int i = this->degree() - odd - 2; i >= 0; i -= 2)
-	      poly = poly * x * x + this->coefficient(i);
+	    const auto odd = this->degree() % 2;
+	    const auto xx = x * x;
+	    value_type poly(this->m_coeff[this->degree() - odd]);
+	    for (int i = int(this->degree() - odd) - 2; i >= 0; i -= 2)
+	      poly = poly * xx + this->m_coeff[i];
 	    return poly;
 	  }
 	else
-	  return value_type{};
+	  return this->m_coeff[0];
       }
 
       /**
@@ -308,10 +321,11 @@ namespace emsr
       {
 	if (this->degree() > 0)
 	  {
-	    auto even = (this->degree() % 2 == 0 ? 1 : 0);
-	    value_type poly(this->coefficient(this->degree() - even));
-	    for (int i = this->degree() - even - 2; i >= 0; i -= 2)
-	      poly = poly * x * x + this->coefficient(i);
+	    const auto even = (this->degree() % 2 == 0 ? 1 : 0);
+	    const auto xx = x * x;
+	    value_type poly(this->m_coeff[this->degree() - even]);
+	    for (int i = int(this->degree() - even) - 2; i >= 0; i -= 2)
+	      poly = poly * xx + this->m_coeff[i];
 	    return poly * x;
 	  }
 	else
@@ -335,22 +349,26 @@ namespace emsr
 	eval_even(std::complex<Tp2> z) const
 	-> decltype(value_type{} * std::complex<Tp2>{})
 	{
-	  if (this->degree() > 0)
+	  using cmplx_t = decltype(value_type{} * std::complex<Tp2>{});
+	  const auto odd = this->degree() % 2;
+	  const size_type n = this->degree() - odd;
+	  if (n == 0)
+	    return cmplx_t(this->m_coeff[0]);
+	  else
 	    {
 	      const auto zz = z * z;
-	      const auto r = Tp{2} * std::real(zz);
-	      const auto s = std::norm(zz);
-	      auto odd = this->degree() % 2;
-	      size_type n = this->degree() - odd;
-	      auto aa = this->coefficient(n);
-	      auto bb = this->coefficient(n - 2);
+	      const auto r = Tp{2} * zz.real();
+	      const auto s = zz.real() * zz.real() + zz.imag() * zz.imag();
+	      auto aa = this->m_coeff[n];
+	      auto bb = this->m_coeff[n - 2];
 	      for (size_type j = 4; j <= n; j += 2)
-		bb = this->coefficient(n - j)
-		     - s * std::exchange(aa, bb + r * aa);
-	      return aa * zz + bb;
+		{
+		  const auto cc = s * aa;
+		  aa = bb + r * aa;
+		  bb = this->m_coeff[n - j] - cc;
+		}
+	      return cmplx_t(aa) * zz + cmplx_t(bb);
 	    }
-	  else
-	    return decltype(value_type{} * std::complex<Tp2>{}){};
 	};
 
       /**
@@ -370,22 +388,28 @@ namespace emsr
 	eval_odd(std::complex<Tp2> z) const
 	-> decltype(value_type{} * std::complex<Tp2>{})
 	{
-	  if (this->degree() > 0)
+	  using cmplx_t = decltype(value_type{} * std::complex<Tp2>{});
+	  if (this->degree() == 0)
+	    return cmplx_t{};
+	  const auto even = (this->degree() % 2 == 0 ? 1 : 0);
+	  const size_type n = this->degree() - even;
+	  if (n == 1)
+	    return z * cmplx_t(this->m_coeff[1]);
+	  else
 	    {
 	      const auto zz = z * z;
-	      const auto r = Tp{2} * std::real(zz);
-	      const auto s = std::norm(zz);
-	      auto even = (this->degree() % 2 == 0 ? 1 : 0);
-	      size_type n = this->degree() - even;
-	      auto aa = this->coefficient(n);
-	      auto bb = this->coefficient(n - 2);
+	      const auto r = Tp{2} * zz.real();
+	      const auto s = zz.real() * zz.real() + zz.imag() * zz.imag();
+	      auto aa = this->m_coeff[n];
+	      auto bb = this->m_coeff[n - 2];
 	      for (size_type j = 4; j <= n; j += 2)
-		bb = this->coefficient(n - j)
-		     - s * std::exchange(aa, bb + r * aa);
-	      return z * (aa * zz + bb);
+		{
+		  const auto cc = s * aa;
+		  aa = bb + r * aa;
+		  bb = this->m_coeff[n - j] - cc;
+		}
+	      return z * (cmplx_t(aa) * zz + cmplx_t(bb));
 	    }
-	  else
-	    return decltype(value_type{} * std::complex<Tp2>{}){};
 	};
 
       /**
@@ -396,7 +420,7 @@ namespace emsr
       {
 	StaticPolynomial<Tp, (Size > 1 ? Size - 1 : 1)> res;
 	for (size_type i = 1; i <= this->degree(); ++i)
-	  res.coefficient(i - 1, i * m_coeff[i]);
+	  res[i - 1] = value_type(i) * m_coeff[i];
 	return res;
       }
 
@@ -407,12 +431,22 @@ namespace emsr
       integral(value_type c = value_type{}) const
       {
 	StaticPolynomial<Tp, Size + 1> res;
-	res.coefficient(0, c);
+	res[0] = c;
 	for (size_type i = 0; i <= this->degree(); ++i)
-	  res.coefficient(i + 1, m_coeff[i] / value_type(i + 1));
+	  res[i + 1] = m_coeff[i] / value_type(i + 1);
 	return res;
       }
 
+      /**
+       *  Return the integral of the polynomial with given integration limits.
+       */
+      constexpr value_type
+      integral(value_type a, value_type b) const
+      {
+	const auto P = this->integral();
+	return P(b) - P(a);
+      }
+
       /**
        * Unary plus.
        */
@@ -434,34 +468,33 @@ namespace emsr
       operator=(const StaticPolynomial&) = default;
 
       template<typename Up>
-	StaticPolynomial&
+	constexpr StaticPolynomial&
 	operator=(const StaticPolynomial<Up, Size>& poly)
 	{
-	  if (&poly != this)
-	    {
-	      this->m_coeff.clear();
-	      for (const auto c : poly)
-		this->m_coeff = static_cast<value_type>(c);
-	      return *this;
-	    }
+	  for (size_type i = 0; i < Size; ++i)
+	    this->m_coeff[i] = static_cast<value_type>(poly[i]);
+	  return *this;
 	}
 
       /**
        *  Assign from an initialiser list.
+       *  Coefficients not in the list are set to zero.
        */
       constexpr StaticPolynomial&
       operator=(std::initializer_list<value_type> ila)
       {
-	for (size_type i = 0;
-	     i <= std::min(this->degree(), ila.size()); ++i)
-	  this->m_coeff[i] = ila[i];
+	size_type i = 0;
+	for (auto it = ila.begin(); it != ila.end() && i < Size; ++it)
+	  this->m_coeff[i++] = *it;
+	for (; i < Size; ++i)
+	  this->m_coeff[i] = value_type{};
 	return *this;
       }
 
       /**
        * Add a scalar to the polynomial.
        */
-      StaticPolynomial&
+      constexpr StaticPolynomial&
       operator+=(const value_type& x)
       {
 	this->m_coeff[0] += static_cast<value_type>(x);
@@ -471,7 +504,7 @@ namespace emsr
       /**
        * Subtract a scalar from the polynomial.
        */
-      StaticPolynomial&
+      constexpr StaticPolynomial&
       operator-=(const value_type& x)
       {
 	this->m_coeff[0] -= static_cast<value_type>(x);
@@ -481,7 +514,7 @@ namespace emsr
       /**
        * Multiply the polynomial by a scalar.
        */
-      StaticPolynomial&
+      constexpr StaticPolynomial&
       operator*=(const value_type& c)
       {
 	for (size_type i = 0; i < this->m_coeff.size(); ++i)
@@ -492,7 +525,7 @@ namespace emsr
       /**
        * Divide the polynomial by a scalar.
        */
-      StaticPolynomial&
+      constexpr StaticPolynomial&
       operator/=(const value_type& c)
       {
 	for (size_type i = 0; i < this->m_coeff.size(); ++i)
@@ -531,7 +564,7 @@ namespace emsr
       /**
        * Return coefficient @c i as an assignable quantity.
        */
-      reference
+      constexpr reference
       operator[](size_type i)
       { return this->m_coeff[i]; }
 
@@ -563,59 +596,54 @@ namespace emsr
       data() noexcept
       { return this->m_coeff.data(); }
 
-      iterator
+      constexpr iterator
       begin()
       { return this->m_coeff.begin(); }
 
-      iterator
+      constexpr iterator
       end()
       { return this->m_coeff.end(); }
 
-      const_iterator
+      constexpr const_iterator
       begin() const
       { return this->m_coeff.begin(); }
 
-      const_iterator
+      constexpr const_iterator
       end() const
       { return this->m_coeff.end(); }
 
-      const_iterator
+      constexpr const_iterator
       cbegin() const
       { return this->m_coeff.cbegin(); }
 
-      const_iterator
+      constexpr const_iterator
       cend() const
       { return this->m_coeff.cend(); }
 
-      reverse_iterator
+      constexpr reverse_iterator
       rbegin()
       { return this->m_coeff.rbegin(); }
 
-      reverse_iterator
+      constexpr reverse_iterator
       rend()
       { return this->m_coeff.rend(); }
 
-      const_reverse_iterator
+      constexpr const_reverse_iterator
       rbegin() const
       { return this->m_coeff.rbegin(); }
 
-      const_reverse_iterator
+      constexpr const_reverse_iterator
       rend() const
       { return this->m_coeff.rend(); }
 
-      const_reverse_iterator
+      constexpr const_reverse_iterator
       crbegin() const
       { return this->m_coeff.crbegin(); }
 
-      const_reverse_iterator
+      constexpr const_reverse_iterator
       crend() const
       { return this->m_coeff.crend(); }
 
-      template<typename Tp1>
-	friend bool
-	operator==(const StaticPolynomial<Tp1, Size>& pa,
-		   const StaticPolynomial<Tp1, Size>& pb);
-
     private:
 
       std::array<value_type, Size> m_coeff;
@@ -634,15 +662,20 @@ namespace emsr
     inline constexpr bool
     operator==(const StaticPolynomial<Tp, Size>& pa,
 	       const StaticPolynomial<Tp, Size>& pb)
-    { return pa.m_coeff == pb.m_coeff; }
+    {
+      for (std::size_t i = 0; i < Size; ++i)
+	if (pa[i] != pb[i])
+	  return false;
+      return true;
+    }
 
   /**
    *  Return false if two polynomials are equal.
    */
   template<typename Tp, std::size_t SizeA, std::size_t SizeB>
     inline constexpr bool
-    operator!=(const StaticPolynomial<Tp, SizeA>& pa,
-	       const StaticPolynomial<Tp, SizeB>& pb)
+    operator!=(const StaticPolynomial<Tp, SizeA>&,
+	       const StaticPolynomial<Tp, SizeB>&)
     { return true; }
 
   /**
@@ -663,7 +696,7 @@ namespace emsr
     { return StaticPolynomial<Tp, Size>(poly) += x; }
 
   template<typename Tp, std::size_t Size>
-    inline StaticPolynomial<Tp, Size>
+    inline constexpr StaticPolynomial<Tp, Size>
     operator+(const Tp& x, const StaticPolynomial<Tp, Size>& poly)
     { return StaticPolynomial<Tp, Size>(poly) += x; }
 
@@ -676,7 +709,7 @@ namespace emsr
     { return StaticPolynomial<Tp, Size>(poly) -= x; }
 
   template<typename Tp, std::size_t Size>
-    inline StaticPolynomial<Tp, Size>
+    inline constexpr StaticPolynomial<Tp, Size>
     operator-(const Tp& x, const StaticPolynomial<Tp, Size>& poly)
     { return -StaticPolynomial<Tp, Size>(poly) += x; }
 
@@ -689,7 +722,7 @@ namespace emsr
     { return StaticPolynomial<Tp, Size>(poly) *= x; }
 
   template<typename Tp, std::size_t Size>
-    inline StaticPolynomial<Tp, Size>
+    inline constexpr StaticPolynomial<Tp, Size>
     operator*(const Tp& x, const StaticPolynomial<Tp, Size>& poly)
     { return StaticPolynomial<Tp, Size>(poly) *= x; }
 
@@ -743,24 +776,16 @@ namespace emsr
    */
   template<typename Tp, std::size_t SizeP, std::size_t SizeQ>
     inline constexpr StaticPolynomial<Tp, SizeP + SizeQ - 1>
-    operator*(StaticPolynomial<Tp, SizeP> P,
-	      StaticPolynomial<Tp, SizeQ> Q)
+    operator*(const StaticPolynomial<Tp, SizeP>& P,
+	      const StaticPolynomial<Tp, SizeQ>& Q)
     {
-      StaticPolynomial<Tp, P.degree() + Q.degree() + 1> R;
-      for (std::size_t i = 0; i <= P.degree(); ++i)
-	for (std::size_t j = 0; j <= Q.degree(); ++j)
-	  R[i + j] = P[i] * Q[j];
+      StaticPolynomial<Tp, SizeP + SizeQ - 1> R;
+      for (std::size_t i = 0; i < SizeP; ++i)
+	for (std::size_t j = 0; j < SizeQ; ++j)
+	  R[i + j] += P[i] * Q[j];
       return R;
     }
 
-  /**
-   * Return the product of two polynomials.
-   */
-  template<typename Tp, std::size_t SizeP, std::size_t SizeQ>
-    inline constexpr StaticPolynomial<Tp, SizeP + SizeQ - 1>
-    operator*(StaticPolynomial<Tp, SizeP> P,
-	      StaticPolynomial<Tp, SizeQ> Q);
-
   /**
    * Return type for divmod.
    */
@@ -804,6 +829,47 @@ namespace emsr
 	      StaticPolynomial<Tp, SizeQ> Q)
     { return divmod(P, Q).rem; }
 
+  /**
+   * Return the composition of two polynomials:
+   * @f[
+   *    R(x) = P(Q(x))
+   * @f]
+   * The result has degree @f$ deg(P) deg(Q) @f$.
+   */
+  template<typename Tp, std::size_t SizeP, std::size_t SizeQ>
+    constexpr StaticPolynomial<Tp, (SizeP - 1) * (SizeQ - 1) + 1>
+    compose(const StaticPolynomial<Tp, SizeP>& P,
+	    const StaticPolynomial<Tp, SizeQ>& Q);
+
+  /**
+   * Return the Cauchy upper bound on the moduli of the roots
+   * of a real-coefficient polynomial:
+   * @f[
+   *    |z| \le 1 + \max_{0 \le k < n} \left|\frac{a_k}{a_n}\right|
+   * @f]
+   * Leading zero coefficients are skipped.  A constant polynomial
+   * has no roots and the bound is zero.
+   */
+  template<typename Tp, std::size_t Size>
+    constexpr Tp
+    cauchy_bound(const StaticPolynomial<Tp, Size>& P);
+
+  /**
+   * Return the Fujiwara upper bound on the moduli of the roots
+   * of a real-coefficient polynomial:
+   * @f[
+   *    |z| \le 2 \max\left\{\left|\frac{a_{n-1}}{a_n}\right|,
+   *                        \left|\frac{a_{n-2}}{a_n}\right|^{1/2}, ...,
+   *                        \left|\frac{a_1}{a_n}\right|^{1/(n-1)},
+   *                        \left|\frac{a_0}{2a_n}\right|^{1/n}\right\}
+   * @f]
+   * This bound is never worse than twice the smallest possible
+   * bound of this form and is usually much tighter than the Cauchy bound.
+   */
+  template<typename Tp, std::size_t Size>
+    constexpr Tp
+    fujiwara_bound(const StaticPolynomial<Tp, Size>& P);
+
 } // namespace emsr
 
 #include <emsr/static_polynomial.tcc>
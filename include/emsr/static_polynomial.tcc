@@ -65,30 +65,120 @@ namespace emsr
     divmod(StaticPolynomial<Tp, SizeN> num,
 	   StaticPolynomial<Tp, SizeD> den)
     {
-      constexpr auto DegN = num.degree();
-      constexpr auto DegD = den.degree();
+      constexpr std::ptrdiff_t DegN = SizeN - 1;
+      constexpr std::ptrdiff_t DegD = SizeD - 1;
       auto rem = num;
       auto quo = StaticPolynomial<Tp, SizeN>{};
-      if (DegD <= DegN)
+      if constexpr (DegD <= DegN)
 	{
 	  for (std::ptrdiff_t k = DegN - DegD; k >= 0; --k)
 	    {
-	      quo.coefficient(k, rem.coefficient(DegD + k)
-				   / den.coefficient(DegD));
-	      for (int j = DegD + k - 1; j >= k; --j)
-		rem.coefficient(j, rem.coefficient(j)
-				       - quo.coefficient(k)
-				       * den.coefficient(j - k));
+	      quo[k] = rem[DegD + k] / den[DegD];
+	      for (std::ptrdiff_t j = DegD + k - 1; j >= k; --j)
+		rem[j] -= quo[k] * den[j - k];
 	    }
 	}
-      divmod_t<Tp, SizeN, SizeD> ret;
+      divmod_t<Tp, SizeN, SizeD> ret{};
       for (std::size_t i = 0ULL; i < divmod_t<Tp, SizeN, SizeD>::SizeQuo; ++i)
-        ret.quo[i] = quo[i];
+	ret.quo[i] = quo[i];
       for (std::size_t i = 0ULL; i < divmod_t<Tp, SizeN, SizeD>::SizeRem; ++i)
-        ret.rem[i] = rem[i];
+	ret.rem[i] = rem[i];
       return ret;
     }
 
+  /**
+   * Return the composition of two polynomials by Horner's rule
+   * with polynomial arguments.
+   */
+  template<typename Tp, std::size_t SizeP, std::size_t SizeQ>
+    constexpr StaticPolynomial<Tp, (SizeP - 1) * (SizeQ - 1) + 1>
+    compose(const StaticPolynomial<Tp, SizeP>& P,
+	    const StaticPolynomial<Tp, SizeQ>& Q)
+    {
+      constexpr std::size_t SizeR = (SizeP - 1) * (SizeQ - 1) + 1;
+      constexpr std::size_t DegQ = SizeQ - 1;
+      StaticPolynomial<Tp, SizeR> R;
+      R[0] = P[SizeP - 1];
+      std::size_t deg = 0;
+      for (std::ptrdiff_t i = std::ptrdiff_t(SizeP) - 2; i >= 0; --i)
+	{
+	  StaticPolynomial<Tp, SizeR> T;
+	  for (std::size_t a = 0; a <= deg; ++a)
+	    for (std::size_t b = 0; b <= DegQ; ++b)
+	      T[a + b] += R[a] * Q[b];
+	  T[0] += P[i];
+	  deg += DegQ;
+	  R = T;
+	}
+      return R;
+    }
+
+  /**
+   * Return the Cauchy upper bound on the moduli of the roots
+   * of a real-coefficient polynomial.
+   */
+  template<typename Tp, std::size_t Size>
+    constexpr Tp
+    cauchy_bound(const StaticPolynomial<Tp, Size>& P)
+    {
+      const auto abs = [](Tp x) constexpr { return x < Tp{0} ? -x : x; };
+
+      std::ptrdiff_t n = Size - 1;
+      while (n > 0 && P[n] == Tp{0})
+	--n;
+      if (n == 0)
+	return Tp{0};
+
+      const auto an = abs(P[n]);
+      auto bound = Tp{0};
+      for (std::ptrdiff_t k = 0; k < n; ++k)
+	bound = std::max(bound, abs(P[k]) / an);
+      return Tp{1} + bound;
+    }
+
+  /**
+   * Return the Fujiwara upper bound on the moduli of the roots
+   * of a real-coefficient polynomial.
+   */
+  template<typename Tp, std::size_t Size>
+    constexpr Tp
+    fujiwara_bound(const StaticPolynomial<Tp, Size>& P)
+    {
+      const auto abs = [](Tp x) constexpr { return x < Tp{0} ? -x : x; };
+
+      // Newton iteration for the k-th root of x >= 0 started from above
+      // so the iterates decrease monotonically to the root.
+      const auto root = [](Tp x, std::ptrdiff_t k) constexpr
+      {
+	if (x == Tp{0} || k == 1)
+	  return x;
+	auto y = std::max(Tp{1}, x);
+	while (true)
+	  {
+	    auto ykm1 = Tp{1};
+	    for (std::ptrdiff_t i = 1; i < k; ++i)
+	      ykm1 *= y;
+	    const auto y1 = (Tp(k - 1) * y + x / ykm1) / Tp(k);
+	    if (!(y1 < y))
+	      return y;
+	    y = y1;
+	  }
+      };
+
+      std::ptrdiff_t n = Size - 1;
+      while (n > 0 && P[n] == Tp{0})
+	--n;
+      if (n == 0)
+	return Tp{0};
+
+      const auto an = abs(P[n]);
+      auto bound = Tp{0};
+      for (std::ptrdiff_t k = 1; k < n; ++k)
+	bound = std::max(bound, root(abs(P[n - k]) / an, k));
+      bound = std::max(bound, root(abs(P[0]) / (Tp{2} * an), n));
+      return Tp{2} * bound;
+    }
+
 } // namespace emsr
 
 #endif // STATIC_POLYNOMIAL_TCC
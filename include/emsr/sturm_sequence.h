@@ -0,0 +1,144 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file sturm_sequence.h
+ *
+ * This file contains a Sturm sequence for counting the real zeros
+ * of a real polynomial in an interval.
+ */
+
+/**
+ * @def  STURM_SEQUENCE_H
+ *
+ * @brief  A guard for the Sturm sequence header.
+ */
+#ifndef STURM_SEQUENCE_H
+#define STURM_SEQUENCE_H 1
+
+#include <vector>
+#include <limits>
+
+#include <emsr/polynomial.h>
+
+namespace emsr
+{
+
+  /**
+   * The Sturm sequence of a real polynomial:
+   * @f[
+   *    P_0 = P, P_1 = P', P_{k+1} = -\mathrm{rem}(P_{k-1}, P_k)
+   * @f]
+   * The number of distinct real zeros in (a, b] is V(a) - V(b) where V(x)
+   * is the number of sign changes in the sequence evaluated at x.
+   *
+   * The chain is built once.  The members are stored in blocks of s_lanes
+   * with the coefficients of each order contiguous across the block
+   * so that the Horner recurrences for a block run together.
+   * Counting the sign changes at a point costs O(total degree)
+   * and does not allocate.
+   */
+  template<typename Real>
+    class SturmSequence
+    {
+    public:
+
+      using value_type = Real;
+      using size_type = std::size_t;
+
+      /**
+       * The number of chain members evaluated together.
+       */
+      static constexpr size_type s_lanes = 8;
+
+      /**
+       * Build the Sturm sequence of a polynomial.
+       * Each member is scaled to unit max norm.  The chain ends when
+       * a remainder is below @c tol relative to the quotient,
+       * as in gcd, so the last member approximates gcd(P, P').
+       */
+      explicit SturmSequence(const Polynomial<Real>& poly,
+			     Real tol = Real{10}
+				      * std::numeric_limits<Real>::epsilon());
+
+      /**
+       * Return the number of members of the chain.
+       */
+      size_type
+      size() const
+      { return this->m_size; }
+
+      /**
+       * Return the degree of the polynomial.
+       */
+      size_type
+      degree() const
+      { return this->m_degree; }
+
+      /**
+       * Return a member of the chain.
+       */
+      Polynomial<Real>
+      member(size_type i) const;
+
+      /**
+       * Return the number of sign changes in the chain at a point.
+       * The point may be infinite.  Zeros are skipped.
+       */
+      int
+      sign_changes(Real x) const;
+
+      /**
+       * Return the number of distinct real zeros in (a, b].
+       */
+      int
+      num_roots(Real a, Real b) const
+      { return this->sign_changes(a) - this->sign_changes(b); }
+
+      /**
+       * Return the number of distinct real zeros.
+       */
+      int
+      num_roots() const
+      { return this->m_changes_neg_inf - this->m_changes_pos_inf; }
+
+    private:
+
+      size_type m_size = 0;
+      size_type m_degree = 0;
+      int m_changes_neg_inf = 0;
+      int m_changes_pos_inf = 0;
+
+      /// The degree and coefficient offset of each block.
+      std::vector<size_type> m_block_degree;
+      std::vector<size_type> m_block_offset;
+
+      /// Coefficient i of member b * s_lanes + k of block b is at
+      /// m_coeff[m_block_offset[b] + i * s_lanes + k].
+      std::vector<Real> m_coeff;
+    };
+
+} // namespace emsr
+
+#include <emsr/sturm_sequence.tcc>
+
+#endif // STURM_SEQUENCE_H
@@ -0,0 +1,200 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file sturm_sequence.tcc
+ *
+ * This file contains the out-of-line implementations of the
+ * Sturm sequence class.
+ *
+ * @see sturm_sequence.h
+ */
+
+/**
+ * @def  STURM_SEQUENCE_TCC
+ *
+ * @brief  A guard for the Sturm sequence implementation header.
+ */
+#ifndef STURM_SEQUENCE_TCC
+#define STURM_SEQUENCE_TCC 1
+
+#include <stdexcept>
+#include <algorithm>
+
+namespace emsr
+{
+
+  /**
+   * Build the Sturm sequence of a polynomial.
+   */
+  template<typename Real>
+    SturmSequence<Real>::SturmSequence(const Polynomial<Real>& poly,
+				       Real tol)
+    {
+      using std::abs;
+      const auto norm = [](const Polynomial<Real>& p)
+      {
+	auto nrm = Real{0};
+	for (const auto& c : p)
+	  nrm = std::max(nrm, abs(c));
+	return nrm;
+      };
+
+      auto p0 = poly;
+      auto n = p0.degree();
+      while (n > 0 && p0[n] == Real{0})
+	--n;
+      p0.degree(n);
+      const auto n0 = norm(p0);
+      if (n0 == Real{0})
+	throw std::domain_error("SturmSequence: zero polynomial");
+      p0 /= n0;
+      this->m_degree = n;
+
+      std::vector<Polynomial<Real>> chain;
+      chain.push_back(std::move(p0));
+      if (n > 0)
+	{
+	  auto p1 = chain.back().derivative();
+	  p1 /= norm(p1);
+	  chain.push_back(std::move(p1));
+	}
+
+      Polynomial<Real> quo, rem;
+      while (chain.back().degree() > 0)
+	{
+	  const auto k = chain.size() - 1;
+	  divmod(chain[k - 1], chain[k], quo, rem);
+	  const auto nr = norm(rem);
+	  if (nr <= tol * std::max(Real{1}, norm(quo)))
+	    break;
+	  rem /= -nr;
+	  rem.deflate(tol);
+	  chain.push_back(rem);
+	}
+      this->m_size = chain.size();
+
+      // Pack the members into blocks.  Unused lanes and orders
+      // above a member's degree are zero.
+      const auto num_blocks = (this->m_size + s_lanes - 1) / s_lanes;
+      this->m_block_degree.resize(num_blocks);
+      this->m_block_offset.resize(num_blocks);
+      size_type offset = 0;
+      for (size_type b = 0; b < num_blocks; ++b)
+	{
+	  size_type deg = 0;
+	  for (size_type k = 0; k < s_lanes && b * s_lanes + k < this->m_size; ++k)
+	    deg = std::max(deg, chain[b * s_lanes + k].degree());
+	  this->m_block_degree[b] = deg;
+	  this->m_block_offset[b] = offset;
+	  offset += (deg + 1) * s_lanes;
+	}
+      this->m_coeff.assign(offset, Real{0});
+      for (size_type m = 0; m < this->m_size; ++m)
+	{
+	  const auto b = m / s_lanes;
+	  const auto k = m % s_lanes;
+	  auto c = this->m_coeff.data() + this->m_block_offset[b] + k;
+	  for (size_type i = 0; i <= chain[m].degree(); ++i)
+	    c[i * s_lanes] = chain[m][i];
+	}
+
+      // The signs at infinity are those of the leading coefficients.
+      int last_pos = 0, last_neg = 0;
+      for (const auto& p : chain)
+	{
+	  const auto lead = p[p.degree()];
+	  if (lead == Real{0})
+	    continue;
+	  const int pos = lead < Real{0} ? -1 : 1;
+	  const int neg = p.degree() % 2 == 0 ? pos : -pos;
+	  if (last_pos != 0 && pos != last_pos)
+	    ++this->m_changes_pos_inf;
+	  if (last_neg != 0 && neg != last_neg)
+	    ++this->m_changes_neg_inf;
+	  last_pos = pos;
+	  last_neg = neg;
+	}
+    }
+
+  /**
+   * Return a member of the chain.
+   */
+  template<typename Real>
+    Polynomial<Real>
+    SturmSequence<Real>::member(size_type i) const
+    {
+      if (i >= this->m_size)
+	throw std::domain_error("SturmSequence::member: index out of range");
+      const auto b = i / s_lanes;
+      const auto k = i % s_lanes;
+      const auto c = this->m_coeff.data() + this->m_block_offset[b] + k;
+      auto n = this->m_block_degree[b];
+      while (n > 0 && c[n * s_lanes] == Real{0})
+	--n;
+      Polynomial<Real> p(Real{0}, n);
+      for (size_type j = 0; j <= n; ++j)
+	p[j] = c[j * s_lanes];
+      return p;
+    }
+
+  /**
+   * Return the number of sign changes in the chain at a point.
+   */
+  template<typename Real>
+    int
+    SturmSequence<Real>::sign_changes(Real x) const
+    {
+      if (x == std::numeric_limits<Real>::infinity())
+	return this->m_changes_pos_inf;
+      if (x == -std::numeric_limits<Real>::infinity())
+	return this->m_changes_neg_inf;
+
+      int changes = 0;
+      int last = 0;
+      Real v[s_lanes];
+      for (size_type b = 0; b < this->m_block_degree.size(); ++b)
+	{
+	  const auto n = this->m_block_degree[b];
+	  const auto c = this->m_coeff.data() + this->m_block_offset[b];
+	  for (size_type k = 0; k < s_lanes; ++k)
+	    v[k] = c[n * s_lanes + k];
+	  for (size_type i = n; i-- > 0;)
+	    for (size_type k = 0; k < s_lanes; ++k)
+	      v[k] = v[k] * x + c[i * s_lanes + k];
+
+	  for (size_type k = 0; k < s_lanes; ++k)
+	    {
+	      if (v[k] == Real{0})
+		continue;
+	      const int sign = v[k] < Real{0} ? -1 : 1;
+	      if (last != 0 && sign != last)
+		++changes;
+	      last = sign;
+	    }
+	}
+      return changes;
+    }
+
+} // namespace emsr
+
+#endif // STURM_SEQUENCE_TCC
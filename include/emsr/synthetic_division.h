@@ -0,0 +1,243 @@
+
+// Copyright (C) 2020-2022 Edward M. Smith-Rowland
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+/**
+ * @file synthetic_division.h
+ *
+ * This file contains the synthetic division kernels shared by the solvers.
+ *
+ * All kernels take coefficients highest order first.
+ * Division of
+ * @f[
+ *    P(x) = p_0 x^n + p_1 x^{n-1} + ... + p_n
+ * @f]
+ * by a linear factor (x - s) writes the partial sums
+ * @f[
+ *    q_0 = p_0, \quad q_i = q_{i-1} s + p_i
+ * @f]
+ * so that q_0 ... q_{n-1} are the quotient and q_n = P(s).
+ * Division by a quadratic factor (x^2 + u x + v) writes
+ * @f[
+ *    q_0 = p_0, \quad q_1 = p_1 - q_0 u, \quad
+ *    q_i = p_i - q_{i-1} u - q_{i-2} v
+ * @f]
+ * so that q_0 ... q_{n-2} are the quotient and
+ * @f[
+ *    P(x) = Q(x)(x^2 + u x + v) + q_{n-1}(x + u) + q_n.
+ * @f]
+ *
+ * The lane kernels divide Lanes polynomials of the same degree at once.
+ * The coefficients are interleaved: coefficient i of polynomial k
+ * is at index i * Lanes + k.  The inner loops run across the lanes
+ * so that they vectorize.
+ */
+
+/**
+ * @def  SYNTHETIC_DIVISION_H
+ *
+ * @brief  A guard for the synthetic division kernels header.
+ */
+#ifndef SYNTHETIC_DIVISION_H
+#define SYNTHETIC_DIVISION_H 1
+
+#include <cstddef>
+#include <iterator>
+#include <utility> // For pair.
+
+namespace emsr
+{
+
+  /**
+   * Divide a polynomial by the linear factor (x - s).
+   * The partial sums are written to the output range which must hold
+   * as many values as the input range and may be the input range.
+   * The range must not be empty.
+   *
+   * @return The value of the polynomial at s.
+   */
+  template<typename InIter, typename OutIter, typename Tp>
+    inline Tp
+    synthetic_divide_linear(InIter pbegin, InIter pend, const Tp& s,
+			    OutIter qbegin)
+    {
+      Tp pv = *pbegin;
+      *qbegin = pv;
+      for (++pbegin, ++qbegin; pbegin != pend; ++pbegin, ++qbegin)
+	{
+	  pv = pv * s + *pbegin;
+	  *qbegin = pv;
+	}
+      return pv;
+    }
+
+  /**
+   * Divide a polynomial by the quadratic factor (x^2 + u x + v).
+   * The partial sums are written to the output range which must hold
+   * as many values as the input range and may be the input range.
+   * The range must hold at least two coefficients.
+   *
+   * @return The last two partial sums (q_n, q_(n-1)).
+   */
+  template<typename InIter, typename OutIter, typename Tp>
+    inline std::pair<Tp, Tp>
+    synthetic_divide_quadratic(InIter pbegin, InIter pend,
+			       const Tp& u, const Tp& v, OutIter qbegin)
+    {
+      Tp b = *pbegin;
+      *qbegin = b;
+      ++pbegin, ++qbegin;
+      Tp a = *pbegin - b * u;
+      *qbegin = a;
+      for (++pbegin, ++qbegin; pbegin != pend; ++pbegin, ++qbegin)
+	{
+	  const Tp c = *pbegin - a * u - b * v;
+	  *qbegin = c;
+	  b = a;
+	  a = c;
+	}
+      return {a, b};
+    }
+
+  /**
+   * Divide a polynomial by the quadratic factor (x^2 + u x + v) and
+   * divide the sequence of partial sums by the same factor again.
+   * The second partial sums give the derivatives of the remainder with
+   * respect to u and v as needed by Bairstow's method.
+   * Both output ranges must hold as many values as the input range.
+   * The range must hold at least two coefficients.
+   */
+  template<typename InIter, typename OutIter, typename OutIter2,
+	   typename Tp>
+    inline void
+    synthetic_divide_quadratic2(InIter pbegin, InIter pend,
+				const Tp& u, const Tp& v,
+				OutIter qbegin, OutIter2 qqbegin)
+    {
+      Tp b = *pbegin;
+      Tp bb = b;
+      *qbegin = b;
+      *qqbegin = bb;
+      ++pbegin, ++qbegin, ++qqbegin;
+      Tp a = *pbegin - b * u;
+      Tp aa = a - bb * u;
+      *qbegin = a;
+      *qqbegin = aa;
+      for (++pbegin, ++qbegin, ++qqbegin; pbegin != pend;
+	   ++pbegin, ++qbegin, ++qqbegin)
+	{
+	  const Tp c = *pbegin - a * u - b * v;
+	  const Tp cc = c - aa * u - bb * v;
+	  *qbegin = c;
+	  *qqbegin = cc;
+	  b = a;
+	  a = c;
+	  bb = aa;
+	  aa = cc;
+	}
+    }
+
+  /**
+   * Divide Lanes interleaved polynomials with size coefficients
+   * by the linear factors (x - s[k]).
+   * The values of the polynomials are the last row of q.
+   */
+  template<std::size_t Lanes, typename Tp>
+    inline void
+    synthetic_divide_linear_lanes(const Tp* p, std::size_t size,
+				  const Tp* s, Tp* q)
+    {
+      for (std::size_t k = 0; k < Lanes; ++k)
+	q[k] = p[k];
+      for (std::size_t i = 1; i < size; ++i)
+	{
+	  const Tp* pi = p + i * Lanes;
+	  const Tp* qm = q + (i - 1) * Lanes;
+	  Tp* qi = q + i * Lanes;
+	  for (std::size_t k = 0; k < Lanes; ++k)
+	    qi[k] = qm[k] * s[k] + pi[k];
+	}
+    }
+
+  /**
+   * Divide Lanes interleaved polynomials with size >= 2 coefficients
+   * by the quadratic factors (x^2 + u[k] x + v[k]).
+   * The remainders are in the last two rows of q.
+   */
+  template<std::size_t Lanes, typename Tp>
+    inline void
+    synthetic_divide_quadratic_lanes(const Tp* p, std::size_t size,
+				     const Tp* u, const Tp* v, Tp* q)
+    {
+      for (std::size_t k = 0; k < Lanes; ++k)
+	{
+	  q[k] = p[k];
+	  q[Lanes + k] = p[Lanes + k] - q[k] * u[k];
+	}
+      for (std::size_t i = 2; i < size; ++i)
+	{
+	  const Tp* pi = p + i * Lanes;
+	  const Tp* qm1 = q + (i - 1) * Lanes;
+	  const Tp* qm2 = q + (i - 2) * Lanes;
+	  Tp* qi = q + i * Lanes;
+	  for (std::size_t k = 0; k < Lanes; ++k)
+	    qi[k] = pi[k] - qm1[k] * u[k] - qm2[k] * v[k];
+	}
+    }
+
+  /**
+   * Divide Lanes interleaved polynomials with size >= 2 coefficients
+   * by the quadratic factors (x^2 + u[k] x + v[k]) and divide the
+   * partial sums again.
+   */
+  template<std::size_t Lanes, typename Tp>
+    inline void
+    synthetic_divide_quadratic2_lanes(const Tp* p, std::size_t size,
+				      const Tp* u, const Tp* v,
+				      Tp* q, Tp* qq)
+    {
+      for (std::size_t k = 0; k < Lanes; ++k)
+	{
+	  q[k] = p[k];
+	  qq[k] = q[k];
+	  q[Lanes + k] = p[Lanes + k] - q[k] * u[k];
+	  qq[Lanes + k] = q[Lanes + k] - qq[k] * u[k];
+	}
+      for (std::size_t i = 2; i < size; ++i)
+	{
+	  const Tp* pi = p + i * Lanes;
+	  const Tp* qm1 = q + (i - 1) * Lanes;
+	  const Tp* qm2 = q + (i - 2) * Lanes;
+	  const Tp* qqm1 = qq + (i - 1) * Lanes;
+	  const Tp* qqm2 = qq + (i - 2) * Lanes;
+	  Tp* qi = q + i * Lanes;
+	  Tp* qqi = qq + i * Lanes;
+	  for (std::size_t k = 0; k < Lanes; ++k)
+	    {
+	      qi[k] = pi[k] - qm1[k] * u[k] - qm2[k] * v[k];
+	      qqi[k] = qi[k] - qqm1[k] * u[k] - qqm2[k] * v[k];
+	    }
+	}
+    }
+
+} // namespace emsr
+
+#endif // SYNTHETIC_DIVISION_H
@@ -0,0 +1,175 @@
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <complex>
+#include <cmath>
+
+#include <emsr/fft.h>
+#include <emsr/chebyshev_polynomial.h>
+
+#include "test_check.h"
+
+int
+main()
+{
+  int num_errors = 0;
+  std::cout << std::setprecision(std::numeric_limits<double>::digits10);
+
+  const auto eps = std::numeric_limits<double>::epsilon();
+  const ErrorCheck check(num_errors);
+
+  // Convolution by FFT agrees with the direct sum.
+  {
+    std::vector<double> a(300), b(200);
+    for (std::size_t i = 0; i < a.size(); ++i)
+      a[i] = std::sin(1.0 + i);
+    for (std::size_t i = 0; i < b.size(); ++i)
+      b[i] = std::cos(2.0 * i);
+    const auto c = emsr::convolve(a, b);
+    auto err = 0.0;
+    for (std::size_t k = 0; k < c.size(); ++k)
+      {
+	auto s = 0.0;
+	for (std::size_t i = 0; i < a.size(); ++i)
+	  if (k >= i && k - i < b.size())
+	    s += a[i] * b[k - i];
+	err = std::max(err, std::abs(c[k] - s));
+      }
+    check("convolve", err, 1000 * eps);
+    if (c.size() != a.size() + b.size() - 1)
+      ++num_errors;
+  }
+
+  // Clenshaw evaluation of T_n(cos t) = cos(nt).
+  for (std::size_t n : {0u, 1u, 5u, 40u})
+    {
+      const emsr::ChebyshevPolynomial<double> T(1.0, n);
+      auto err = 0.0;
+      for (int i = 0; i <= 20; ++i)
+	{
+	  const auto t = 0.15 * i;
+	  err = std::max(err, std::abs(T(std::cos(t)) - std::cos(n * t)));
+	}
+      check("T_n(cos t)", err, 100 * eps);
+    }
+
+  // Batch evaluation agrees with scalar evaluation.
+  {
+    const emsr::ChebyshevPolynomial<double> P{1.0, -0.5, 0.25, 0.125, -2.0};
+    std::vector<double> x(21), r(21);
+    for (std::size_t i = 0; i < x.size(); ++i)
+      x[i] = -1.0 + 0.1 * i;
+    P(x.begin(), x.end(), r.begin());
+    for (std::size_t i = 0; i < x.size(); ++i)
+      if (r[i] != P(x[i]))
+	++num_errors;
+  }
+
+  // Products, direct and by DCT.
+  for (std::size_t n : {7u, 100u})
+    {
+      std::vector<double> a(n + 1), b(n / 2 + 40);
+      for (std::size_t i = 0; i < a.size(); ++i)
+	a[i] = 1.0 / (1.0 + i);
+      for (std::size_t i = 0; i < b.size(); ++i)
+	b[i] = std::cos(0.3 * i);
+      const emsr::ChebyshevPolynomial<double> A(a.begin(), a.end());
+      const emsr::ChebyshevPolynomial<double> B(b.begin(), b.end());
+      const auto C = A * B;
+      if (C.degree() != A.degree() + B.degree())
+	++num_errors;
+      auto err = 0.0, scale = 0.0;
+      for (int i = 0; i <= 40; ++i)
+	{
+	  const auto x = -1.0 + 0.05 * i;
+	  err = std::max(err, std::abs(C(x) - A(x) * B(x)));
+	  scale = std::max(scale, std::abs(A(x) * B(x)));
+	}
+      check("product", err / scale, 1000 * eps);
+    }
+
+  // Derivative, integral and definite integral of T_0 + 2T_1 + 3T_2 + 4T_3.
+  {
+    const emsr::ChebyshevPolynomial<double> P{1.0, 2.0, 3.0, 4.0};
+    const auto M = P.polynomial();
+    const auto dP = P.derivative();
+    const auto IP = P.integral(0.5);
+    const auto dM = M.derivative();
+    const auto IM = M.integral();
+    auto err = 0.0;
+    for (int i = 0; i <= 20; ++i)
+      {
+	const auto x = -1.0 + 0.1 * i;
+	err = std::max(err, std::abs(dP(x) - dM(x)));
+	err = std::max(err, std::abs(IP(x) - (IM(x) - IM(-1.0) + 0.5)));
+      }
+    check("derivative and integral", err, 100 * eps);
+    check("sum", P.sum() - (IM(1.0) - IM(-1.0)), 100 * eps);
+    check("integral at -1", IP(-1.0) - 0.5, 100 * eps);
+  }
+
+  // Conversion between bases.
+  for (std::size_t n : {10u, 50u})
+    {
+      std::vector<double> c(n + 1);
+      for (std::size_t i = 0; i <= n; ++i)
+	c[i] = std::pow(0.5, double(i)) * (i % 3 == 0 ? -1.0 : 1.0);
+      const emsr::ChebyshevPolynomial<double> P(c.begin(), c.end());
+      const auto M = P.polynomial();
+      const emsr::ChebyshevPolynomial<double> Q(M);
+      auto err = 0.0;
+      for (std::size_t i = 0; i <= n; ++i)
+	err = std::max(err, std::abs(Q[i] - P[i]));
+      check("basis round trip", err, 1.0e-10);
+      err = 0.0;
+      for (int i = 0; i <= 20; ++i)
+	{
+	  const auto x = -1.0 + 0.1 * i;
+	  err = std::max(err, std::abs(M(x) - P(x)));
+	}
+      check("monomial values", err, 1.0e-10);
+    }
+
+  // Adaptive construction.
+  {
+    const emsr::ChebyshevPolynomial<double>
+      F([](double x) { return std::cos(10.0 * x) + std::exp(x); });
+    auto err = 0.0;
+    for (int i = 0; i <= 200; ++i)
+      {
+	const auto x = -1.0 + 0.01 * i;
+	err = std::max(err, std::abs(F(x) - std::cos(10.0 * x) - std::exp(x)));
+      }
+    std::cout << "adaptive degree = " << F.degree() << '\n';
+    check("adaptive", err, 1.0e-13);
+    check("adaptive sum", F.sum() - (0.2 * std::sin(10.0)
+				     + std::exp(1.0) - std::exp(-1.0)),
+	  1.0e-13);
+
+    const emsr::ChebyshevPolynomial<std::complex<double>>
+      Z([](double x) { return std::exp(std::complex<double>(0.0, 3.0 * x)); });
+    auto zerr = 0.0;
+    for (int i = 0; i <= 20; ++i)
+      {
+	const auto x = -1.0 + 0.1 * i;
+	zerr = std::max(zerr, std::abs(Z(x)
+			 - std::exp(std::complex<double>(0.0, 3.0 * x))));
+      }
+    check("adaptive complex", zerr, 1.0e-13);
+
+    try
+      {
+	emsr::ChebyshevPolynomial<double> S([](double x)
+					    { return std::abs(x); },
+					    1.0e-15, 256);
+	++num_errors;
+      }
+    catch (const std::runtime_error&)
+      { }
+  }
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
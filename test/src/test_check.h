@@ -0,0 +1,33 @@
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H 1
+
+#include <cmath>
+#include <iostream>
+
+/**
+ * Print a named error and count it as a failure if it is not within
+ * the tolerance.  A NaN error counts as a failure.
+ */
+class ErrorCheck
+{
+public:
+
+  explicit
+  ErrorCheck(int& num_errors)
+  : m_num_errors(num_errors)
+  { }
+
+  void
+  operator()(const char* what, double err, double tol) const
+  {
+    std::cout << what << ": error = " << err << '\n';
+    if (!(std::abs(err) <= tol))
+      ++this->m_num_errors;
+  }
+
+private:
+
+  int& m_num_errors;
+};
+
+#endif // TEST_CHECK_H
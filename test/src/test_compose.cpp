@@ -0,0 +1,125 @@
+
+#include <iostream>
+#include <random>
+#include <algorithm>
+#include <complex>
+#include <chrono>
+
+#include <emsr/compose.h>
+
+template<typename Tp>
+  emsr::Polynomial<Tp>
+  horner_compose(const emsr::Polynomial<Tp>& P, const emsr::Polynomial<Tp>& Q)
+  {
+    emsr::Polynomial<Tp> R(P[P.degree()]);
+    for (std::size_t i = P.degree(); i-- > 0;)
+      R = R * Q + P[i];
+    return R;
+  }
+
+int
+main()
+{
+  int num_errors = 0;
+
+  // Compile-time composition.
+  {
+    constexpr emsr::StaticPolynomial<double, 3> P{1.0, 2.0, 3.0};
+    constexpr emsr::StaticPolynomial<double, 3> Q{0.0, 1.0, 1.0};
+    constexpr auto R = emsr::compose(P, Q);
+    static_assert(R.degree() == 4);
+    static_assert(R[0] == 1.0 && R[1] == 2.0 && R[2] == 5.0
+		  && R[3] == 6.0 && R[4] == 3.0);
+    constexpr auto C = emsr::compose(P, emsr::StaticPolynomial<double, 1>{2.0});
+    static_assert(C.degree() == 0 && C[0] == 17.0);
+  }
+
+  // Random polynomials with coefficients scaled so that |Q(x)| <= 1
+  // on [-1, 1] and the coefficients of the powers of Q stay bounded.
+  std::mt19937 urng(1234);
+  std::uniform_real_distribution<double> unif(-1.0, 1.0);
+  const auto random_poly = [&urng, &unif](std::size_t n, double scale)
+    {
+      return emsr::Polynomial<double>([&](std::size_t)
+				      { return scale * unif(urng); }, n);
+    };
+
+  // Against Horner's rule.
+  for (auto [n, m] : {std::pair{1, 1}, {2, 3}, {7, 5}, {16, 4}, {33, 9},
+		      {60, 60}, {5, 0}, {0, 7}})
+    {
+      const auto P = random_poly(n, 1.0);
+      const auto Q = random_poly(m, 1.0 / (m + 1));
+      const auto R = emsr::compose(P, Q);
+      const auto S = horner_compose(P, Q);
+      double err = 0.0;
+      if (R.degree() != S.degree())
+	err = 1.0;
+      else
+	for (std::size_t i = 0; i <= R.degree(); ++i)
+	  err = std::max(err, std::abs(R[i] - S[i]));
+      std::cout << "degree " << n << " o " << m << ": max error = "
+		<< err << '\n';
+      if (err > 1.0e-12)
+	++num_errors;
+    }
+
+  // Unscaled random polynomials whose composition has coefficients
+  // spanning many orders of magnitude.
+  for (std::size_t n : {30, 60})
+    {
+      std::mt19937 urng5(5);
+      const auto P = emsr::Polynomial<double>([&](std::size_t)
+					      { return unif(urng5); }, n);
+      const auto Q = emsr::Polynomial<double>([&](std::size_t)
+					      { return unif(urng5); }, n);
+      const auto R = emsr::compose(P, Q);
+      const auto S = horner_compose(P, Q);
+      double err = 0.0;
+      for (std::size_t i = 0; i <= S.degree(); ++i)
+	err = std::max(err, std::abs(R[i] - S[i]) / std::abs(S[i]));
+      std::cout << "unscaled degree " << n << " o " << n
+		<< ": max relative coefficient error = " << err
+		<< "  R[0] = " << R[0] << "  P(Q(0)) = " << P(Q(0.0)) << '\n';
+      if (R.degree() != n * n || err > 1.0e-8)
+	++num_errors;
+      for (double x : {0.0, 0.5, -0.5})
+	if (std::abs(R(x) - P(Q(x))) > 1.0e-12 * std::abs(P(Q(x))))
+	  ++num_errors;
+    }
+
+  // Complex coefficients.
+  {
+    using Cmplx = std::complex<double>;
+    const emsr::Polynomial<Cmplx> P({Cmplx(1.0, 1.0), Cmplx(0.0, 2.0),
+				     Cmplx(-1.0, 0.5)});
+    const emsr::Polynomial<Cmplx> Q({Cmplx(0.5, 0.0), Cmplx(0.0, -1.0)});
+    const auto R = emsr::compose(P, Q);
+    const Cmplx z(0.3, -0.2);
+    if (std::abs(R(z) - P(Q(z))) > 1.0e-14)
+      ++num_errors;
+  }
+
+  // The size the fast method is for.
+  {
+    const auto P = random_poly(200, 1.0);
+    const auto Q = random_poly(200, 1.0 / 201);
+    const auto t0 = std::chrono::steady_clock::now();
+    const auto R = emsr::compose(P, Q);
+    const auto t1 = std::chrono::steady_clock::now();
+    std::cout << "degree 200 o 200: "
+	      << std::chrono::duration<double>(t1 - t0).count() << " s\n";
+    if (R.degree() != 40000)
+      ++num_errors;
+    double err = 0.0;
+    for (double x : {-1.0, -0.5, 0.0, 0.25, 0.75, 1.0})
+      err = std::max(err, std::abs(R(x) - P(Q(x))));
+    std::cout << "max evaluation error = " << err << '\n';
+    if (err > 1.0e-10)
+      ++num_errors;
+  }
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
@@ -0,0 +1,73 @@
+
+#include <iostream>
+#include <vector>
+#include <random>
+
+#include <emsr/counter_engine.h>
+#include <emsr/solver_bairstow.h>
+
+int
+main()
+{
+  int num_errors = 0;
+
+  // Streams are reproducible.
+  emsr::CounterEngine a(42, 7), b(42, 7);
+  for (int i = 0; i < 1000; ++i)
+    if (a() != b())
+      {
+	++num_errors;
+	break;
+      }
+
+  // Discarding is the same as drawing.
+  emsr::CounterEngine c(42, 7), d(42, 7);
+  for (int i = 0; i < 10; ++i)
+    c();
+  d.discard(10);
+  if (c != d || c() != d())
+    ++num_errors;
+
+  // Neighboring streams and seeds differ.
+  emsr::CounterEngine s0(42, 0), s1(42, 1), t0(43, 0);
+  const auto x0 = s0(), x1 = s1(), y0 = t0();
+  std::cout << std::hex << x0 << ' ' << x1 << ' ' << y0 << std::dec << '\n';
+  if (x0 == x1 || x0 == y0)
+    ++num_errors;
+
+  // Canonical values are in [0, 1) with the right mean.
+  emsr::CounterEngine u(1);
+  auto sum = 0.0;
+  const int num = 100000;
+  for (int i = 0; i < num; ++i)
+    {
+      const auto x = u.canonical<double>();
+      if (x < 0.0 || x >= 1.0)
+	++num_errors;
+      sum += x;
+    }
+  std::cout << "mean = " << sum / num << '\n';
+  if (std::abs(sum / num - 0.5) > 0.01)
+    ++num_errors;
+
+  // The engine works with the standard distributions.
+  std::uniform_int_distribution<int> pdf(1, 6);
+  const auto roll = pdf(u);
+  if (roll < 1 || roll > 6)
+    ++num_errors;
+
+  // Solving with the same seed and index is bit reproducible.
+  const std::vector<double> coeff{2.0, -1.0, 3.0, -2.0, 5.0, 1.0};
+  emsr::BairstowSolver<double> bs1(coeff, 2022, 17), bs2(coeff, 2022, 17);
+  const auto z1 = bs1.solve();
+  const auto z2 = bs2.solve();
+  if (z1.size() != z2.size())
+    ++num_errors;
+  else
+    for (std::size_t i = 0; i < z1.size(); ++i)
+      if (emsr::real(z1[i]) != emsr::real(z2[i])
+       || emsr::imag(z1[i]) != emsr::imag(z2[i]))
+	++num_errors;
+
+  return num_errors;
+}
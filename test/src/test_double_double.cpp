@@ -0,0 +1,171 @@
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <complex>
+
+#include <emsr/double_double.h>
+#include <emsr/polynomial.h>
+#include <emsr/static_polynomial.h>
+#include <emsr/rational_polynomial.h>
+#include <emsr/solver_jenkins_traub.h>
+#include <emsr/solver_laguerre.h>
+#include <emsr/solver_bairstow.h>
+#include <emsr/solver_low_degree.h>
+#include <emsr/root_polish.h>
+
+using DD = emsr::DoubleDouble;
+
+int
+main()
+{
+  int num_errors = 0;
+  std::cout << std::setprecision(std::numeric_limits<DD>::digits10);
+
+  const auto eps = std::numeric_limits<DD>::epsilon();
+  const auto tol = DD{64} * eps;
+  const auto check = [&num_errors](const char* what, DD err, DD tol)
+    {
+      std::cout << what << ": error = " << double(err) << '\n';
+      if (!(abs(err) <= tol))
+	++num_errors;
+    };
+
+  // Arithmetic and elementary functions.
+  constexpr DD third = DD{1} / DD{3};
+  check("1/3", third * 3 - 1, tol);
+  const auto rt2 = sqrt(DD{2});
+  check("sqrt(2)^2", rt2 * rt2 - 2, tol);
+  check("log(exp(1.5))", log(exp(DD{1.5})) - DD{1.5}, tol);
+  check("4atan(1)", 4 * atan(DD{1}) - emsr::dd_pi, tol);
+  const auto s = sin(DD{0.7}), c = cos(DD{0.7});
+  check("sin^2 + cos^2", s * s + c * c - 1, tol);
+  check("cbrt(27)", cbrt(DD{27}) - 3, tol);
+  check("pow(2, 0.5)", pow(DD{2}, DD{0.5}) - rt2, tol);
+
+  // Stream round trip.
+  std::ostringstream out;
+  out << std::setprecision(std::numeric_limits<DD>::max_digits10) << third;
+  std::istringstream in(out.str());
+  DD third2;
+  in >> third2;
+  std::cout << "1/3 = " << out.str() << '\n';
+  check("stream round trip", third2 - third, tol);
+
+  // Fixed output rounds and pads like the builtin types.
+  for (const double v : {0.006, 0.0001, 0.004, 0.00949, 0.0096, 0.05, 9.9949,
+			 9.996, 0.3, 123.456, -0.006, -0.0001, 0.0, 1.0e-30})
+    for (const int p : {0, 1, 2, 3, 6})
+      {
+	std::ostringstream dout, ddout;
+	dout << std::fixed << std::setprecision(p) << v;
+	ddout << std::fixed << std::setprecision(p) << DD{v};
+	if (ddout.str() != dout.str())
+	  {
+	    std::cout << "fixed " << p << ": " << ddout.str()
+		      << " != " << dout.str() << '\n';
+	    ++num_errors;
+	  }
+      }
+
+  // Large arguments keep the logarithm accurate.
+  const DD big{1.0e300};
+  const auto log_big = DD{300} * log(DD{10}) + log(big / pow(DD{10}, 300));
+  check("log(1e300)", (log(big) - log_big) / log_big, DD{4} * eps);
+
+  // Polynomial evaluation, derivative and division.
+  // P(x) = (x - 1/3)(x^2 + 2)
+  const emsr::Polynomial<DD> P({-third * 2, DD{2}, -third, DD{1}});
+  check("P(1/3)", P(third), tol);
+  check("P'(1/3)", P.derivative()(third) - (third * third + 2), tol);
+  emsr::Polynomial<DD> quo, rem;
+  divmod(P, emsr::Polynomial<DD>({-third, DD{1}}), quo, rem);
+  check("P/(x-1/3) remainder", rem[0], tol);
+  check("P/(x-1/3) quotient", quo(DD{1}) - 3, tol);
+
+  // Static polynomials.
+  constexpr emsr::StaticPolynomial<DD, 3> S{DD{1}, DD{-2}, DD{1}};
+  check("static (x-1)^2", S(DD{1} + third) - third * third, tol);
+
+  // Rational polynomials.
+  const emsr::RationalPolynomial<DD> R(P, emsr::Polynomial<DD>({DD{2}, DD{0}, DD{1}}));
+  check("rational", R(DD{2}) - (DD{2} - third), tol);
+
+  // Solvers.
+  std::vector<DD> coef(P.rbegin(), P.rend());
+  emsr::JenkinsTraubSolver<DD> jt(coef);
+  const auto zjt = jt.solve();
+  DD err_jt{0};
+  for (const auto& z : zjt)
+    err_jt = std::max(err_jt, abs(P(std::complex<DD>(emsr::real(z),
+						      emsr::imag(z)))));
+  check("Jenkins-Traub residual", err_jt, DD{1024} * eps);
+  if (zjt.size() != 3)
+    ++num_errors;
+
+  // The complex Jenkins-Traub solver takes complex coefficients.
+  std::vector<std::complex<DD>> ccoef(coef.begin(), coef.end());
+  emsr::JenkinsTraubSolver<std::complex<DD>> cjt(ccoef);
+  const auto zcjt = cjt.solve();
+  DD err_cjt{0};
+  for (const auto& z : zcjt)
+    err_cjt = std::max(err_cjt, abs(P(z)));
+  check("complex Jenkins-Traub residual", err_cjt, DD{1024} * eps);
+  if (zcjt.size() != 3)
+    ++num_errors;
+
+  emsr::Polynomial<std::complex<DD>> CP(P.begin(), P.end());
+  emsr::LaguerreSolver<DD> lag(CP);
+  const auto zlag = lag.solve();
+  DD err_lag{0};
+  for (const auto& z : zlag)
+    err_lag = std::max(err_lag, abs(P(z)));
+  check("Laguerre residual", err_lag, DD{1024} * eps);
+
+  // Bairstow takes the coefficients low order first.
+  std::vector<DD> bcoef(P.begin(), P.end());
+  emsr::BairstowSolver<DD> bs(bcoef);
+  const auto zbs = bs.solve();
+  DD err_bs{0};
+  for (const auto& z : zbs)
+    err_bs = std::max(err_bs, abs(P(std::complex<DD>(emsr::real(z),
+						      emsr::imag(z)))));
+  check("Bairstow residual", err_bs, DD{1.0e-20});
+
+  // Low-degree solvers: (x - 1)(x - 2)(x + 3) has three real roots
+  // and (x - 1)(x - 2)(x - 3)(x - 4) four.
+  const auto root_error = [](const auto& zeros, std::vector<DD> exact)
+    {
+      DD err{0};
+      for (const auto& z : zeros)
+	{
+	  DD best{1};
+	  for (const auto& r : exact)
+	    best = std::min(best, abs(std::complex<DD>(emsr::real(z) - r,
+							emsr::imag(z))));
+	  err = std::max(err, best);
+	}
+      return err;
+    };
+  const auto zcub = emsr::cubic<DD>(DD{6}, DD{-7}, DD{0}, DD{1});
+  check("cubic roots", root_error(zcub, {DD{1}, DD{2}, DD{-3}}),
+	DD{1024} * eps);
+  const auto zquart = emsr::quartic<DD>(DD{24}, DD{-50}, DD{35},
+					DD{-10}, DD{1});
+  check("quartic roots", root_error(zquart, {DD{1}, DD{2}, DD{3}, DD{4}}),
+	DD{1024} * eps);
+
+  // Double-double as the polishing type.
+  const emsr::Polynomial<double> W({-6.0, 11.0, -6.0, 1.0});
+  std::vector<std::complex<double>> zw{{1.0 + 1.0e-9, 0.0}, {2.0 - 1.0e-9, 0.0},
+				       {3.0 + 1.0e-9, 0.0}};
+  emsr::polish_roots<double, DD>(W, zw, 0.0);
+  for (int k = 0; k < 3; ++k)
+    if (zw[k] != std::complex<double>(k + 1))
+      ++num_errors;
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
@@ -0,0 +1,112 @@
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <chrono>
+
+#include <emsr/gauss_quadrature.h>
+
+#include "test_check.h"
+
+template<typename Recurrence>
+  double
+  compare(const char* what, unsigned n, const Recurrence& rec)
+  {
+    const auto gw = emsr::golub_welsch(n, rec,
+			emsr::GaussFamily<Recurrence>(rec).weight_integral());
+    const auto gm = emsr::gauss_march(n, rec);
+    double xmax = 0.0, wmax = 0.0;
+    for (unsigned i = 0; i < n; ++i)
+      {
+	xmax = std::max(xmax, std::abs(gw.nodes[i]));
+	wmax = std::max(wmax, gw.weights[i]);
+      }
+    double err_x = 0.0, err_w = 0.0;
+    for (unsigned i = 0; i < n; ++i)
+      {
+	err_x = std::max(err_x, std::abs(gw.nodes[i] - gm.nodes[i]) / xmax);
+	err_w = std::max(err_w, std::abs(gw.weights[i] - gm.weights[i]) / wmax);
+      }
+    std::cout << what << ": node error = " << err_x
+	      << "  weight error = " << err_w << '\n';
+    return std::max(err_x, err_w);
+  }
+
+int
+main()
+{
+  int num_errors = 0;
+  std::cout << std::setprecision(std::numeric_limits<double>::digits10);
+
+  const ErrorCheck check(num_errors);
+
+  // Five point Gauss-Legendre.
+  const auto g5 = emsr::gauss_quadrature<emsr::LegendreRecurrence<double>>(5);
+  const double x5 = std::sqrt(5.0 + 2.0 * std::sqrt(10.0 / 7.0)) / 3.0;
+  const double w5 = (322.0 - 13.0 * std::sqrt(70.0)) / 900.0;
+  check("Gauss-Legendre 5 node", g5.nodes[4] - x5, 1.0e-15);
+  check("Gauss-Legendre 5 weight", g5.weights[4] - w5, 1.0e-15);
+  check("Gauss-Legendre 5 x^8",
+	g5.integrate([](double x){ return std::pow(x, 8); }) - 2.0 / 9.0,
+	1.0e-15);
+
+  // Chebyshev closed forms against Golub-Welsch.
+  const auto t20 = emsr::gauss_quadrature<emsr::ChebyshevTRecurrence<double>>(20);
+  const auto u20 = emsr::gauss_quadrature<emsr::ChebyshevURecurrence<double>>(20);
+  const auto pi = 3.14159265358979323846;
+  const auto t20gw = emsr::golub_welsch(20, emsr::ChebyshevTRecurrence<double>{}, pi);
+  const auto u20gw = emsr::golub_welsch(20, emsr::ChebyshevURecurrence<double>{},
+					pi / 2);
+  double err_t = 0.0, err_u = 0.0;
+  for (unsigned i = 0; i < 20; ++i)
+    {
+      err_t = std::max({err_t, std::abs(t20.nodes[i] - t20gw.nodes[i]),
+			std::abs(t20.weights[i] - t20gw.weights[i])});
+      err_u = std::max({err_u, std::abs(u20.nodes[i] - u20gw.nodes[i]),
+			std::abs(u20.weights[i] - u20gw.weights[i])});
+    }
+  check("Gauss-Chebyshev T", err_t, 1.0e-14);
+  check("Gauss-Chebyshev U", err_u, 1.0e-14);
+
+  // The node march against Golub-Welsch.
+  const double tol = 1.0e-12;
+  if (compare("Legendre 150", 150, emsr::LegendreRecurrence<double>{}) > tol)
+    ++num_errors;
+  if (compare("Jacobi(1.5,-0.25) 150", 150,
+	      emsr::JacobiRecurrence<double>{1.5, -0.25}) > tol)
+    ++num_errors;
+  if (compare("Hermite 150", 150, emsr::HermiteRecurrence<double>{}) > tol)
+    ++num_errors;
+  if (compare("Laguerre(0.5) 150", 150,
+	      emsr::LaguerreRecurrence<double>{0.5}) > tol)
+    ++num_errors;
+
+  // A large rule.
+  const auto start = std::chrono::steady_clock::now();
+  const auto big = emsr::gauss_rule<emsr::LegendreRecurrence<double>>(100000);
+  const auto stop = std::chrono::steady_clock::now();
+  std::cerr << "100000 point Gauss-Legendre: "
+	    << std::chrono::duration<double>(stop - start).count() << " s\n";
+  check("Gauss-Legendre 100000 x^2",
+	big->integrate([](double x){ return x * x; }) - 2.0 / 3.0, 1.0e-13);
+  check("Gauss-Legendre 100000 cos",
+	big->integrate([](double x){ return std::cos(x); }) - 2.0 * std::sin(1.0),
+	1.0e-13);
+  const auto big2 = emsr::gauss_rule<emsr::LegendreRecurrence<double>>(100000);
+  if (big2 != big)
+    ++num_errors;
+
+  const auto herm = emsr::gauss_rule<emsr::HermiteRecurrence<double>>(20000);
+  check("Gauss-Hermite 20000 x^2",
+	herm->integrate([](double x){ return x * x; }) - std::sqrt(pi) / 2,
+	1.0e-12);
+  const auto lag = emsr::gauss_rule(20000, emsr::LaguerreRecurrence<double>{0.5});
+  check("Gauss-Laguerre(0.5) 20000 x",
+	lag->integrate([](double x){ return x; }) - 1.5 * std::tgamma(1.5),
+	1.0e-11);
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
@@ -0,0 +1,116 @@
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+
+#include <emsr/multi_polynomial.h>
+
+#include "test_check.h"
+
+int
+main()
+{
+  int num_errors = 0;
+  std::cout << std::setprecision(std::numeric_limits<double>::digits10);
+
+  const ErrorCheck check(num_errors);
+
+  using MP = emsr::MultiPolynomial<double, 3>;
+  const auto x = MP::variable(0);
+  const auto y = MP::variable(1);
+  const auto z = MP::variable(2);
+
+  // Packing and graded lexicographic order.
+  const MP::exponents_type e{3, 0, 2};
+  if (MP::unpack(MP::pack(e)) != e || MP::total_degree(MP::pack(e)) != 5)
+    ++num_errors;
+  if (!(MP::pack({0, 0, 2}) < MP::pack({0, 1, 1})
+	&& MP::pack({0, 1, 1}) < MP::pack({1, 1, 0})
+	&& MP::pack({2, 0, 0}) < MP::pack({0, 0, 3})))
+    ++num_errors;
+
+  // Terms are sorted and combined.
+  const MP P{{{1, 0, 0}, 2.0}, {{0, 0, 0}, 1.0}, {{1, 0, 0}, -2.0},
+	     {{0, 2, 1}, 3.0}};
+  std::cout << "P = " << P << '\n';
+  if (P.num_terms() != 2 || P.degree() != 3
+      || P.coefficient({0, 2, 1}) != 3.0 || P.coefficient({1, 0, 0}) != 0.0)
+    ++num_errors;
+
+  // (1 + x + y + z)^5 squared has binom(13, 3) terms.
+  auto f = MP(1.0) + x + y + z;
+  auto f5 = f;
+  for (int k = 1; k < 5; ++k)
+    f5 *= f;
+  const auto g = f5 * (f5 + MP(1.0));
+  if (f5.num_terms() != 56 || g.num_terms() != 286 || g.degree() != 10)
+    ++num_errors;
+  check("coefficient of x^10", g.coefficient({10, 0, 0}) - 1.0, 0.0);
+  check("coefficient of xyz", g.coefficient({1, 1, 1}) - 780.0, 0.0);
+
+  // Batched evaluation agrees with scalar evaluation and the factors.
+  std::vector<MP::point_type> pts;
+  for (int i = 0; i < 21; ++i)
+    pts.push_back({0.1 * i - 1.0, 0.05 * i, 0.3 - 0.02 * i});
+  std::vector<double> vals(pts.size());
+  g(pts.begin(), pts.end(), vals.begin());
+  auto err = 0.0;
+  for (std::size_t i = 0; i < pts.size(); ++i)
+    {
+      const auto s = 1.0 + pts[i][0] + pts[i][1] + pts[i][2];
+      const auto s5 = std::pow(s, 5);
+      // The size of the terms bounds the rounding error.
+      const auto a5 = std::pow(1.0 + std::abs(pts[i][0]) + std::abs(pts[i][1])
+				 + std::abs(pts[i][2]), 5);
+      err = std::max(err, std::abs(vals[i] - s5 * (s5 + 1.0))
+			  / (a5 * (a5 + 1.0)));
+      if (vals[i] != g(pts[i]))
+	++num_errors;
+    }
+  check("batched evaluation", err, 1.0e-12);
+
+  // Partial derivatives.
+  const auto dg = g.derivative(1);
+  err = 0.0;
+  for (const auto& p : pts)
+    {
+      const auto s = 1.0 + p[0] + p[1] + p[2];
+      const auto a = 1.0 + std::abs(p[0]) + std::abs(p[1]) + std::abs(p[2]);
+      err = std::max(err, std::abs(dg(p) - (10.0 * std::pow(s, 9)
+					    + 5.0 * std::pow(s, 4)))
+			  / (10.0 * std::pow(a, 9) + 5.0 * std::pow(a, 4)));
+    }
+  check("derivative", err, 1.0e-11);
+  if ((x * y * y).derivative(2).num_terms() != 0)
+    ++num_errors;
+
+  // Cancellation.
+  if (((x + y) * (x - y)) != x * x - y * y)
+    ++num_errors;
+
+  // Overflow of the degree field.
+  try
+    {
+      auto h = MP(1.0, {MP::s_max_degree, 0, 0});
+      h *= x;
+      ++num_errors;
+    }
+  catch (const std::overflow_error&)
+    { }
+
+  // Six variables.
+  using MP6 = emsr::MultiPolynomial<double, 6>;
+  auto q = MP6(1.0);
+  for (std::size_t k = 0; k < 6; ++k)
+    q += MP6::variable(k);
+  const auto q4 = q * q * q * q;
+  if (q4.num_terms() != 210)
+    ++num_errors;
+  check("q4(1,...,1)", q4({1.0, 1.0, 1.0, 1.0, 1.0, 1.0}) - 2401.0, 0.0);
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
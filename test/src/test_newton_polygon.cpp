@@ -0,0 +1,93 @@
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <complex>
+#include <cmath>
+
+#include <emsr/polynomial.h>
+#include <emsr/newton_polygon.h>
+#include <emsr/solver_laguerre.h>
+
+int
+main()
+{
+  using Cmplx = std::complex<double>;
+
+  int num_errors = 0;
+  std::cout << std::setprecision(std::numeric_limits<double>::digits10);
+
+  // Zeros of widely different size: 1e-3, 1, 1e3.
+  emsr::Polynomial<double> P({1.0});
+  for (double r : {1.0e-3, 1.0, 1.0e3})
+    P *= emsr::Polynomial<double>({-r, 1.0});
+  std::cout << "P = " << P << '\n';
+
+  const auto hull = emsr::newton_polygon(P);
+  std::cout << "hull:";
+  for (auto k : hull)
+    std::cout << ' ' << k;
+  std::cout << '\n';
+  if (hull.size() != 4)
+    ++num_errors;
+
+  const auto radii = emsr::newton_polygon_radii(P);
+  const double expect[3]{1.0e-3, 1.0, 1.0e3};
+  for (std::size_t i = 0; i < radii.size(); ++i)
+    {
+      std::cout << "radius = " << radii[i].first
+		<< " count = " << radii[i].second << '\n';
+      if (radii[i].second != 1
+	  || std::abs(std::log10(radii[i].first / expect[i])) > 0.01)
+	++num_errors;
+    }
+  if (radii.size() != 3)
+    ++num_errors;
+
+  // The Cauchy bound is below the smallest modulus.
+  const std::vector<double> moduli{1.0, std::abs(P[2]), std::abs(P[1]),
+				   std::abs(P[0])};
+  const auto lb = emsr::cauchy_lower_bound(moduli);
+  std::cout << "Cauchy lower bound = " << lb << '\n';
+  if (!(lb <= 1.0e-3) || lb < 0.5e-3)
+    ++num_errors;
+
+  // Zeros at the origin.
+  emsr::Polynomial<double> Q({0.0, 0.0, -2.0, 1.0});
+  const auto qradii = emsr::newton_polygon_radii(Q);
+  if (qradii.size() != 2 || qradii[0].first != 0.0 || qradii[0].second != 2
+      || std::abs(qradii[1].first - 2.0) > 1.0e-14 || qradii[1].second != 1)
+    ++num_errors;
+  const auto qstart = emsr::initial_approximations(Q);
+  if (qstart.size() != 3 || qstart[0] != Cmplx{} || qstart[1] != Cmplx{})
+    ++num_errors;
+
+  // Starting points lie on the circles.
+  const auto start = emsr::initial_approximations(P);
+  for (std::size_t i = 0; i < start.size(); ++i)
+    {
+      std::cout << "start = " << start[i] << '\n';
+      if (std::abs(std::abs(start[i]) - radii[i].first)
+	  > 1.0e-12 * radii[i].first)
+	++num_errors;
+    }
+
+  // Laguerre from the Newton polygon.
+  emsr::Polynomial<Cmplx> CP(P.begin(), P.end());
+  emsr::LaguerreSolver<double> lag(CP);
+  lag.newton_polygon_start(true);
+  const auto zeros = lag.solve();
+  for (const auto& z : zeros)
+    {
+      std::cout << "zero = " << z << '\n';
+      auto err = std::numeric_limits<double>::infinity();
+      for (double r : expect)
+	err = std::min(err, std::abs(z - r) / r);
+      if (err > 1.0e-12)
+	++num_errors;
+    }
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
@@ -0,0 +1,101 @@
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+
+#include <emsr/polynomial.h>
+#include <emsr/orthogonal_polynomial.h>
+
+#include "test_check.h"
+
+int
+main()
+{
+  int num_errors = 0;
+  std::cout << std::setprecision(std::numeric_limits<double>::digits10);
+
+  const ErrorCheck check(num_errors);
+  const double tol = 1.0e-12;
+
+  // Legendre.
+  const emsr::LegendrePolynomial<double> P2(2);
+  check("P_2(0.3)", P2(0.3) - (3 * 0.3 * 0.3 - 1) / 2, tol);
+  const emsr::LegendrePolynomial<double> P20(20);
+  check("P_20(1)", P20(1.0) - 1.0, tol);
+  check("P_20(-1)", P20(-1.0) - 1.0, tol);
+
+  // Chebyshev.
+  const emsr::ChebyshevTPolynomial<double> T15(15);
+  const emsr::ChebyshevUPolynomial<double> U15(15);
+  double err_t = 0.0, err_u = 0.0;
+  for (double theta = 0.1; theta < 3.0; theta += 0.2)
+    {
+      const auto x = std::cos(theta);
+      err_t = std::max(err_t, std::abs(T15(x) - std::cos(15 * theta)));
+      err_u = std::max(err_u, std::abs(U15(x) * std::sin(theta)
+				       - std::sin(16 * theta)));
+    }
+  check("T_15(cos t) - cos(15t)", err_t, tol);
+  check("U_15(cos t) sin(t) - sin(16t)", err_u, tol);
+
+  // Hermite.
+  const emsr::HermitePolynomial<double> H3(3);
+  check("H_3(1.5)", H3(1.5) - (8 * 1.5 * 1.5 * 1.5 - 12 * 1.5), tol);
+
+  // Laguerre.
+  const double alpha = 0.5;
+  const emsr::LaguerrePolynomial<double> L2(2, {alpha});
+  const double x = 1.25;
+  check("L_2^(1/2)(1.25)",
+	L2(x) - (x * x / 2 - (alpha + 2) * x
+		 + (alpha + 2) * (alpha + 1) / 2), tol);
+
+  // Jacobi.
+  const emsr::JacobiPolynomial<double> J7(7, {0.0, 0.0});
+  const emsr::LegendrePolynomial<double> P7(7);
+  double err_j = 0.0;
+  for (double y = -1.0; y <= 1.0; y += 0.125)
+    err_j = std::max(err_j, std::abs(J7(y) - P7(y)));
+  check("P_7^(0,0) - P_7", err_j, tol);
+  const emsr::JacobiPolynomial<double> J5(5, {1.5, -0.25});
+  // P_5^(a,b)(1) = binom(5 + a, 5).
+  double binom = 1.0;
+  for (int k = 1; k <= 5; ++k)
+    binom *= (k + 1.5) / k;
+  check("P_5^(1.5,-0.25)(1)", J5(1.0) - binom, tol * binom);
+
+  // The recurrence against the monomial expansion.
+  const auto J5poly = J5.polynomial();
+  std::cout << "P_5^(1.5,-0.25) = " << J5poly << '\n';
+  check("P_5^(1.5,-0.25)(0.4) expanded", J5(0.4) - J5poly(0.4), tol);
+  const auto [val, der] = J5.value_and_derivative(0.4);
+  check("value", val - J5(0.4), tol);
+  check("derivative", der - J5poly.derivative()(0.4), tol);
+
+  // Batch evaluation against scalar evaluation.
+  std::vector<double> xs;
+  for (int i = 0; i < 21; ++i)
+    xs.push_back(-1.0 + 0.1 * i);
+  std::vector<double> rs(xs.size());
+  const auto last = P20(xs.begin(), xs.end(), rs.begin());
+  if (last != rs.end())
+    ++num_errors;
+  double err_batch = 0.0;
+  for (std::size_t i = 0; i < xs.size(); ++i)
+    err_batch = std::max(err_batch, std::abs(rs[i] - P20(xs[i])));
+  check("batch", err_batch, 0.0);
+
+  // All degrees at one point.
+  std::vector<double> all(21);
+  P20.all(0.3, all.begin());
+  double err_all = 0.0;
+  for (unsigned k = 0; k <= 20; ++k)
+    err_all = std::max(err_all,
+		       std::abs(all[k] - emsr::LegendrePolynomial<double>(k)(0.3)));
+  check("all", err_all, 0.0);
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
@@ -0,0 +1,144 @@
+
+#include <iostream>
+#include <cmath>
+#include <vector>
+
+#include <emsr/partial_fraction.h>
+
+int
+main()
+{
+  int num_errors = 0;
+
+  // 1/((s + 1)^2 (s + 2)) = 1/(s + 2) - 1/(s + 1) + 1/(s + 1)^2
+  // with impulse response exp(-2t) - exp(-t) + t exp(-t).
+  emsr::Polynomial<double> one(1.0);
+  auto den1 = emsr::Polynomial<double>({1.0, 1.0})
+	    * emsr::Polynomial<double>({1.0, 1.0})
+	    * emsr::Polynomial<double>({2.0, 1.0});
+  emsr::RationalPolynomial<double> R1(one, den1);
+  const auto pf1 = emsr::partial_fractions(R1);
+  for (const auto& term : pf1.terms)
+    {
+      std::cout << "pole " << term.pole << ":";
+      for (const auto& r : term.residue)
+	std::cout << ' ' << r;
+      std::cout << '\n';
+      if (std::abs(term.pole + 2.0) < 1.0e-6)
+	{
+	  if (term.multiplicity() != 1
+	   || std::abs(term.residue[0] - 1.0) > 1.0e-6)
+	    ++num_errors;
+	}
+      else if (std::abs(term.pole + 1.0) < 1.0e-6)
+	{
+	  if (term.multiplicity() != 2
+	   || std::abs(term.residue[0] + 1.0) > 1.0e-6
+	   || std::abs(term.residue[1] - 1.0) > 1.0e-6)
+	    ++num_errors;
+	}
+      else
+	++num_errors;
+    }
+  if (pf1.terms.size() != 2)
+    ++num_errors;
+  const std::complex<double> s(0.3, 0.7);
+  if (std::abs(pf1(s) - R1.numer()(s) / R1.denom()(s)) > 1.0e-6)
+    ++num_errors;
+
+  const auto h1 = [](double t)
+		  { return std::exp(-2 * t) - std::exp(-t) + t * std::exp(-t); };
+  emsr::ImpulseResponse<double> ir1(pf1);
+  std::vector<double> ts, hs(100), hg(100);
+  for (int i = 0; i < 100; ++i)
+    ts.push_back(0.05 * i);
+  ir1(ts.begin(), ts.end(), hs.begin());
+  ir1.grid(0.0, 0.05, 100, hg.begin());
+  for (int i = 0; i < 100; ++i)
+    if (std::abs(hs[i] - h1(ts[i])) > 1.0e-6
+     || std::abs(hg[i] - h1(ts[i])) > 1.0e-6
+     || std::abs(ir1(ts[i]) - h1(ts[i])) > 1.0e-6)
+      {
+	std::cout << "h(" << ts[i] << ") = " << hs[i] << ' ' << hg[i]
+		  << " != " << h1(ts[i]) << '\n';
+	++num_errors;
+      }
+
+  // 1/(s^2 + 2s + 5) has impulse response exp(-t) sin(2t) / 2.
+  emsr::RationalPolynomial<double> R2(one,
+				      emsr::Polynomial<double>({5.0, 2.0, 1.0}));
+  const auto pf2 = emsr::partial_fractions(R2);
+  emsr::ImpulseResponse<double> ir2(pf2);
+  std::cout << "terms summed: " << ir2.num_terms() << '\n';
+  if (pf2.terms.size() != 2 || ir2.num_terms() != 1)
+    ++num_errors;
+  const std::size_t num = 2000;
+  std::vector<double> hg2(num);
+  ir2.grid(0.0, 0.01, num, hg2.begin());
+  for (std::size_t i = 0; i < num; ++i)
+    {
+      const auto t = 0.01 * i;
+      const auto h = std::exp(-t) * std::sin(2 * t) / 2;
+      if (std::abs(hg2[i] - h) > 1.0e-12)
+	{
+	  std::cout << "h(" << t << ") = " << hg2[i] << " != " << h << '\n';
+	  ++num_errors;
+	  break;
+	}
+    }
+  if (ir2(-1.0) != 0.0)
+    ++num_errors;
+
+  // Poles of higher multiplicity: 1/((s + 1)^m (s + 2)) has impulse response
+  // (-1)^m exp(-2t) + exp(-t) sum_{k=1}^m (-1)^(m-k) t^(k-1)/(k-1)!.
+  for (int m : {4, 5, 6})
+    {
+      auto den = emsr::Polynomial<double>({2.0, 1.0});
+      for (int k = 0; k < m; ++k)
+	den *= emsr::Polynomial<double>({1.0, 1.0});
+      const emsr::RationalPolynomial<double> Rm(one, den);
+      const auto pfm = emsr::partial_fractions(Rm);
+      std::cout << "multiplicity " << m << ":";
+      for (const auto& term : pfm.terms)
+	std::cout << "  pole " << term.pole << " x " << term.multiplicity();
+      std::cout << '\n';
+      if (pfm.terms.size() != 2)
+	++num_errors;
+      for (const auto& term : pfm.terms)
+	if (term.multiplicity()
+	    != std::size_t(std::abs(term.pole + 1.0) < 1.0e-3 ? m : 1))
+	  ++num_errors;
+      const auto hm = [m](double t)
+	{
+	  auto sum = (m % 2 == 0 ? 1.0 : -1.0) * std::exp(-2 * t);
+	  auto term = 1.0;
+	  for (int k = 1; k <= m; ++k)
+	    {
+	      sum += ((m - k) % 2 == 0 ? 1.0 : -1.0) * term * std::exp(-t);
+	      term *= t / k;
+	    }
+	  return sum;
+	};
+      emsr::ImpulseResponse<double> irm(pfm);
+      for (double t : {0.5, 1.0, 2.0, 5.0})
+	if (std::abs(irm(t) - hm(t)) > 1.0e-8)
+	  {
+	    std::cout << "h(" << t << ") = " << irm(t) << " != " << hm(t) << '\n';
+	    ++num_errors;
+	  }
+      if (std::abs(pfm(s) - Rm.numer()(s) / Rm.denom()(s))
+	  > 1.0e-8 * std::abs(Rm.numer()(s) / Rm.denom()(s)))
+	++num_errors;
+    }
+
+  // An improper rational polynomial has a polynomial part.
+  emsr::RationalPolynomial<double> R3(emsr::Polynomial<double>({1.0, 0.0, 1.0}),
+				      emsr::Polynomial<double>({2.0, 1.0}));
+  const auto pf3 = emsr::partial_fractions(R3);
+  std::cout << "direct part: " << pf3.direct << '\n';
+  if (pf3.direct.degree() != 1 || pf3.terms.size() != 1
+   || std::abs(pf3.terms[0].residue[0] - 5.0) > 1.0e-12)
+    ++num_errors;
+
+  return num_errors;
+}
@@ -0,0 +1,100 @@
+
+#include <iostream>
+#include <vector>
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+
+#include <emsr/polynomial_corpus.h>
+
+int
+main()
+{
+  int num_errors = 0;
+
+  const std::string filename = "test_polynomial_corpus.bin";
+
+  // Polynomials of varying degree.
+  std::vector<emsr::Polynomial<double>> polys;
+  for (std::size_t n = 0; n < 50; ++n)
+    {
+      emsr::Polynomial<double> p(0.0, (7 * n) % 23);
+      for (std::size_t i = 0; i <= p.degree(); ++i)
+	p[i] = 1.0 / (1.0 + n + i);
+      polys.push_back(p);
+    }
+
+  {
+    emsr::PolynomialCorpusWriter<double> writer(filename);
+    for (const auto& p : polys)
+      writer.append(p);
+    if (writer.size() != polys.size())
+      ++num_errors;
+  }
+
+  {
+    emsr::PolynomialCorpus<double> corpus(filename);
+    std::cout << "count = " << corpus.size() << '\n';
+    if (corpus.size() != polys.size())
+      ++num_errors;
+    for (std::size_t k = 0; k < corpus.size(); ++k)
+      {
+	if (corpus.degree(k) != polys[k].degree())
+	  ++num_errors;
+	if (reinterpret_cast<std::uintptr_t>(corpus.data(k))
+	    % emsr::corpus_alignment != 0)
+	  ++num_errors;
+	for (std::size_t i = 0; i <= polys[k].degree(); ++i)
+	  if (corpus.data(k)[i] != polys[k][i])
+	    ++num_errors;
+	if (corpus.polynomial(k)(0.5) != polys[k](0.5))
+	  ++num_errors;
+      }
+    std::cout << "P_10 = " << corpus.polynomial(10) << '\n';
+
+    // Moving keeps the mapping.
+    const auto moved = std::move(corpus);
+    if (moved.size() != polys.size() || moved.data(3)[0] != polys[3][0])
+      ++num_errors;
+  }
+
+  // A corpus is opened with its own coefficient type only.
+  try
+    {
+      emsr::PolynomialCorpus<std::complex<double>> wrong(filename);
+      ++num_errors;
+    }
+  catch (const std::runtime_error& err)
+    {
+      std::cout << err.what() << '\n';
+    }
+
+  // Complex coefficients.
+  {
+    emsr::PolynomialCorpusWriter<std::complex<double>> writer(filename);
+    const std::complex<double> c[3]{{1.0, 2.0}, {3.0, -4.0}, {0.0, 1.0}};
+    writer.append(c, 3);
+    writer.close();
+    const emsr::PolynomialCorpus<std::complex<double>> corpus(filename);
+    if (corpus.size() != 1 || corpus.degree(0) != 2
+	|| corpus.data(0)[1] != c[1])
+      ++num_errors;
+  }
+
+  // Missing and truncated files.
+  std::remove(filename.c_str());
+  try
+    {
+      emsr::PolynomialCorpus<double> missing(filename);
+      ++num_errors;
+    }
+  catch (const std::runtime_error& err)
+    {
+      std::cout << err.what() << '\n';
+    }
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
@@ -0,0 +1,152 @@
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <complex>
+#include <chrono>
+
+#include <emsr/polynomial_format.h>
+#include <emsr/polynomial_parser.h>
+
+int
+main()
+{
+  int num_errors = 0;
+
+  using Cmplx = std::complex<double>;
+
+  const auto expect = [&num_errors](const std::string& got, const char* want)
+    {
+      std::cout << got << (got == want ? "" : "  <- wrong") << '\n';
+      if (got != want)
+	++num_errors;
+    };
+
+  // The layouts.
+  {
+    const emsr::Polynomial<double> P({1.0, -2.0, 0.0, 0.5, -1.0});
+    std::string str;
+    emsr::format_polynomial(str, P);
+    expect(str, "(1,-2,0,0.5,-1)");
+    str.clear();
+    emsr::format_polynomial(str, P, emsr::PolynomialLayout::algebraic);
+    expect(str, "-x^4 + 0.5 x^3 - 2 x + 1");
+    str.clear();
+    emsr::format_polynomial(str, P, emsr::PolynomialLayout::csv);
+    expect(str, "1,-2,0,0.5,-1\n");
+    str.clear();
+    emsr::format_polynomial(str, emsr::Polynomial<double>({0.0, 1.0}),
+			    emsr::PolynomialLayout::algebraic, 'z');
+    expect(str, "z");
+    str.clear();
+    emsr::format_polynomial(str, emsr::Polynomial<double>({0.0, 0.0}),
+			    emsr::PolynomialLayout::algebraic);
+    expect(str, "0");
+
+    constexpr emsr::StaticPolynomial<double, 3> S{0.25, 0.0, 3.0};
+    str.clear();
+    emsr::format_polynomial(str, S, emsr::PolynomialLayout::algebraic);
+    expect(str, "3 x^2 + 0.25");
+
+    const emsr::Polynomial<Cmplx> C({Cmplx(1.0, -2.0), Cmplx(0.0, 0.0),
+				     Cmplx(1.0, 0.0)});
+    str.clear();
+    emsr::format_polynomial(str, C);
+    expect(str, "((1,-2),(0,0),(1,0))");
+    str.clear();
+    emsr::format_polynomial(str, C, emsr::PolynomialLayout::algebraic);
+    expect(str, "x^2 + (1,-2)");
+    str.clear();
+    emsr::format_polynomial(str, C, emsr::PolynomialLayout::csv);
+    expect(str, "1,-2,0,0,1,0\n");
+  }
+
+  // A short buffer is reported and not overrun.
+  {
+    const emsr::Polynomial<double> P({0.1, 0.2, 0.3});
+    char buf[16];
+    buf[8] = '#';
+    const auto [ptr, ec] = emsr::format_polynomial(buf, buf + 8, P);
+    if (ec != std::errc::value_too_large || ptr != buf + 8 || buf[8] != '#')
+      ++num_errors;
+    const auto res = emsr::format_polynomial(buf, buf + 16, P);
+    if (res.ec != std::errc{} || std::string(buf, res.ptr) != "(0.1,0.2,0.3)")
+      ++num_errors;
+  }
+
+  // Shortest round trip through the parser.
+  std::mt19937 urng(42);
+  std::uniform_real_distribution<double> coef(-1.0e3, 1.0e3);
+  std::string text;
+  std::vector<std::vector<double>> polys;
+  for (int k = 0; k < 20000; ++k)
+    {
+      std::vector<double> c(6);
+      for (auto& x : c)
+	x = coef(urng) * std::pow(10.0, int(urng() % 40) - 20);
+      polys.push_back(c);
+    }
+  {
+    for (const auto& c : polys)
+      {
+	emsr::format_polynomial(text, emsr::PolynomialView<double>(c));
+	text += '\n';
+      }
+    emsr::PolynomialArena<double> arena;
+    emsr::parse_polynomials(text.data(), text.data() + text.size(), arena);
+    int num_bad = 0;
+    for (std::size_t i = 0; i < polys.size(); ++i)
+      for (std::size_t j = 0; j < polys[i].size(); ++j)
+	if (i >= arena.size() || arena.data(i)[j] != polys[i][j])
+	  ++num_bad;
+    std::cout << "round trip mismatches: " << num_bad << '\n';
+    if (num_bad != 0)
+      ++num_errors;
+
+    std::string ctext;
+    const emsr::Polynomial<Cmplx> C({Cmplx(0.1, 1.0 / 3.0),
+				     Cmplx(-1.0e-300, 6.02e23)});
+    emsr::format_polynomial(ctext, C);
+    emsr::PolynomialArena<Cmplx> carena;
+    emsr::parse_polynomials(ctext.data(), ctext.data() + ctext.size(),
+			    carena);
+    if (carena.size() != 1 || carena.data(0)[0] != C[0]
+	|| carena.data(0)[1] != C[1])
+      ++num_errors;
+  }
+
+  // Throughput compared with the stream inserter at round trip precision.
+  {
+    std::string out;
+    out.reserve(text.size());
+    const auto t0 = std::chrono::steady_clock::now();
+    for (const auto& c : polys)
+      {
+	emsr::format_polynomial(out, emsr::PolynomialView<double>(c));
+	out += '\n';
+      }
+    const auto t1 = std::chrono::steady_clock::now();
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (const auto& c : polys)
+      os << emsr::Polynomial<double>(c.begin(), c.end()) << '\n';
+    const auto t2 = std::chrono::steady_clock::now();
+    const auto mb = out.size() / 1.0e6;
+    std::cout << "to_chars:   "
+	      << mb / std::chrono::duration<double>(t1 - t0).count()
+	      << " MB/s\n";
+    std::cout << "operator<<: "
+	      << mb / std::chrono::duration<double>(t2 - t1).count()
+	      << " MB/s\n";
+    if (out != text)
+      ++num_errors;
+  }
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
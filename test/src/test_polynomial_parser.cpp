@@ -0,0 +1,151 @@
+
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <complex>
+#include <chrono>
+#include <stdexcept>
+
+#include <emsr/polynomial_parser.h>
+
+std::string
+read_file(const char* filename)
+{
+  std::ifstream in(filename);
+  return std::string(std::istreambuf_iterator<char>(in),
+		     std::istreambuf_iterator<char>());
+}
+
+int
+main()
+{
+  int num_errors = 0;
+
+  using Cmplx = std::complex<double>;
+
+  // The stream format.
+  {
+    const std::string text = " (1, -2.5e3 ,+3)\n4.25 (0.5)\t( 7 ,8) tail";
+    emsr::PolynomialArena<double> arena;
+    const auto stop = emsr::parse_polynomials(text.data(),
+					      text.data() + text.size(),
+					      arena);
+    std::cout << "parsed " << arena.size() << " polynomials\n";
+    if (arena.size() != 4 || std::string(stop) != "tail")
+      ++num_errors;
+    if (arena.size(0) != 3 || arena.data(0)[1] != -2500.0
+	|| arena.data(0)[2] != 3.0)
+      ++num_errors;
+    if (arena.size(1) != 1 || arena.data(1)[0] != 4.25)
+      ++num_errors;
+    if (arena.view(3)(2.0) != 23.0
+	|| arena.view(3, emsr::CoefficientOrder::descending)(2.0) != 22.0)
+      ++num_errors;
+
+    // Reuse keeps the storage.
+    arena.clear();
+    emsr::parse_polynomials(text.data(), text.data() + text.size(), arena);
+    if (arena.size() != 4)
+      ++num_errors;
+
+    // A syntax error inside a polynomial keeps the complete ones.
+    const std::string bad = "(1,2) (3,,4)";
+    arena.clear();
+    try
+      {
+	emsr::parse_polynomials(bad.data(), bad.data() + bad.size(), arena);
+	++num_errors;
+      }
+    catch (const std::domain_error& err)
+      {
+	std::cout << err.what() << '\n';
+	if (arena.size() != 1)
+	  ++num_errors;
+      }
+  }
+
+  // Complex coefficients.
+  {
+    const std::string text = "((1,2),3,(-4.5, 0))";
+    emsr::PolynomialArena<Cmplx> arena;
+    emsr::parse_polynomials(text.data(), text.data() + text.size(), arena);
+    if (arena.size() != 1 || arena.size(0) != 3
+	|| arena.data(0)[0] != Cmplx(1.0, 2.0)
+	|| arena.data(0)[1] != Cmplx(3.0, 0.0)
+	|| arena.data(0)[2] != Cmplx(-4.5, 0.0))
+      ++num_errors;
+  }
+
+  // The degree and coefficients format of the solver input files.
+  {
+    const auto text = read_file("test_bairstow.in");
+    emsr::PolynomialArena<double> arena;
+    emsr::parse_counted_polynomials(text.data(), text.data() + text.size(),
+				    arena);
+    std::cout << "test_bairstow.in: " << arena.size() << " polynomials\n";
+    if (arena.size() != 3 || arena.size(2) != 6 || arena.data(2)[5] != 2.0)
+      ++num_errors;
+
+    const auto ctext = read_file("complex_solver1.in");
+    emsr::PolynomialArena<Cmplx> carena;
+    emsr::parse_counted_polynomials(ctext.data(),
+				    ctext.data() + ctext.size(), carena);
+    std::cout << "complex_solver1.in: " << carena.size() << " polynomials\n";
+    if (carena.size() == 0 || carena.size(0) != 3
+	|| carena.data(0)[2] != Cmplx(-4.0, -7.0))
+      ++num_errors;
+
+    const std::string cut = "2 1.0 2.0";
+    try
+      {
+	emsr::parse_counted_polynomials(cut.data(), cut.data() + cut.size(),
+					arena);
+	++num_errors;
+      }
+    catch (const std::domain_error& err)
+      {
+	std::cout << err.what() << '\n';
+      }
+  }
+
+  // The stream extractor replaces the polynomial.
+  {
+    emsr::Polynomial<double> P({9.0, 9.0, 9.0, 9.0});
+    std::istringstream in("(1,2)");
+    in >> P;
+    if (P.degree() != 1 || P[0] != 1.0 || P[1] != 2.0)
+      ++num_errors;
+  }
+
+  // Throughput compared with the stream extractor.
+  {
+    std::string text;
+    for (int k = 0; k < 20000; ++k)
+      text += "(0.125,-3.5e-7,12345.678,1,-0.0001,2.718281828459045)\n";
+    emsr::PolynomialArena<double> arena;
+    const auto t0 = std::chrono::steady_clock::now();
+    emsr::parse_polynomials(text.data(), text.data() + text.size(), arena);
+    const auto t1 = std::chrono::steady_clock::now();
+    std::istringstream in(text);
+    emsr::Polynomial<double> P;
+    int count = 0;
+    while (in >> P)
+      ++count;
+    const auto t2 = std::chrono::steady_clock::now();
+    const auto mb = text.size() / 1.0e6;
+    std::cout << "from_chars: "
+	      << mb / std::chrono::duration<double>(t1 - t0).count()
+	      << " MB/s\n";
+    std::cout << "operator>>: "
+	      << mb / std::chrono::duration<double>(t2 - t1).count()
+	      << " MB/s\n";
+    if (arena.size() != 20000 || count != 20000)
+      ++num_errors;
+  }
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
@@ -0,0 +1,125 @@
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <complex>
+#include <algorithm>
+#include <cstdio>
+
+#include <emsr/polynomial_view.h>
+#include <emsr/polynomial_corpus.h>
+#include <emsr/solver_jenkins_traub.h>
+#include <emsr/solver_madsen_reid.h>
+#include <emsr/solver_bairstow.h>
+#include <emsr/solver_laguerre.h>
+
+int
+main()
+{
+  int num_errors = 0;
+
+  using Cmplx = std::complex<double>;
+  const auto tol = 1.0e-12;
+
+  // (x - 1)(x - 2)(x - 3) in both storage orders.
+  const double asc[4]{-6.0, 11.0, -6.0, 1.0};
+  const double desc[4]{1.0, -6.0, 11.0, -6.0};
+  const emsr::PolynomialView<double> pa(asc, 4);
+  const emsr::PolynomialView<double> pd(desc, 4,
+					emsr::CoefficientOrder::descending);
+
+  for (int i = 0; i < 4; ++i)
+    if (pa[i] != pd[i] || pa[i] != asc[i])
+      ++num_errors;
+  if (pa(0.5) != pd(0.5) || pa(4.0) != 6.0 || pd(Cmplx(0.0, 1.0)) != Cmplx(0.0, 10.0))
+    ++num_errors;
+  if (pd.derivative()(2.0) != -1.0 || pa.integral(1.0)(0.0) != 1.0
+      || pd.polynomial()(0.5) != -1.875)
+    ++num_errors;
+
+  // Views of owning containers.
+  const emsr::Polynomial<double> P(pa.polynomial());
+  const emsr::PolynomialView<double> pv(P);
+  if (pv.data() != P.data() || pv.degree() != 3)
+    ++num_errors;
+
+  const auto check_roots = [&num_errors, tol](const char* what,
+					       std::vector<double> re)
+    {
+      std::sort(re.begin(), re.end());
+      std::cout << what << ":" << std::setprecision(17);
+      for (auto r : re)
+	std::cout << ' ' << r;
+      std::cout << '\n';
+      if (re.size() != 3)
+	{
+	  ++num_errors;
+	  return;
+	}
+      for (int k = 0; k < 3; ++k)
+	if (std::abs(re[k] - (k + 1)) > tol)
+	  ++num_errors;
+    };
+
+  // Solvers take views in either order.
+  for (const auto& view : {pa, pd})
+    {
+      emsr::JenkinsTraubSolver<double> jt(view);
+      std::vector<double> re;
+      for (const auto& z : jt.solve())
+	re.push_back(emsr::real(z));
+      check_roots("Jenkins-Traub", re);
+
+      emsr::BairstowSolver<double> bs(view);
+      re.clear();
+      for (const auto& z : bs.solve())
+	re.push_back(emsr::real(z));
+      check_roots("Bairstow", re);
+    }
+
+  const std::vector<Cmplx> cdesc(desc, desc + 4);
+  const emsr::PolynomialView<Cmplx> cview(cdesc,
+					  emsr::CoefficientOrder::descending);
+  {
+    emsr::JenkinsTraubSolver<Cmplx> jt(cview);
+    std::vector<double> re;
+    for (const auto& z : jt.solve())
+      re.push_back(std::real(z));
+    check_roots("complex Jenkins-Traub", re);
+
+    SolverMadsenReid<double> mr(cview);
+    re.clear();
+    for (const auto& z : mr.solve())
+      re.push_back(std::real(z));
+    check_roots("Madsen-Reid", re);
+
+    emsr::LaguerreSolver<double> lag(cview);
+    re.clear();
+    for (const auto& z : lag.solve())
+      re.push_back(std::real(z));
+    check_roots("Laguerre", re);
+  }
+
+  // Views into a mapped corpus.
+  const std::string filename = "test_polynomial_view.bin";
+  {
+    emsr::PolynomialCorpusWriter<double> writer(filename);
+    writer.append(P);
+  }
+  {
+    const emsr::PolynomialCorpus<double> corpus(filename);
+    const auto view = corpus.view(0);
+    if (view.data() != corpus.data(0))
+      ++num_errors;
+    emsr::JenkinsTraubSolver<double> jt(view);
+    std::vector<double> re;
+    for (const auto& z : jt.solve())
+      re.push_back(emsr::real(z));
+    check_roots("corpus", re);
+  }
+  std::remove(filename.c_str());
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
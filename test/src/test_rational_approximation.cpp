@@ -0,0 +1,139 @@
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <vector>
+
+#include <emsr/rational_approximation.h>
+
+int
+main()
+{
+  int num_errors = 0;
+
+  // The Levinson recursion agrees with LU decomposition
+  // on a nonsymmetric Toeplitz system.
+  const std::vector<double> r{0.3, -1.1, 0.7, 4.0, 0.5, -0.2, 0.9};
+  const std::vector<double> y{1.0, -2.0, 3.0, 0.5};
+  const std::size_t n = y.size();
+  std::vector<double> xt, xl;
+  std::vector<double> mat(n * n), rhs(y);
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t j = 0; j < n; ++j)
+      mat[i * n + j] = r[n - 1 + i - j];
+  emsr::toeplitz_solve(r, y, xt);
+  emsr::lu_solve(mat, rhs, xl);
+  for (std::size_t i = 0; i < n; ++i)
+    {
+      std::cout << "x[" << i << "] = " << xt[i] << "  " << xl[i] << '\n';
+      if (std::abs(xt[i] - xl[i]) > 1.0e-12)
+	++num_errors;
+    }
+
+  // The [3/3] Padé approximant of exp(x).
+  std::vector<double> ec(7);
+  ec[0] = 1.0;
+  for (std::size_t k = 1; k < ec.size(); ++k)
+    ec[k] = ec[k - 1] / k;
+  const auto pexp = emsr::pade(emsr::Polynomial<double>(ec.begin(), ec.end()),
+			       3, 3);
+  std::cout << "pade[3/3](exp) = " << pexp << '\n';
+  const double pnum[4]{1.0, 0.5, 0.1, 1.0 / 120.0};
+  for (int k = 0; k <= 3; ++k)
+    if (std::abs(pexp.numer()[k] - pnum[k]) > 1.0e-14
+     || std::abs(pexp.denom()[k] - (k % 2 ? -pnum[k] : pnum[k])) > 1.0e-14)
+      ++num_errors;
+
+  // The [1/2] approximant of cos(x) has a zero leading minor
+  // so the Levinson recursion breaks down and LU decomposition is used.
+  const auto pcos = emsr::pade(emsr::Polynomial<double>({1.0, 0.0, -0.5, 0.0,
+							 1.0 / 24.0}), 1, 2);
+  std::cout << "pade[1/2](cos) = " << pcos << '\n';
+  if (std::abs(pcos.denom()[2] - 0.5) > 1.0e-15
+   || std::abs(pcos.numer()[0] - 1.0) > 1.0e-15)
+    ++num_errors;
+
+  // A degree 50 Padé approximant.
+  std::vector<double> ec50(51);
+  ec50[0] = 1.0;
+  for (std::size_t k = 1; k < ec50.size(); ++k)
+    ec50[k] = ec50[k - 1] / k;
+  const auto pexp50 = emsr::pade(emsr::Polynomial<double>(ec50.begin(),
+							  ec50.end()), 25, 25);
+  std::cout << "pade[25/25](exp)(1) - e = " << pexp50(1.0) - std::exp(1.0) << '\n';
+  if (std::abs(pexp50(1.0) - std::exp(1.0)) > 1.0e-13)
+    ++num_errors;
+
+  // The minimax [2/2] approximation to exp(x) on [0, 1].
+  const auto mexp = emsr::minimax([](double x){ return std::exp(x); },
+				  0.0, 1.0, 2, 2);
+  std::cout << "minimax[2/2](exp) = " << mexp.approx << '\n';
+  std::cout << "  max error = " << mexp.max_error
+	    << "  iterations = " << mexp.num_iters
+	    << "  converged = " << mexp.converged << '\n';
+  if (!mexp.converged)
+    ++num_errors;
+  auto max_err = 0.0;
+  for (int i = 0; i <= 1000; ++i)
+    {
+      const auto x = 0.001 * i;
+      max_err = std::max(max_err, std::abs(std::exp(x) - mexp.approx(x)));
+    }
+  std::cout << "  sampled error = " << max_err << '\n';
+  if (max_err > 1.0001 * mexp.max_error || max_err > 1.0e-5)
+    ++num_errors;
+
+  // The minimax [4/0] polynomial approximation to exp(x) on [-1, 1].
+  const auto mpoly = emsr::minimax([](double x){ return std::exp(x); },
+				   -1.0, 1.0, 4, 0);
+  std::cout << "minimax[4/0](exp) = " << mpoly.approx << '\n';
+  std::cout << "  max error = " << mpoly.max_error << '\n';
+  if (!mpoly.converged || mpoly.max_error > 6.0e-4)
+    ++num_errors;
+
+  // Higher degrees and the denominator degree are handled
+  // in the Chebyshev basis.
+  const auto check = [&num_errors](const char* name, auto func,
+				   double a, double b, unsigned m, unsigned n,
+				   double max_allowed)
+    {
+      const auto mm = emsr::minimax(func, a, b, m, n);
+      auto sampled = 0.0;
+      for (int i = 0; i <= 10000; ++i)
+	{
+	  const auto x = a + (b - a) * i / 10000.0;
+	  sampled = std::max(sampled, std::abs(func(x) - mm.approx(x)));
+	}
+      std::cout << "minimax[" << m << '/' << n << "](" << name << ")"
+		<< "  max error = " << mm.max_error
+		<< "  sampled error = " << sampled
+		<< "  iterations = " << mm.num_iters
+		<< "  converged = " << mm.converged << '\n';
+      if (!mm.converged || mm.max_error > max_allowed
+       || sampled > 1.1 * mm.max_error)
+	++num_errors;
+    };
+  const auto atan = [](double x){ return std::atan(x); };
+  const auto log = [](double x){ return std::log(x); };
+  const auto exp = [](double x){ return std::exp(x); };
+  check("atan", atan, 0.0, 5.0, 2, 2, 1.1e-3);
+  check("atan", atan, 0.0, 5.0, 3, 3, 3.5e-5);
+  check("atan", atan, 0.0, 5.0, 6, 6, 1.2e-9);
+  check("log", log, 1.0, 10.0, 3, 3, 1.3e-5);
+  check("log", log, 1.0, 10.0, 4, 4, 2.5e-7);
+  check("log", log, 1.0, 10.0, 5, 5, 5.0e-9);
+  check("log", log, 1.0, 10.0, 6, 6, 1.0e-10);
+  check("exp", exp, -1.0, 1.0, 6, 6, 1.0e-14);
+  check("exp", exp, -1.0, 1.0, 8, 8, 1.0e-13);
+  check("atan", atan, 0.0, 5.0, 20, 0, 1.0e-7);
+  check("exp", exp, -1.0, 1.0, 20, 0, 1.0e-14);
+  check("exp", exp, -1.0, 1.0, 50, 0, 1.0e-13);
+
+  // Emit constexpr source.
+  emsr::write_static(std::cout, mexp.approx, "exp_0_1");
+  const auto [snum, sden] = emsr::to_static<3, 3>(mexp.approx);
+  if (std::abs(snum(0.5) / sden(0.5) - mexp.approx(0.5)) > 1.0e-15)
+    ++num_errors;
+
+  return num_errors;
+}
@@ -2,6 +2,8 @@
 #include <iostream>
 #include <complex>
 #include <sstream>
+#include <cmath>
+#include <vector>
 
 #include <emsr/rational_polynomial.h>
 
@@ -26,5 +28,102 @@ main()
   std::cout << "Q = " << R.denom() << '\n';
   std::cout << "degree(Q) = " << R.denom().degree() << '\n';
 
+  int num_errors = 0;
+
+  // (x - 1)(x + 2) / ((x - 1)(x + 3)) -> (x + 2) / (x + 3)
+  emsr::Polynomial<double> A({-2.0, 1.0, 1.0});
+  emsr::Polynomial<double> B({-3.0, 2.0, 1.0});
+  const auto G = emsr::gcd(A, B);
+  std::cout << "gcd(" << A << ", " << B << ") = " << G << '\n';
+  if (G.degree() != 1 || std::abs(G[0] + 1.0) > 1.0e-12)
+    ++num_errors;
+
+  emsr::RationalPolynomial<double> S(A, B);
+  S.normalize();
+  std::cout << "normalize(" << A << "/" << B << ") = " << S << '\n';
+  if (S.numer().degree() != 1 || S.denom().degree() != 1
+   || std::abs(S.numer()[0] - 2.0) > 1.0e-12
+   || std::abs(S.denom()[0] - 3.0) > 1.0e-12)
+    ++num_errors;
+
+  // Coprime polynomials are left alone.
+  emsr::RationalPolynomial<double> T(P, Q);
+  T.normalize();
+  std::cout << "normalize(" << P << "/" << Q << ") = " << T << '\n';
+  if (T.numer().degree() != P.degree() || T.denom().degree() != Q.degree())
+    ++num_errors;
+
+  // Summing fractions over a common denominator should not raise the degree.
+  emsr::RationalPolynomial<double> U(emsr::Polynomial<double>(1.0),
+				     emsr::Polynomial<double>({1.0, 1.0}));
+  emsr::RationalPolynomial<double> V(U);
+  V.auto_normalize(true);
+  for (int i = 0; i < 9; ++i)
+    V += U;
+  std::cout << "sum of 10 * 1/(x+1) = " << V << '\n';
+  if (V.denom().degree() != 1 || std::abs(V(2.0) - 10.0 / 3.0) > 1.0e-12)
+    ++num_errors;
+
+  // Products cancel across the fractions.
+  emsr::RationalPolynomial<double> W(A, emsr::Polynomial<double>({2.0, 1.0}));
+  W.auto_normalize(true);
+  W *= emsr::RationalPolynomial<double>(emsr::Polynomial<double>({2.0, 1.0}), B);
+  std::cout << "product = " << W << '\n';
+  if (W.numer().degree() != 1 || W.denom().degree() != 1
+   || std::abs(W(0.5) - 2.5 / 3.5) > 1.0e-12)
+    ++num_errors;
+
+  W /= S;
+  std::cout << "quotient = " << W << '\n';
+  if (W.numer().degree() != 0 || W.denom().degree() != 0
+   || std::abs(W(0.5) - 1.0) > 1.0e-12)
+    ++num_errors;
+
+  // Nearly common factors are only cancelled if they divide exactly.
+  emsr::RationalPolynomial<double> X(emsr::Polynomial<double>(1.0),
+				     emsr::Polynomial<double>({2.0, 3.0, 1.0}));
+  X.auto_normalize(true);
+  const emsr::RationalPolynomial<double>
+    Y(emsr::Polynomial<double>(1.0),
+      emsr::Polynomial<double>({1.0 + 1.0e-6, 1.0}));
+  X += Y;
+  const auto xy = 1.0 / 3.75 + 1.0 / (1.5 + 1.0e-6);
+  std::cout << "near common sum = " << X << '\n';
+  if (std::abs(X(0.5) - xy) > 1.0e-12)
+    ++num_errors;
+
+  // Operands may be the fraction itself.
+  emsr::RationalPolynomial<double> Z(A, emsr::Polynomial<double>({2.0, 1.0}));
+  Z.auto_normalize(true);
+  Z *= Z;
+  Z += Z;
+  std::cout << "2 Z^2 = " << Z << '\n';
+  if (std::abs(Z(0.5) - 2.0 * std::pow(A(0.5) / 2.5, 2)) > 1.0e-12)
+    ++num_errors;
+
+  // The fused evaluator agrees with separate numerator and denominator
+  // evaluation and the range evaluator agrees with the scalar one.
+  std::vector<double> xs, rs(61);
+  for (int i = -30; i <= 30; ++i)
+    xs.push_back(0.1 * i);
+  R(xs.begin(), xs.end(), rs.begin());
+  for (std::size_t i = 0; i < xs.size(); ++i)
+    {
+      const auto r = R.numer(xs[i]) / R.denom(xs[i]);
+      if (std::abs(rs[i] - r) > 1.0e-12 * std::max(1.0, std::abs(r))
+       || rs[i] != R(xs[i]))
+	{
+	  std::cout << "R(" << xs[i] << ") = " << rs[i] << " != " << r << '\n';
+	  ++num_errors;
+	}
+    }
+
+  // The numerator overflows here but the ratio does not.
+  const auto big = R(1.0e120);
+  std::cout << "R(1.0e120) = " << big << '\n';
+  if (!std::isfinite(big) || std::abs(big / 3.0e240 - 1.0) > 1.0e-12)
+    ++num_errors;
+
+  return num_errors;
 }
 
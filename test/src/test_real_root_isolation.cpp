@@ -0,0 +1,130 @@
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <random>
+
+#include <emsr/polynomial.h>
+#include <emsr/real_root_isolation.h>
+#include <emsr/sturm_sequence.h>
+
+int
+main()
+{
+  int num_errors = 0;
+  std::cout << std::setprecision(std::numeric_limits<double>::digits10);
+
+  const auto eps = std::numeric_limits<double>::epsilon();
+  const auto print = [](const std::vector<emsr::RootInterval<double>>& iv)
+    {
+      for (const auto& i : iv)
+	std::cout << "  [" << i.lower << ", " << i.upper << "] "
+		  << i.num_roots << '\n';
+    };
+
+  // P(x) = (x + 3)(x - 1/2)(x - 1)(x - 2)(x^2 + 1)
+  emsr::Polynomial<double> P({1.0});
+  for (double r : {-3.0, 0.5, 1.0, 2.0})
+    P *= emsr::Polynomial<double>({-r, 1.0});
+  P *= emsr::Polynomial<double>({1.0, 0.0, 1.0});
+  const auto ivP = emsr::isolate_real_roots(P);
+  std::cout << "P intervals:\n";
+  print(ivP);
+  if (ivP.size() != 4)
+    ++num_errors;
+  const std::vector<double> rP{-3.0, 0.5, 1.0, 2.0};
+  for (std::size_t k = 0; k < ivP.size() && k < rP.size(); ++k)
+    if (!ivP[k].isolated() || rP[k] < ivP[k].lower || rP[k] > ivP[k].upper)
+      ++num_errors;
+  const auto zP = emsr::real_roots(P);
+  for (std::size_t k = 0; k < zP.size() && k < rP.size(); ++k)
+    {
+      std::cout << "  root " << zP[k] << '\n';
+      if (std::abs(zP[k] - rP[k]) > 8 * eps * std::abs(rP[k]))
+	++num_errors;
+    }
+
+  // Zeros at the origin and a double zero.
+  // Q(x) = x^2 (x - 1)^2 (x - 3)
+  emsr::Polynomial<double> Q({0.0, 0.0, 1.0});
+  Q *= emsr::Polynomial<double>({1.0, -2.0, 1.0});
+  Q *= emsr::Polynomial<double>({-3.0, 1.0});
+  const auto ivQ = emsr::isolate_real_roots(Q);
+  std::cout << "Q intervals:\n";
+  print(ivQ);
+  if (ivQ.size() != 3
+      || ivQ[0].lower != 0.0 || ivQ[0].upper != 0.0 || ivQ[0].num_roots != 2
+      || ivQ[1].num_roots != 2 || ivQ[1].lower > 1.0 || ivQ[1].upper < 1.0
+      || !ivQ[2].isolated() || ivQ[2].lower > 3.0 || ivQ[2].upper < 3.0)
+    ++num_errors;
+
+  // High degree with few real zeros: (x^2 - 2)(x^998 + 1).
+  emsr::Polynomial<double> H({-2.0, 0.0, 1.0});
+  std::vector<double> c(999);
+  c.front() = 1.0;
+  c.back() = 1.0;
+  H *= emsr::Polynomial<double>(c.begin(), c.end());
+  const auto zH = emsr::real_roots(H);
+  std::cout << "H roots:\n";
+  for (const auto& z : zH)
+    std::cout << "  " << z << '\n';
+  if (zH.size() != 2
+      || std::abs(zH[0] + std::sqrt(2.0)) > 8 * eps
+      || std::abs(zH[1] - std::sqrt(2.0)) > 8 * eps)
+    ++num_errors;
+
+  // Close zeros.
+  emsr::Polynomial<double> C({1.0});
+  for (double r : {1.0, 1.0 + 0x1.0p-20, 1.0 + 0x1.0p-19})
+    C *= emsr::Polynomial<double>({-r, 1.0});
+  const auto ivC = emsr::isolate_real_roots(C);
+  std::cout << "C intervals:\n";
+  print(ivC);
+  if (ivC.size() != 3)
+    ++num_errors;
+  for (std::size_t k = 1; k < ivC.size(); ++k)
+    if (ivC[k].lower < ivC[k - 1].upper)
+      ++num_errors;
+
+  // Random high degree polynomials against the Sturm count.
+  // Every isolating interval must show a sign change.
+  std::mt19937 urng(42);
+  std::normal_distribution<double> gauss;
+  std::uniform_int_distribution<int> degree(50, 550);
+  int num_wrong = 0;
+  for (int trial = 0; trial < 40; ++trial)
+    {
+      const emsr::Polynomial<double> R([&](std::size_t)
+				       { return gauss(urng); },
+				       degree(urng));
+      const emsr::Polynomial<long double> Rl(R.begin(), R.end());
+      const auto sign = [&Rl](double x)
+	{
+	  const auto p = Rl(x);
+	  return (p > 0.0L) - (p < 0.0L);
+	};
+      int count = 0;
+      for (const auto& iv : emsr::isolate_real_roots(R))
+	{
+	  count += iv.num_roots;
+	  if (iv.isolated() && iv.lower < iv.upper
+	      && sign(iv.lower) * sign(iv.upper) >= 0)
+	    ++num_wrong;
+	}
+      const emsr::SturmSequence<long double> sturm(Rl);
+      if (count != sturm.num_roots())
+	++num_wrong;
+    }
+  std::cout << "random polynomials wrong = " << num_wrong << '\n';
+  if (num_wrong != 0)
+    ++num_errors;
+
+  // No real zeros.
+  if (!emsr::isolate_real_roots(emsr::Polynomial<double>({1.0, 0.0, 1.0})).empty())
+    ++num_errors;
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
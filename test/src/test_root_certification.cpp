@@ -0,0 +1,92 @@
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <complex>
+
+#include <emsr/polynomial.h>
+#include <emsr/root_certification.h>
+#include <emsr/solver_jenkins_traub.h>
+#include <emsr/solver_laguerre.h>
+
+int
+main()
+{
+  using Cmplx = std::complex<double>;
+
+  int num_errors = 0;
+  std::cout << std::setprecision(std::numeric_limits<double>::digits10);
+
+  // P(x) = (x + 3)(x - 1/2)(x - 1)(x - 2)(x^2 + 1)
+  emsr::Polynomial<double> P({1.0});
+  for (double r : {-3.0, 0.5, 1.0, 2.0})
+    P *= emsr::Polynomial<double>({-r, 1.0});
+  P *= emsr::Polynomial<double>({1.0, 0.0, 1.0});
+  const std::vector<Cmplx> exact{-3.0, 0.5, 1.0, 2.0, Cmplx(0.0, 1.0),
+				 Cmplx(0.0, -1.0)};
+
+  std::vector<double> coef(P.crbegin(), P.crend());
+  emsr::JenkinsTraubSolver<double> jt(coef);
+  const auto zeros = jt.solve();
+  emsr::RingBufferSink<> sink;
+  const auto cert = emsr::certify_roots(P, zeros, &sink);
+  for (const auto& c : cert)
+    {
+      std::cout << "root = " << c.root << " radius = " << c.radius
+		<< " certified = " << c.certified << '\n';
+      if (!c.certified)
+	++num_errors;
+      auto dist = std::numeric_limits<double>::infinity();
+      for (const auto& z : exact)
+	dist = std::min(dist, abs(c.root - z));
+      if (!(dist <= c.radius) || c.radius > 1.0e-12)
+	++num_errors;
+    }
+  if (cert.size() != 6 || sink.count(emsr::SolverEvent::uncertified) != 0)
+    ++num_errors;
+
+  // A triple zero cannot be certified in double precision.
+  // Q(x) = (x - 1)^3 (x + 2)
+  emsr::Polynomial<Cmplx> Q({Cmplx{1.0}});
+  for (int k = 0; k < 3; ++k)
+    Q *= emsr::Polynomial<Cmplx>({Cmplx{-1.0}, Cmplx{1.0}});
+  Q *= emsr::Polynomial<Cmplx>({Cmplx{2.0}, Cmplx{1.0}});
+  auto Qcopy = Q;
+  emsr::LaguerreSolver<double> lag(Qcopy);
+  const auto qzeros = lag.solve();
+  emsr::RingBufferSink<> qsink;
+  const auto qcert = emsr::certify_roots(Q, qzeros, &qsink);
+  int num_uncertified = 0;
+  for (const auto& c : qcert)
+    {
+      std::cout << "root = " << c.root << " radius = " << c.radius
+		<< " certified = " << c.certified << '\n';
+      if (!c.certified)
+	++num_uncertified;
+      else if (!(abs(c.root + 2.0) <= c.radius))
+	++num_errors;
+    }
+  std::cout << "uncertified = " << num_uncertified << '\n';
+  if (num_uncertified != 3
+      || qsink.count(emsr::SolverEvent::uncertified) != 3)
+    ++num_errors;
+  emsr::SolverDiagnostic diag;
+  while (qsink.pop(diag))
+    {
+      std::cout << diag << '\n';
+      if (diag.iteration != -1 || diag.index < 0
+	  || diag.index >= static_cast<int>(qcert.size())
+	  || qcert[diag.index].certified)
+	++num_errors;
+    }
+
+  // An incomplete set certifies nothing.
+  const auto part = emsr::certify_roots(P, std::vector<Cmplx>{1.0, 2.0});
+  for (const auto& c : part)
+    if (c.certified)
+      ++num_errors;
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
@@ -0,0 +1,114 @@
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <complex>
+
+#include <emsr/polynomial.h>
+#include <emsr/root_clusters.h>
+#include <emsr/solver_laguerre.h>
+
+int
+main()
+{
+  using Cmplx = std::complex<double>;
+
+  int num_errors = 0;
+  std::cout << std::setprecision(std::numeric_limits<double>::digits10);
+
+  // P(x) = (x - 1)^5 (x + 2)
+  emsr::Polynomial<double> P({1.0});
+  for (int k = 0; k < 5; ++k)
+    P *= emsr::Polynomial<double>({-1.0, 1.0});
+  P *= emsr::Polynomial<double>({2.0, 1.0});
+  std::cout << "P = " << P << '\n';
+
+  const auto m1 = emsr::estimate_multiplicity(P, Cmplx(1.01));
+  const auto m2 = emsr::estimate_multiplicity(P, Cmplx(-2.01));
+  std::cout << "multiplicity near 1: " << m1 << '\n';
+  std::cout << "multiplicity near -2: " << m2 << '\n';
+  if (m1 != 5 || m2 != 1)
+    ++num_errors;
+
+  const auto k1 = emsr::pellet_count(P, Cmplx(1.0, 0.01), 0.5);
+  const auto k2 = emsr::pellet_count(P, Cmplx(0.0), 5.0);
+  std::cout << "Pellet count near 1: " << k1 << '\n';
+  std::cout << "Pellet count all: " << k2 << '\n';
+  if (k1 != 5 || k2 != 6)
+    ++num_errors;
+
+  const auto z = emsr::refine_multiple_root(P, Cmplx(1.1, 0.05), 5);
+  std::cout << "refined multiple zero: " << z << '\n';
+  if (abs(z - 1.0) > 1.0e-12)
+    ++num_errors;
+
+  // Clusters from perturbed approximations.
+  std::vector<Cmplx> zeros;
+  for (int k = 0; k < 5; ++k)
+    zeros.push_back(1.0 + 1.0e-3 * std::polar(1.0, 1.2566 * k + 0.1));
+  zeros.push_back(Cmplx(-2.0 + 1.0e-14));
+  const auto clusters = emsr::find_root_clusters(P, zeros);
+  for (const auto& c : clusters)
+    std::cout << "cluster: center = " << c.center << " radius = " << c.radius
+	      << " multiplicity = " << c.multiplicity << '\n';
+  if (clusters.size() != 2)
+    ++num_errors;
+  for (const auto& c : clusters)
+    if (c.multiplicity == 5)
+      {
+	if (abs(c.center - 1.0) > c.radius || abs(c.center - 1.0) > 1.0e-10)
+	  ++num_errors;
+      }
+    else if (c.multiplicity != 1 || abs(c.center + 2.0) > c.radius)
+      ++num_errors;
+
+  // The Laguerre solver returns clusters.
+  emsr::Polynomial<Cmplx> CP(P.begin(), P.end());
+  emsr::LaguerreSolver<double> lag(CP);
+  const auto lclusters = lag.solve_clusters();
+  int total = 0;
+  for (const auto& c : lclusters)
+    {
+      std::cout << "Laguerre cluster: center = " << c.center
+		<< " radius = " << c.radius
+		<< " multiplicity = " << c.multiplicity << '\n';
+      total += c.multiplicity;
+      const auto d = std::min(abs(c.center - 1.0), abs(c.center + 2.0));
+      if (!(d <= c.radius))
+	++num_errors;
+    }
+  if (total != 6)
+    ++num_errors;
+
+  // A double zero next to simple zeros: (x - 1.5)^2 (x + 2) (x - 0.3 + 0.7i).
+  // The Taylor coefficients at the double zero are at the rounding level
+  // and must not split it into two simple clusters.
+  emsr::Polynomial<Cmplx> DP({Cmplx{1.0}});
+  DP *= emsr::Polynomial<Cmplx>({Cmplx{-1.5}, Cmplx{1.0}});
+  DP *= emsr::Polynomial<Cmplx>({Cmplx{-1.5}, Cmplx{1.0}});
+  DP *= emsr::Polynomial<Cmplx>({Cmplx{2.0}, Cmplx{1.0}});
+  DP *= emsr::Polynomial<Cmplx>({Cmplx{-0.3, 0.7}, Cmplx{1.0}});
+  emsr::LaguerreSolver<double> dlag(DP);
+  const auto dclusters = dlag.solve_clusters();
+  int num_double = 0;
+  for (const auto& c : dclusters)
+    {
+      std::cout << "double zero cluster: center = " << c.center
+		<< " radius = " << c.radius
+		<< " multiplicity = " << c.multiplicity << '\n';
+      if (c.multiplicity == 2)
+	{
+	  ++num_double;
+	  if (abs(c.center - 1.5) > c.radius || c.radius > 1.0e-6)
+	    ++num_errors;
+	}
+      else if (c.multiplicity != 1)
+	++num_errors;
+    }
+  if (dclusters.size() != 3 || num_double != 1)
+    ++num_errors;
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
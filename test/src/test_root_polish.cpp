@@ -0,0 +1,92 @@
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+
+#include <emsr/polynomial.h>
+#include <emsr/solver_jenkins_traub.h>
+#include <emsr/root_polish.h>
+
+/**
+ * Return the largest distance of the zeros from the nearest integer.
+ */
+double
+max_error(const std::vector<emsr::Solution<double>>& zeros)
+{
+  double err = 0.0;
+  for (const auto& z : zeros)
+    {
+      const auto re = emsr::real(z);
+      err = std::max(err, std::abs(re - std::round(re)));
+      err = std::max(err, std::abs(emsr::imag(z)));
+    }
+  return err;
+}
+
+int
+main()
+{
+  int num_errors = 0;
+  std::cout << std::setprecision(17);
+
+  // The Wilkinson polynomial of degree 12 has exact double coefficients.
+  const int n = 12;
+  emsr::Polynomial<double> W{1.0};
+  for (int k = 1; k <= n; ++k)
+    W *= emsr::Polynomial<double>({-double(k), 1.0});
+
+  std::vector<double> coef(W.rbegin(), W.rend());
+  emsr::JenkinsTraubSolver<double> jt(coef);
+  auto zeros = jt.solve();
+  if (zeros.size() != std::size_t(n))
+    ++num_errors;
+
+  const auto err0 = max_error(zeros);
+  std::cout << "error before polishing = " << err0 << '\n';
+  for (const auto& z : zeros)
+    std::cout << "  cond(" << emsr::real(z) << ") = "
+	      << emsr::root_condition(W, std::complex<double>(emsr::real(z),
+							       emsr::imag(z)))
+	      << '\n';
+
+  const auto num_polish = emsr::polish_roots(W, zeros);
+  const auto err1 = max_error(zeros);
+  std::cout << "polished " << num_polish << " zeros\n";
+  std::cout << "error after polishing = " << err1 << '\n';
+  if (num_polish == 0)
+    ++num_errors;
+  if (err1 > 4 * std::numeric_limits<double>::epsilon() * n)
+    ++num_errors;
+
+  // Polishing in long double works too.
+  // The solver deflates as it goes so a fresh one is needed.
+  emsr::JenkinsTraubSolver<double> jt2(coef);
+  auto zeros2 = jt2.solve();
+  if (zeros2.size() != std::size_t(n))
+    ++num_errors;
+  if (max_error(zeros2) != err0)
+    ++num_errors;
+  emsr::polish_roots<double, long double>(W, zeros2);
+  const auto err2 = max_error(zeros2);
+  std::cout << "error after long double polishing = " << err2 << '\n';
+  if (err2 > 1.0e-3 * err0)
+    ++num_errors;
+
+  // Well-conditioned zeros are left alone.
+  const emsr::Polynomial<double> P({-2.0, 0.0, 1.0});
+  std::vector<std::complex<double>> z2{{-1.4142135623730951, 0.0},
+				       {1.4142135623730951, 0.0}};
+  const auto z2_save = z2;
+  if (emsr::polish_roots(P, z2) != 0 || z2 != z2_save)
+    ++num_errors;
+
+  // A double zero has infinite condition.
+  const emsr::Polynomial<double> D({1.0, -2.0, 1.0});
+  if (!std::isinf(emsr::root_condition(D, std::complex<double>(1.0))))
+    ++num_errors;
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
@@ -0,0 +1,76 @@
+
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <complex>
+
+#include <emsr/solver_bairstow.h>
+#include <emsr/solver_jenkins_traub.h>
+#include <emsr/solver_quadratic.h>
+
+int
+main()
+{
+  int num_errors = 0;
+
+  // The ring buffer keeps the oldest records and counts the rest.
+  emsr::RingBufferSink<4> ring;
+  for (int i = 0; i < 6; ++i)
+    ring.record({emsr::SolverEvent::restart, "test", i, 0.0});
+  ring.record({emsr::SolverEvent::rescale, "test", 6, 2.0});
+  std::cout << "size = " << ring.size() << "  dropped = " << ring.dropped()
+	    << "  restarts = " << ring.count(emsr::SolverEvent::restart)
+	    << "  rescales = " << ring.count(emsr::SolverEvent::rescale) << '\n';
+  if (ring.size() != 4 || ring.dropped() != 3
+   || ring.count(emsr::SolverEvent::restart) != 6
+   || ring.count(emsr::SolverEvent::rescale) != 1)
+    ++num_errors;
+  std::vector<emsr::SolverDiagnostic> diags;
+  ring.drain(std::back_inserter(diags));
+  for (const auto& diag : diags)
+    std::cout << diag << '\n';
+  if (diags.size() != 4 || diags.front().iteration != 0
+   || diags.back().iteration != 3 || ring.size() != 0)
+    ++num_errors;
+
+  // A polynomial with tiny coefficients is rescaled by Jenkins-Traub.
+  emsr::RingBufferSink<> jt_sink;
+  std::vector<double> tiny{1.0e-40, -6.0e-40, 11.0e-40, -6.0e-40};
+  emsr::JenkinsTraubSolver<double> jt(tiny);
+  jt.diagnostics(&jt_sink);
+  const auto zeros = jt.solve();
+  jt_sink.drain(std::ostream_iterator<emsr::SolverDiagnostic>(std::cout, "\n"));
+  if (zeros.size() != 3 || jt_sink.count(emsr::SolverEvent::rescale) == 0)
+    ++num_errors;
+
+  // Solvers without a sink stay silent.
+  emsr::BairstowSolver<double> bairstow(std::vector<double>{-6.0, 11.0,
+							    -6.0, 1.0}, 12345);
+  const auto bzeros = bairstow.solve();
+  if (bzeros.size() != 3)
+    ++num_errors;
+
+  // The quadratic factor step reports the iteration limit and does not throw.
+  emsr::RingBufferSink<> quad_sink;
+  emsr::Polynomial<std::complex<double>>
+    quartic({{0.0, -1.0}, {1.0, -2.0}, {2.0, -3.0}, {3.0, -4.0}, {1.0, 0.0}});
+  emsr::QuadraticSolver<double> quad(quartic);
+  quad.diagnostics(&quad_sink);
+  quad.max_num_iters(1);
+  try
+    {
+      const auto q = quad.step();
+      quad_sink.drain(std::ostream_iterator<emsr::SolverDiagnostic>(std::cout,
+								     "\n"));
+      if (q.degree() != 2 || quad.polynomial().degree() != 2
+       || quad_sink.count(emsr::SolverEvent::max_iterations) != 1)
+	++num_errors;
+    }
+  catch (const std::exception& err)
+    {
+      std::cout << "QuadraticSolver::step threw: " << err.what() << '\n';
+      ++num_errors;
+    }
+
+  return num_errors;
+}
@@ -0,0 +1,89 @@
+
+#include <iostream>
+#include <iomanip>
+#include <complex>
+#include <cmath>
+
+#include <emsr/sparse_polynomial.h>
+
+#include "test_check.h"
+
+int
+main()
+{
+  int num_errors = 0;
+  std::cout << std::setprecision(std::numeric_limits<double>::digits10);
+
+  const auto eps = std::numeric_limits<double>::epsilon();
+  const ErrorCheck check(num_errors);
+
+  using SP = emsr::SparsePolynomial<double>;
+
+  // Terms are sorted, combined and zeros dropped.
+  const SP P{{100000, 1.0}, {57, 3.0}, {0, 1.0}, {57, -1.0}, {3, 0.0}};
+  std::cout << "P = " << P << '\n';
+  if (P.num_terms() != 3 || P.degree() != 100000 || P.coefficient(57) != 2.0
+      || P.coefficient(58) != 0.0)
+    ++num_errors;
+
+  // Evaluation over the gaps.
+  const auto x = 0.9999;
+  check("P(x)", P(x) - (std::pow(x, 100000) + 2.0 * std::pow(x, 57) + 1.0),
+	1.0e-12);
+  const std::complex<double> z(0.6, 0.8);
+  check("P(z)", std::abs(P(z) - (std::pow(z, 100000) + 2.0 * std::pow(z, 57)
+				  + 1.0)),
+	1.0e-9);
+
+  // Products agree with the dense products.
+  const SP A{{0, 1.0}, {3, -2.0}, {7, 0.5}, {8, 1.5}, {20, -1.0}};
+  const SP B{{1, 2.0}, {4, 1.0}, {5, -3.0}, {13, 0.25}};
+  const auto AB = A * B;
+  const auto dAB = A.dense() * B.dense();
+  if (AB.dense().degree() != dAB.degree())
+    ++num_errors;
+  auto err = 0.0;
+  for (std::size_t i = 0; i <= dAB.degree(); ++i)
+    err = std::max(err, std::abs(AB.coefficient(i) - dAB[i]));
+  check("product", err, 16 * eps);
+  if (AB != B * A)
+    ++num_errors;
+
+  // Cancellation: (1 + x^1000)(1 - x^1000) = 1 - x^2000.
+  const auto C = SP{{0, 1.0}, {1000, 1.0}} * SP{{0, 1.0}, {1000, -1.0}};
+  if (C != SP{{0, 1.0}, {2000, -1.0}})
+    ++num_errors;
+  if ((A - A).num_terms() != 0 || !(A + SP(0.0) == A))
+    ++num_errors;
+
+  // Calculus.
+  const auto dA = A.derivative();
+  const auto IA = A.integral(2.0);
+  const auto ddA = A.dense().derivative();
+  err = 0.0;
+  for (std::size_t i = 0; i <= ddA.degree(); ++i)
+    err = std::max(err, std::abs(dA.coefficient(i) - ddA[i]));
+  check("derivative", err, 0.0);
+  check("integral", (IA.derivative() - A).num_terms(), 0.0);
+  check("integral constant", IA(0.0) - 2.0, 0.0);
+
+  // Round trip through the dense polynomial.
+  if (SP(A.dense()) != A)
+    ++num_errors;
+
+  // A sparse product with many terms.
+  SP D, E;
+  for (int k = 0; k < 200; ++k)
+    {
+      D += SP(1.0 + k, 37 * k * k);
+      E += SP(1.0 - 0.5 * k, 1000 * k + 3);
+    }
+  const auto DE = D * E;
+  check("D(x)E(x)", (DE(0.99999) - D(0.99999) * E(0.99999))
+		    / std::abs(D(0.99999) * E(0.99999)), 1.0e-12);
+  std::cout << "terms in D * E = " << DE.num_terms() << '\n';
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
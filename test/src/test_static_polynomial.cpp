@@ -9,11 +9,82 @@
 
 #include <emsr/static_polynomial.h>
 
-constexpr void
+/**
+ * Exercise the static polynomial entirely at compile time.
+ */
+constexpr bool
 test_static_polynomial()
 {
+  constexpr emsr::StaticPolynomial<double, 4> P({0.0, 1.0, 2.0, 3.0});
+  constexpr emsr::StaticPolynomial<double, 2> Q({2.0, 1.0});
+
+  // Evaluation.
+  static_assert(P(2.0) == 34.0);
+  static_assert(P(2) == 34.0);
+  static_assert(P.eval_even(2.0) == 8.0);
+  static_assert(P.eval_odd(2.0) == 26.0);
+  static_assert(emsr::StaticPolynomial<double, 1>({4.0})(3.0) == 4.0);
+
+  // Constructors.
+  constexpr std::array<double, 3> arr{1.0, 2.0, 3.0};
+  constexpr emsr::StaticPolynomial<double, 3> A(arr.begin(), arr.end());
+  static_assert(A == emsr::StaticPolynomial<double, 3>({1.0, 2.0, 3.0}));
+  constexpr emsr::StaticPolynomial<double, 4> M(2.0, 3);
+  static_assert(M == emsr::StaticPolynomial<double, 4>({0.0, 0.0, 0.0, 2.0}));
+
+  // Arithmetic.
+  static_assert(P + Q == emsr::StaticPolynomial<double, 4>({2.0, 2.0, 2.0, 3.0}));
+  static_assert(P - Q == emsr::StaticPolynomial<double, 4>({-2.0, 0.0, 2.0, 3.0}));
+  static_assert(P * Q
+	     == emsr::StaticPolynomial<double, 5>({0.0, 2.0, 5.0, 8.0, 3.0}));
+  static_assert(2.0 * P == P + P);
+  static_assert(1.0 - P == -(P - 1.0));
+
+  // Division.
+  constexpr auto qr = emsr::divmod(P, Q);
+  static_assert(qr.quo == emsr::StaticPolynomial<double, 3>({9.0, -4.0, 3.0}));
+  static_assert(qr.rem == emsr::StaticPolynomial<double, 1>({-18.0}));
+  static_assert(P / Q == qr.quo);
+  static_assert(P % Q == qr.rem);
+
+  // Calculus.
+  static_assert(P.derivative()
+	     == emsr::StaticPolynomial<double, 3>({1.0, 4.0, 9.0}));
+  constexpr emsr::StaticPolynomial<double, 3> D({1.0, 2.0, 3.0});
+  static_assert(D.integral(5.0)
+	     == emsr::StaticPolynomial<double, 4>({5.0, 1.0, 1.0, 1.0}));
+  static_assert(D.integral(5.0).derivative() == D);
+  static_assert(D.integral(0.0, 2.0) == 14.0);
+
+  std::array<double, 4> deriv{};
+  P.eval(1.0, deriv);
+  if (deriv[0] != 6.0 || deriv[1] != 14.0
+   || deriv[2] != 22.0 || deriv[3] != 18.0)
+    return false;
+
+  // Composition.
+  static_assert(emsr::compose(P, Q)
+	     == emsr::StaticPolynomial<double, 4>({34.0, 45.0, 20.0, 3.0}));
+  static_assert(emsr::compose(P, Q)(1.5) == P(Q(1.5)));
+
+  // Conversion between coefficient types.
+  constexpr emsr::StaticPolynomial<float, 3> Pf({1.0F, -2.0F, 0.5F});
+  constexpr emsr::StaticPolynomial<double, 3> Pd(Pf);
+  static_assert(Pd == emsr::StaticPolynomial<double, 3>({1.0, -2.0, 0.5}));
+
+  // Root bounds: (x - 1)(x - 2)(x - 3).
+  constexpr emsr::StaticPolynomial<double, 4> W({-6.0, 11.0, -6.0, 1.0});
+  static_assert(emsr::cauchy_bound(W) == 12.0);
+  static_assert(emsr::fujiwara_bound(W) >= 3.0);
+  static_assert(emsr::fujiwara_bound(W) <= emsr::cauchy_bound(W));
+  static_assert(emsr::fujiwara_bound(emsr::StaticPolynomial<double, 3>({-8.0, 0.0, 1.0}))
+	     == 2.0 * 2.0);
+
+  return true;
 }
 
+static_assert(test_static_polynomial());
+
 int
 main()
 {
@@ -57,7 +128,7 @@ main()
   std::cout << "degree(Q) = " << Q.degree() << '\n';
   std::cout << "P + Q = " << P + Q << '\n';
   std::cout << "P - Q = " << P - Q << '\n';
-  //std::cout << "P * Q = " << P * Q << '\n';
+  std::cout << "P * Q = " << P * Q << '\n';
   std::cout << "P / Q = " << P / Q << '\n';
   std::cout << "P % Q = " << P % Q << '\n';
 
@@ -73,4 +144,10 @@ main()
   std::cout << "a + P = " << a + P << '\n';
   std::cout << "a - P = " << a - P << '\n';
   std::cout << "a * P = " << a * P << '\n';
+
+  std::cout << "P(Q) = " << emsr::compose(P, Q) << '\n';
+  std::cout << "cauchy_bound(P) = " << emsr::cauchy_bound(P) << '\n';
+  std::cout << "fujiwara_bound(P) = " << emsr::fujiwara_bound(P) << '\n';
+
+  return test_static_polynomial() ? 0 : 1;
 }
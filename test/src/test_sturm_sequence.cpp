@@ -0,0 +1,75 @@
+
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <cmath>
+
+#include <emsr/polynomial.h>
+#include <emsr/sturm_sequence.h>
+
+int
+main()
+{
+  int num_errors = 0;
+  const auto inf = std::numeric_limits<double>::infinity();
+
+  const auto check = [&num_errors](const char* what, int got, int expect)
+    {
+      std::cout << what << ": " << got << " (expected " << expect << ")\n";
+      if (got != expect)
+	++num_errors;
+    };
+
+  // P(x) = (x + 3)(x - 1/2)(x - 1)(x - 2)(x^2 + 1)
+  emsr::Polynomial<double> P({1.0});
+  for (double r : {-3.0, 0.5, 1.0, 2.0})
+    P *= emsr::Polynomial<double>({-r, 1.0});
+  P *= emsr::Polynomial<double>({1.0, 0.0, 1.0});
+  const emsr::SturmSequence<double> SP(P);
+  std::cout << "chain size: " << SP.size() << '\n';
+  for (std::size_t i = 0; i < SP.size(); ++i)
+    std::cout << "  " << SP.member(i) << '\n';
+  check("P all", SP.num_roots(), 4);
+  check("P (-inf, 0]", SP.num_roots(-inf, 0.0), 1);
+  check("P (0, 1.5]", SP.num_roots(0.0, 1.5), 2);
+  check("P (0.75, 1.25]", SP.num_roots(0.75, 1.25), 1);
+  check("P (1.25, 10]", SP.num_roots(1.25, 10.0), 1);
+
+  // Multiple zeros are counted once.
+  // Q(x) = (x - 1)^2 (x - 3)
+  emsr::Polynomial<double> Q({1.0, -2.0, 1.0});
+  Q *= emsr::Polynomial<double>({-3.0, 1.0});
+  const emsr::SturmSequence<double> SQ(Q);
+  check("Q all", SQ.num_roots(), 2);
+  check("Q (0, 2]", SQ.num_roots(0.0, 2.0), 1);
+
+  // Repeated counts over many subintervals.
+  // W(x) = (x - 1)(x - 2)...(x - 10)
+  emsr::Polynomial<double> W({1.0});
+  for (int r = 1; r <= 10; ++r)
+    W *= emsr::Polynomial<double>({-double(r), 1.0});
+  const emsr::SturmSequence<double> SW(W);
+  check("W all", SW.num_roots(), 10);
+  int total = 0;
+  for (int k = 0; k < 1000; ++k)
+    {
+      const auto a = 0.25 + k * 0.0113;
+      const auto n = SW.num_roots(a, a + 0.0113);
+      if (n != 0)
+	{
+	  std::cout << "  (" << a << ", " << a + 0.0113 << "]: " << n << '\n';
+	  const auto r = std::round(a + 0.0113);
+	  if (n != 1 || r <= a || r > a + 0.0113)
+	    ++num_errors;
+	}
+      total += n;
+    }
+  check("W subintervals", total, 10);
+
+  // A constant has no zeros.
+  check("constant", emsr::SturmSequence<double>(emsr::Polynomial<double>(2.0)).num_roots(), 0);
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}
@@ -0,0 +1,119 @@
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+#include <emsr/synthetic_division.h>
+#include <emsr/polynomial.h>
+
+int
+main()
+{
+  int num_errors = 0;
+  const double tol = 1.0e-12;
+
+  // P(x) = 2x^5 - x^4 + 3x^3 - 2x^2 + 5x + 1, high order first.
+  const std::vector<double> p{2.0, -1.0, 3.0, -2.0, 5.0, 1.0};
+  const std::size_t n = p.size() - 1;
+  const emsr::Polynomial<double> P(p.rbegin(), p.rend());
+
+  // Linear division gives the value and the quotient.
+  const double s = 0.7;
+  std::vector<double> q(p.size());
+  const auto pv = emsr::synthetic_divide_linear(p.begin(), p.end(), s,
+						q.begin());
+  std::cout << "P(" << s << ") = " << pv << '\n';
+  if (std::abs(pv - P(s)) > tol)
+    ++num_errors;
+  emsr::Polynomial<double> quo, rem;
+  divmod(P, emsr::Polynomial<double>({-s, 1.0}), quo, rem);
+  for (std::size_t i = 0; i < n; ++i)
+    if (std::abs(q[i] - quo[n - 1 - i]) > tol)
+      ++num_errors;
+
+  // Division in place.
+  auto pp = p;
+  emsr::synthetic_divide_linear(pp.begin(), pp.end(), s, pp.begin());
+  if (pp != q)
+    ++num_errors;
+
+  // Quadratic division matches divmod.
+  const double u = -0.3, v = 1.2;
+  const auto ab = emsr::synthetic_divide_quadratic(p.begin(), p.end(),
+						   u, v, q.begin());
+  divmod(P, emsr::Polynomial<double>({v, u, 1.0}), quo, rem);
+  for (std::size_t i = 0; i + 1 < n; ++i)
+    if (std::abs(q[i] - quo[n - 2 - i]) > tol)
+      ++num_errors;
+  std::cout << "remainder = " << ab.second << "x + "
+	    << ab.first + ab.second * u << '\n';
+  if (std::abs(ab.second - rem[1]) > tol
+   || std::abs(ab.first + ab.second * u - rem[0]) > tol)
+    ++num_errors;
+
+  // The fused double division matches two single divisions.
+  std::vector<double> q2(p.size()), qq(p.size()), qq2(p.size());
+  emsr::synthetic_divide_quadratic2(p.begin(), p.end(), u, v,
+				    q2.begin(), qq.begin());
+  emsr::synthetic_divide_quadratic(q.begin(), q.end(), u, v, qq2.begin());
+  if (q2 != q || qq != qq2)
+    ++num_errors;
+
+  // The lane kernels match the scalar kernels bit for bit.
+  constexpr std::size_t lanes = 4;
+  std::vector<double> pl(p.size() * lanes);
+  double sl[lanes], ul[lanes], vl[lanes];
+  for (std::size_t k = 0; k < lanes; ++k)
+    {
+      sl[k] = 0.5 + 0.25 * k;
+      ul[k] = -0.3 + 0.1 * k;
+      vl[k] = 1.2 - 0.2 * k;
+      for (std::size_t i = 0; i < p.size(); ++i)
+	pl[i * lanes + k] = p[i] * (1.0 + 0.5 * k);
+    }
+  std::vector<double> ql(pl.size()), qql(pl.size());
+  std::vector<double> pk(p.size()), qk(p.size()), qqk(p.size());
+
+  emsr::synthetic_divide_linear_lanes<lanes>(pl.data(), p.size(), sl,
+					     ql.data());
+  for (std::size_t k = 0; k < lanes; ++k)
+    {
+      for (std::size_t i = 0; i < p.size(); ++i)
+	pk[i] = pl[i * lanes + k];
+      emsr::synthetic_divide_linear(pk.begin(), pk.end(), sl[k], qk.begin());
+      for (std::size_t i = 0; i < p.size(); ++i)
+	if (ql[i * lanes + k] != qk[i])
+	  ++num_errors;
+    }
+
+  emsr::synthetic_divide_quadratic_lanes<lanes>(pl.data(), p.size(),
+						ul, vl, ql.data());
+  for (std::size_t k = 0; k < lanes; ++k)
+    {
+      for (std::size_t i = 0; i < p.size(); ++i)
+	pk[i] = pl[i * lanes + k];
+      emsr::synthetic_divide_quadratic(pk.begin(), pk.end(), ul[k], vl[k],
+				       qk.begin());
+      for (std::size_t i = 0; i < p.size(); ++i)
+	if (ql[i * lanes + k] != qk[i])
+	  ++num_errors;
+    }
+
+  emsr::synthetic_divide_quadratic2_lanes<lanes>(pl.data(), p.size(),
+						 ul, vl, ql.data(),
+						 qql.data());
+  for (std::size_t k = 0; k < lanes; ++k)
+    {
+      for (std::size_t i = 0; i < p.size(); ++i)
+	pk[i] = pl[i * lanes + k];
+      emsr::synthetic_divide_quadratic2(pk.begin(), pk.end(), ul[k], vl[k],
+					qk.begin(), qqk.begin());
+      for (std::size_t i = 0; i < p.size(); ++i)
+	if (ql[i * lanes + k] != qk[i] || qql[i * lanes + k] != qqk[i])
+	  ++num_errors;
+    }
+
+  std::cout << "num_errors = " << num_errors << '\n';
+
+  return num_errors;
+}